@@ -256,6 +256,27 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Memory budget in bytes for a block cache shared by the files read with `lv_fs_read()`.
+ *The blocks are kept after the file is closed, so reopened files are read from the RAM.
+ *It's used for drivers with `cache_size == 0` and the files opened only for reading.
+ *0: to disable the block cache*/
+#define LV_FS_BLOCK_CACHE_SIZE 0
+#if LV_FS_BLOCK_CACHE_SIZE
+    #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 512    /*Size of a block in bytes*/
+    #define LV_FS_BLOCK_CACHE_READAHEAD 4       /*Read this many blocks at once if a file is read sequentially*/
+#endif
+
+/*1: Enable the asynchronous file system API (`lv_fs_async_...()`). Requires `LV_USE_OS`.
+ *A thread reads the files and the callbacks are called from `lv_timer_handler()`*/
+#define LV_USE_FS_ASYNC 0
+
+/*Number of resolved style properties cached per object (a power of 2, e.g. 32).
+ *`lv_obj_get_style_...()` returns the cached value instead of checking all styles of the object and its parents.
+ *The cache is allocated when a style property of the object is read first and uses
+ *`(sizeof(lv_style_value_t) + 4) * LV_OBJ_STYLE_CACHE_SIZE + 8` bytes per object.
+ *0: to disable the cache*/
+#define LV_OBJ_STYLE_CACHE_SIZE 0
+
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -357,6 +378,25 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Size of the cache in bytes for the A8 bitmaps of the glyphs of the built-in and binary (`lv_font_load()`) fonts.
+ *The glyphs don't need to be unpacked or decompressed again when they are drawn the next time.
+ *0: to disable caching*/
+#define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE 0
+
+/*Find the glyphs of the letters in a table instead of searching them in the cmaps of the font.
+ *The table is built per font in pages of 256 letters (512 bytes) when the letters of a page are used first.
+ *Speeds up rendering large fonts with many cmaps (e.g. CJK fonts). Requires `cache` to be set in the font's descriptor.*/
+#define LV_USE_FONT_GLYPH_ID_LOOKUP 0
+
+/*Find the kerning values of the fonts with kerning pairs in a hash table instead of a binary search.
+ *The table is built per font when it's used first and needs about 10 bytes per kerning pair.
+ *(Class based kerning is always a table lookup.) Requires `cache` to be set in the font's descriptor.*/
+#define LV_USE_FONT_KERN_LOOKUP 0
+
+/*Enable fonts whose glyphs are stored as signed distance fields (see `lv_font_sdf_init()`).
+ *One set of glyphs can be rendered at any size. Use `scripts/font_sdf_conv.py` to convert TTF fonts.*/
+#define LV_USE_FONT_SDF 0
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -451,6 +491,8 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LAYOUT_CACHE 0   /*Store the line breaks of labels to not break the lines again on every refresh and redraw*/
+    #define LV_LABEL_BITMAP_CACHE 0   /*Allow rendering the text of labels once to an A8 bitmap. Enable per label with `lv_label_set_bitmap_cache()`*/
 #endif
 
 #define LV_USE_LED        1
@@ -558,6 +600,13 @@
     #define LV_FS_WIN32_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
 #endif
 
+/*API for a read-only asset archive created by `scripts/fs_archive_pack.py`.
+ *Mount the archive with `lv_fs_archive_mount("S:path/to/assets.pak")`*/
+#define LV_USE_FS_ARCHIVE 0
+#if LV_USE_FS_ARCHIVE
+    #define LV_FS_ARCHIVE_LETTER '\0'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
+#endif
+
 /*API for FATFS (needs to be added separately). Uses f_open, f_read, etc*/
 #define LV_USE_FS_FATFS 0
 #if LV_USE_FS_FATFS
@@ -567,6 +616,15 @@
 
 /*PNG decoder library*/
 #define LV_USE_PNG 0
+#if LV_USE_PNG
+    /*1: Decode non-interlaced PNGs row by row in `read_line` instead of decoding the whole image when it's opened.
+     *   It needs about 40 kB + `LV_PNG_STREAM_ROW_CACHE_CNT` rows of RAM regardless of the image's height*/
+    #define LV_PNG_USE_STREAM 0
+    #if LV_PNG_USE_STREAM
+        /*Number of decoded rows to keep. Reading a row before the cached ones restarts decoding from the first row*/
+        #define LV_PNG_STREAM_ROW_CACHE_CNT 4
+    #endif
+#endif
 
 /*BMP decoder library*/
 #define LV_USE_BMP 0
@@ -574,9 +632,24 @@
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_SJPG 0
+#if LV_USE_SJPG
+    /*Number of worker threads decoding the slices of split JPGs in parallel. Requires `LV_USE_OS`.
+     *0: decode the slices one by one in `read_line`*/
+    #define LV_SJPG_THREAD_CNT 0
+    #if LV_SJPG_THREAD_CNT
+        /*Number of slices to decode ahead in the direction of reading (e.g. while scrolling)*/
+        #define LV_SJPG_PREFETCH_CNT 2
+    #endif
+#endif
 
 /*GIF decoder library*/
 #define LV_USE_GIF 0
+#if LV_USE_GIF
+    /*1: Decode the next frame on a separate thread into a second buffer while the current frame is shown.
+     *   Requires `LV_USE_OS` and a thread-safe file system driver to open GIF files.
+     *   Needs 2 more buffers with the size of the GIF's canvas*/
+    #define LV_GIF_USE_THREAD 0
+#endif
 
 /*QR code library*/
 #define LV_USE_QRCODE 0
@@ -602,6 +675,10 @@
     /* (0:use system defaults) */
     #define LV_FREETYPE_CACHE_FT_FACES 4
     #define LV_FREETYPE_CACHE_FT_SIZES 4
+
+    /* Size of a cache of rendered A8 glyphs in front of the FreeType cache [bytes].*/
+    /* The glyphs found in it can be used by several draw units in parallel without locking FreeType. (0: disable) */
+    #define LV_FREETYPE_GLYPH_CACHE_SIZE 0
 #endif
 
 /* Built-in TTF decoder */
@@ -609,10 +686,28 @@
 #if LV_USE_TINY_TTF
     /* Enable loading TTF data from files */
     #define LV_TINY_TTF_FILE_SUPPORT 0
+
+    /* Render the glyphs of a range of letters into an A8 atlas when a font is created or resized
+     * to avoid rasterizing them one by one on their first use */
+    #define LV_TINY_TTF_ATLAS 0
+    #if LV_TINY_TTF_ATLAS
+        /* First and last letter of the range (printable ASCII by default) */
+        #define LV_TINY_TTF_ATLAS_FIRST 0x20
+        #define LV_TINY_TTF_ATLAS_LAST  0x7E
+    #endif
 #endif
 
 /*Rlottie library*/
 #define LV_USE_RLOTTIE 0
+#if LV_USE_RLOTTIE
+    /*1: Render the next frame on a separate thread while the current frame is shown.
+     *   Requires `LV_USE_OS`. Needs 1 more buffer with the size of the animation*/
+    #define LV_RLOTTIE_USE_THREAD 0
+
+    /*Size of the cache of rendered frames in bytes shared by all animations.
+     *Looping animations render each frame only once if all their frames fit. 0: disable caching*/
+    #define LV_RLOTTIE_CACHE_SIZE 0
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -620,6 +715,14 @@
 #if LV_USE_FFMPEG
     /*Dump input information to stderr*/
     #define LV_FFMPEG_DUMP_FORMAT 0
+
+    /*1: Demux and decode the video on a separate thread and drop the late frames.
+     *   Requires `LV_USE_OS`*/
+    #define LV_FFMPEG_USE_THREAD 0
+    #if LV_FFMPEG_USE_THREAD
+        /*Number of decoded frames buffered ahead. Each needs a buffer with the size of the video*/
+        #define LV_FFMPEG_FRAME_QUEUE_CNT 2
+    #endif
 #endif
 
 /*==================
@@ -31,6 +31,7 @@ extern "C" {
 #include "src/misc/lv_timer.h"
 #include "src/misc/lv_math.h"
 #include "src/misc/lv_async.h"
+#include "src/misc/lv_fs_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_profiler_builtin.h"
 
@@ -45,6 +46,7 @@ extern "C" {
 #include "src/font/lv_font.h"
 #include "src/font/lv_font_loader.h"
 #include "src/font/lv_font_fmt_txt.h"
+#include "src/font/lv_font_sdf.h"
 
 #include "src/widgets/animimg/lv_animimg.h"
 #include "src/widgets/arc/lv_arc.h"
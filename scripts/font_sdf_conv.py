@@ -0,0 +1,411 @@
+#!/usr/bin/env python3
+#
+# Convert the glyphs of a TrueType font to signed distance fields for LVGL's SDF font engine (LV_USE_FONT_SDF).
+# The generated C file contains an `lv_font_sdf_dsc_t` which can be rendered at any size with
+# `lv_font_sdf_init(&font, &dsc, line_height)`.
+#
+# Usage:
+#   python3 font_sdf_conv.py --size 32 --spread 4 -r 0x20-0x7E,0xB0 --name my_font_sdf -o my_font_sdf.c font.ttf
+#
+# Only TrueType outlines (the `glyf` table) are supported, not CFF based OpenType fonts. Kerning is not converted.
+#
+# Each glyph's field covers its bounding box at `size` plus `spread` pixels on each side. The value of a pixel is
+# 128 on the outline and changes by 127 / spread per pixel: it's higher inside the glyph and lower outside.
+#
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+CURVE_STEPS = 6     # Number of line segments a quadratic Bezier curve is split into
+
+
+class TrueTypeFont:
+    def __init__(self, data):
+        self.data = data
+        num_tables = struct.unpack_from(">H", data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, ofs, length = struct.unpack_from(">4sIII", data, 12 + i * 16)
+            self.tables[tag.decode("latin-1")] = (ofs, length)
+
+        if "glyf" not in self.tables:
+            sys.exit("Only TrueType outlines (glyf table) are supported")
+
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", data, head + 18)[0]
+        self.long_loca = struct.unpack_from(">h", data, head + 50)[0] == 1
+
+        hhea = self.tables["hhea"][0]
+        self.ascent, self.descent = struct.unpack_from(">hh", data, hhea + 4)
+        self.num_hmetrics = struct.unpack_from(">H", data, hhea + 34)[0]
+        self.num_glyphs = struct.unpack_from(">H", data, self.tables["maxp"][0] + 4)[0]
+        self.cmap = self.read_cmap()
+
+    def u16(self, ofs):
+        return struct.unpack_from(">H", self.data, ofs)[0]
+
+    def read_cmap(self):
+        cmap = self.tables["cmap"][0]
+        subtables = {}
+        for i in range(self.u16(cmap + 2)):
+            platform, encoding, ofs = struct.unpack_from(">HHI", self.data, cmap + 4 + i * 8)
+            subtables[(platform, encoding)] = cmap + ofs
+
+        for key in [(3, 10), (0, 4), (0, 6), (3, 1), (0, 3), (0, 1), (0, 0)]:
+            if key not in subtables:
+                continue
+            ofs = subtables[key]
+            fmt = self.u16(ofs)
+            if fmt == 4:
+                return self.read_cmap_format4(ofs)
+            if fmt == 12:
+                return self.read_cmap_format12(ofs)
+        sys.exit("No supported Unicode cmap (format 4 or 12) in the font")
+
+    def read_cmap_format4(self, ofs):
+        seg_cnt = self.u16(ofs + 6) // 2
+        ends = ofs + 14
+        starts = ends + seg_cnt * 2 + 2
+        deltas = starts + seg_cnt * 2
+        range_ofss = deltas + seg_cnt * 2
+        result = {}
+        for i in range(seg_cnt):
+            end = self.u16(ends + i * 2)
+            start = self.u16(starts + i * 2)
+            delta = self.u16(deltas + i * 2)
+            range_ofs = self.u16(range_ofss + i * 2)
+            for c in range(start, end + 1):
+                if c == 0xFFFF:
+                    continue
+                if range_ofs == 0:
+                    gid = (c + delta) & 0xFFFF
+                else:
+                    gid = self.u16(range_ofss + i * 2 + range_ofs + (c - start) * 2)
+                    if gid:
+                        gid = (gid + delta) & 0xFFFF
+                if gid:
+                    result[c] = gid
+        return result
+
+    def read_cmap_format12(self, ofs):
+        group_cnt = struct.unpack_from(">I", self.data, ofs + 12)[0]
+        result = {}
+        for i in range(group_cnt):
+            start, end, gid = struct.unpack_from(">III", self.data, ofs + 16 + i * 12)
+            for c in range(start, end + 1):
+                result[c] = gid + c - start
+        return result
+
+    def advance(self, gid):
+        hmtx = self.tables["hmtx"][0]
+        return self.u16(hmtx + min(gid, self.num_hmetrics - 1) * 4)
+
+    def glyph_range(self, gid):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack_from(">II", self.data, loca + gid * 4)
+        else:
+            start, end = [2 * v for v in struct.unpack_from(">HH", self.data, loca + gid * 2)]
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, gid, depth=0):
+        """Return the contours of a glyph as lists of (x, y, on_curve) in font units"""
+        ofs, length = self.glyph_range(gid)
+        if length == 0 or depth > 8:
+            return []
+
+        contour_cnt = struct.unpack_from(">h", self.data, ofs)[0]
+        if contour_cnt < 0:
+            return self.composite_contours(ofs + 10, depth)
+
+        end_pts = struct.unpack_from(">%dH" % contour_cnt, self.data, ofs + 10)
+        point_cnt = end_pts[-1] + 1 if contour_cnt else 0
+        p = ofs + 10 + contour_cnt * 2
+        p += 2 + self.u16(p)    # Skip the instructions
+
+        flags = []
+        while len(flags) < point_cnt:
+            flag = self.data[p]
+            p += 1
+            flags.append(flag)
+            if flag & 8:
+                flags.extend([flag] * self.data[p])
+                p += 1
+
+        coords = [[], []]
+        for axis, (short_bit, same_bit) in enumerate([(0x02, 0x10), (0x04, 0x20)]):
+            v = 0
+            for flag in flags:
+                if flag & short_bit:
+                    d = self.data[p]
+                    p += 1
+                    v += d if flag & same_bit else -d
+                elif not flag & same_bit:
+                    v += struct.unpack_from(">h", self.data, p)[0]
+                    p += 2
+                coords[axis].append(v)
+
+        result = []
+        start = 0
+        for end in end_pts:
+            result.append([(coords[0][i], coords[1][i], flags[i] & 1) for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def composite_contours(self, p, depth):
+        result = []
+        while True:
+            flags, gid = struct.unpack_from(">HH", self.data, p)
+            p += 4
+            if flags & 0x01:
+                dx, dy = struct.unpack_from(">hh", self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, p)
+                p += 2
+            if not flags & 0x02:
+                # Matching points instead of offsets are rare, ignore them
+                dx = dy = 0
+
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x08:
+                a = d = struct.unpack_from(">h", self.data, p)[0] / 16384
+                p += 2
+            elif flags & 0x40:
+                a, d = [v / 16384 for v in struct.unpack_from(">hh", self.data, p)]
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = [v / 16384 for v in struct.unpack_from(">hhhh", self.data, p)]
+                p += 8
+
+            for contour in self.contours(gid, depth + 1):
+                result.append([(x * a + y * c + dx, x * b + y * d + dy, on) for x, y, on in contour])
+
+            if not flags & 0x20:
+                break
+        return result
+
+
+def flatten(contours, scale):
+    """Convert the contours to line segments in pixels"""
+    segments = []
+    for contour in contours:
+        if not contour:
+            continue
+        pts = [(x * scale, y * scale, on) for x, y, on in contour]
+        # Start from an on-curve point. If there is none, start from an implied one.
+        start = next((i for i, pt in enumerate(pts) if pt[2]), None)
+        if start is None:
+            x0 = (pts[0][0] + pts[1 % len(pts)][0]) / 2
+            y0 = (pts[0][1] + pts[1 % len(pts)][1]) / 2
+            pts = [(x0, y0, 1)] + pts[1:] + pts[:1]
+            start = 0
+        pts = pts[start:] + pts[:start] + [pts[start]]
+
+        cur = pts[0]
+        ctrl = None
+        for pt in pts[1:]:
+            if pt[2]:
+                if ctrl is None:
+                    segments.append((cur[0], cur[1], pt[0], pt[1]))
+                else:
+                    add_curve(segments, cur, ctrl, pt)
+                cur = pt
+                ctrl = None
+            else:
+                if ctrl is not None:
+                    mid = ((ctrl[0] + pt[0]) / 2, (ctrl[1] + pt[1]) / 2, 1)
+                    add_curve(segments, cur, ctrl, mid)
+                    cur = mid
+                ctrl = pt
+        if ctrl is not None:
+            add_curve(segments, cur, ctrl, pts[0])
+    return segments
+
+
+def add_curve(segments, p0, p1, p2):
+    px, py = p0[0], p0[1]
+    for i in range(1, CURVE_STEPS + 1):
+        t = i / CURVE_STEPS
+        u = 1 - t
+        x = u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0]
+        y = u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]
+        segments.append((px, py, x, y))
+        px, py = x, y
+
+
+def signed_distance(segments, x, y):
+    """Distance of a point from the outline, positive inside (non-zero winding rule)"""
+    min_d2 = float("inf")
+    winding = 0
+    for x0, y0, x1, y1 in segments:
+        dx = x1 - x0
+        dy = y1 - y0
+        len2 = dx * dx + dy * dy
+        t = 0.0 if len2 == 0 else max(0.0, min(1.0, ((x - x0) * dx + (y - y0) * dy) / len2))
+        ex = x0 + t * dx - x
+        ey = y0 + t * dy - y
+        d2 = ex * ex + ey * ey
+        if d2 < min_d2:
+            min_d2 = d2
+
+        if (y0 <= y) != (y1 <= y):
+            cross = dx * (y - y0) - (x - x0) * dy
+            if y1 > y0 and cross > 0:
+                winding += 1
+            elif y1 < y0 and cross < 0:
+                winding -= 1
+
+    d = math.sqrt(min_d2)
+    return d if winding != 0 else -d
+
+
+def render_glyph(font, gid, scale, spread):
+    """Return (box_w, box_h, ofs_x, ofs_y, field) of a glyph at the given scale"""
+    segments = flatten(font.contours(gid), scale)
+    if not segments:
+        return 0, 0, 0, 0, b""
+
+    x_min = min(min(s[0], s[2]) for s in segments)
+    x_max = max(max(s[0], s[2]) for s in segments)
+    y_min = min(min(s[1], s[3]) for s in segments)
+    y_max = max(max(s[1], s[3]) for s in segments)
+
+    ofs_x = math.floor(x_min) - spread
+    ofs_y = math.floor(y_min) - spread
+    box_w = math.ceil(x_max) + spread - ofs_x
+    box_h = math.ceil(y_max) + spread - ofs_y
+
+    field = bytearray()
+    # The rows are stored from top to bottom
+    for row in range(box_h):
+        y = ofs_y + box_h - row - 0.5
+        for col in range(box_w):
+            x = ofs_x + col + 0.5
+            d = signed_distance(segments, x, y)
+            field.append(max(0, min(255, int(round(128 + d * 127 / spread)))))
+    return box_w, box_h, ofs_x, ofs_y, bytes(field)
+
+
+def parse_ranges(text):
+    letters = set()
+    for part in text.split(","):
+        part = part.strip()
+        if not part:
+            continue
+        if "-" in part:
+            first, last = part.split("-")
+            letters.update(range(int(first, 0), int(last, 0) + 1))
+        else:
+            letters.add(int(part, 0))
+    return sorted(letters)
+
+
+def convert(path, size, spread, ranges, name, output):
+    with open(path, "rb") as f:
+        font = TrueTypeFont(f.read())
+    letters = parse_ranges(ranges)
+
+    # The same scaling as `stbtt_ScaleForPixelHeight()`: the size is the line height
+    scale = size / (font.ascent - font.descent)
+    base_line = size - int(font.ascent * scale)
+
+    glyphs = []
+    fields = bytearray()
+    for letter in letters:
+        gid = font.cmap.get(letter)
+        if gid is None:
+            print("U+%04X is not in the font, skipped" % letter)
+            continue
+        box_w, box_h, ofs_x, ofs_y, field = render_glyph(font, gid, scale, spread)
+        if box_w > 255 or box_h > 255 or not -128 <= ofs_x <= 127 or not -128 <= ofs_y <= 127:
+            sys.exit("U+%04X is too large, use a smaller size or spread" % letter)
+        adv_w = int(round(font.advance(gid) * scale * 16))
+        glyphs.append((letter, len(fields), adv_w, box_w, box_h, ofs_x, ofs_y))
+        fields += field
+
+    out = []
+    out.append("/*******************************************************************************")
+    out.append(" * Size: %d px" % size)
+    out.append(" * Spread: %d px" % spread)
+    out.append(" * Opts: --size %d --spread %d -r %s --font %s --name %s"
+               % (size, spread, ranges, os.path.basename(path), name))
+    out.append(" ******************************************************************************/")
+    out.append("")
+    out.append("#ifdef LV_LVGL_H_INCLUDE_SIMPLE")
+    out.append("    #include \"lvgl.h\"")
+    out.append("#else")
+    out.append("    #include \"lvgl/lvgl.h\"")
+    out.append("#endif")
+    out.append("")
+    out.append("#if LV_USE_FONT_SDF")
+    out.append("")
+    out.append("/*Distance fields of the glyphs*/")
+    out.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_sdf[] = {")
+    for letter, ofs, adv_w, box_w, box_h, ofs_x, ofs_y in glyphs:
+        size_b = box_w * box_h
+        if size_b == 0:
+            continue
+        out.append("    /* U+%04X */" % letter)
+        data = fields[ofs:ofs + size_b]
+        for i in range(0, len(data), 16):
+            out.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    if not fields:
+        out.append("    0")
+    out.append("};")
+    out.append("")
+    out.append("static const lv_font_sdf_glyph_dsc_t glyph_dsc[] = {")
+    for letter, ofs, adv_w, box_w, box_h, ofs_x, ofs_y in glyphs:
+        out.append("    {.sdf_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}, /* U+%04X */"
+                   % (ofs, adv_w, box_w, box_h, ofs_x, ofs_y, letter))
+    out.append("};")
+    out.append("")
+    out.append("/*The letters in increasing order. The glyph of `unicode_list[i]` is `glyph_dsc[i]`*/")
+    out.append("static const uint32_t unicode_list[] = {")
+    for i in range(0, len(glyphs), 8):
+        out.append("    " + ", ".join("0x%04x" % g[0] for g in glyphs[i:i + 8]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("const lv_font_sdf_dsc_t %s = {" % name)
+    out.append("    .glyph_sdf = glyph_sdf,")
+    out.append("    .glyph_dsc = glyph_dsc,")
+    out.append("    .unicode_list = unicode_list,")
+    out.append("    .glyph_cnt = %d," % len(glyphs))
+    out.append("    .line_height = %d," % size)
+    out.append("    .base_line = %d," % base_line)
+    out.append("    .spread = %d," % spread)
+    out.append("};")
+    out.append("")
+    out.append("#endif /*LV_USE_FONT_SDF*/")
+    out.append("")
+
+    with open(output, "w") as f:
+        f.write("\n".join(out))
+
+    print("%d glyphs, %d bytes of distance fields written to %s" % (len(glyphs), len(fields), output))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a TrueType font to signed distance fields for LV_USE_FONT_SDF")
+    parser.add_argument("font", help="path of the TTF file")
+    parser.add_argument("-o", "--output", required=True, help="path of the C file to generate")
+    parser.add_argument("--name", required=True, help="name of the generated lv_font_sdf_dsc_t variable")
+    parser.add_argument("--size", type=int, default=32,
+                        help="line height in pixels the fields are rendered at (default: 32)")
+    parser.add_argument("--spread", type=int, default=4,
+                        help="distance in pixels from the outline the fields cover (default: 4)")
+    parser.add_argument("-r", "--range", default="0x20-0x7E",
+                        help="comma separated letters and ranges to convert (default: %(default)s)")
+    args = parser.parse_args()
+
+    if args.size < 4 or args.spread < 1 or args.spread > 32:
+        sys.exit("Invalid size or spread")
+
+    convert(args.font, args.size, args.spread, args.range, args.name, args.output)
+
+
+if __name__ == "__main__":
+    main()
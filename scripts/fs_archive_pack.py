@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+#
+# Pack the files of a directory into an archive for LVGL's archive file system driver
+# (LV_USE_FS_ARCHIVE). The files can be opened as "<LV_FS_ARCHIVE_LETTER>:path/in/dir".
+#
+# Usage:
+#   python3 fs_archive_pack.py [--align N] [--compress] [--no-compress-ext .png,.jpg] -o assets.pak asset_dir
+#
+# Layout (little endian):
+#   header:  "LVAR", version (u16), alignment (u16), entry count (u32), size of the name table (u32)
+#   entries: name offset, data offset, stored size, original size (u32 each), compression (u8), 3 reserved bytes
+#            sorted by name
+#   names:   '\0' terminated paths with '/' separator
+#   data:    the content of the files, each aligned to `alignment`
+#
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b"LVAR"
+VERSION = 1
+HEADER_FORMAT = "<4sHHII"
+ENTRY_FORMAT = "<IIIIB3x"
+
+COMPRESSION_NONE = 0
+COMPRESSION_LZ4 = 1
+
+# Formats which are compressed anyway
+DEFAULT_NO_COMPRESS_EXT = ".png,.jpg,.jpeg,.sjpg,.gif,.mp3,.mp4,.ttf,.otf,.woff"
+
+
+def lz4_write_len(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def lz4_compress(data):
+    """Compress to an LZ4 block (without the frame format) with a simple greedy matcher"""
+    n = len(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    # The last match has to start at least 12 bytes before the end and the last 5 bytes are literals
+    limit = n - 12
+    while i < limit:
+        key = data[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > 65535:
+            i += 1
+            continue
+
+        match_len = 4
+        max_len = n - 5 - i
+        while match_len < max_len and data[cand + match_len] == data[i + match_len]:
+            match_len += 1
+
+        lit_len = i - anchor
+        ml = match_len - 4
+        out.append((min(lit_len, 15) << 4) | min(ml, 15))
+        if lit_len >= 15:
+            lz4_write_len(out, lit_len - 15)
+        out += data[anchor:i]
+        out += struct.pack("<H", i - cand)
+        if ml >= 15:
+            lz4_write_len(out, ml - 15)
+
+        i += match_len
+        anchor = i
+
+    lit_len = n - anchor
+    out.append(min(lit_len, 15) << 4)
+    if lit_len >= 15:
+        lz4_write_len(out, lit_len - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def collect_files(root):
+    files = []
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for fn in sorted(filenames):
+            path = os.path.join(dirpath, fn)
+            name = os.path.relpath(path, root).replace(os.sep, "/")
+            files.append((name, path))
+    # The driver looks up the files with binary search on the byte order of the names
+    files.sort(key=lambda f: f[0].encode("utf-8"))
+    return files
+
+
+def pack(root, output, align, compress, no_compress_ext):
+    files = collect_files(root)
+
+    names = bytearray()
+    name_ofs = []
+    for name, _ in files:
+        name_ofs.append(len(names))
+        names += name.encode("utf-8") + b"\0"
+    if len(names) == 0:
+        names = bytearray(b"\0")
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+    ofs = header_size + entry_size * len(files) + len(names)
+
+    entries = bytearray()
+    blobs = []
+    for (name, path), n_ofs in zip(files, name_ofs):
+        with open(path, "rb") as f:
+            data = f.read()
+
+        compression = COMPRESSION_NONE
+        stored = data
+        ext = os.path.splitext(name)[1].lower()
+        if compress and ext not in no_compress_ext and len(data) > 64:
+            c = lz4_compress(data)
+            # Keep it uncompressed if it's not worth it. Uncompressed files can be mapped without copying.
+            if len(c) < len(data) * 0.9:
+                compression = COMPRESSION_LZ4
+                stored = c
+
+        pad = (-ofs) % align
+        ofs += pad
+        entries += struct.pack(ENTRY_FORMAT, n_ofs, ofs, len(stored), len(data), compression)
+        blobs.append((pad, stored))
+        ofs += len(stored)
+
+        print("%-40s %8d -> %8d %s" % (name, len(data), len(stored), "lz4" if compression else ""))
+
+    if ofs > 0xFFFFFFFF:
+        sys.exit("The archive is too large")
+
+    with open(output, "wb") as out:
+        out.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, align, len(files), len(names)))
+        out.write(entries)
+        out.write(names)
+        for pad, stored in blobs:
+            out.write(b"\0" * pad)
+            out.write(stored)
+
+    print("%d files, %d bytes written to %s" % (len(files), ofs, output))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack a directory into an archive for LV_USE_FS_ARCHIVE")
+    parser.add_argument("dir", help="directory to pack")
+    parser.add_argument("-o", "--output", required=True, help="path of the archive")
+    parser.add_argument("--align", type=int, default=4,
+                        help="alignment of the files in the archive in bytes (default: 4)")
+    parser.add_argument("--compress", action="store_true",
+                        help="compress the files with LZ4 if it makes them at least 10%% smaller")
+    parser.add_argument("--no-compress-ext", default=DEFAULT_NO_COMPRESS_EXT,
+                        help="comma separated extensions which are not compressed (default: %(default)s)")
+    args = parser.parse_args()
+
+    if args.align < 1 or args.align > 0xFFFF:
+        sys.exit("Invalid alignment")
+
+    no_compress_ext = [e.strip().lower() for e in args.no_compress_ext.split(",") if e.strip()]
+    pack(args.dir, args.output, args.align, args.compress, no_compress_ext)
+
+
+if __name__ == "__main__":
+    main()
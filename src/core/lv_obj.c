@@ -309,6 +309,7 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    _lv_obj_style_cache_free(obj);
 
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
@@ -661,6 +662,8 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
 
     obj->state = new_state;
 
+    /*The children might inherit different values in the new state*/
+    _lv_obj_style_cache_invalidate(obj, LV_STYLE_PROP_ANY);
 
     _lv_obj_style_transition_dsc_t * ts = lv_malloc(sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     lv_memzero(ts, sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
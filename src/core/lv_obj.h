@@ -176,6 +176,9 @@ typedef struct _lv_obj_t {
     struct _lv_obj_t * parent;
     _lv_obj_spec_attr_t * spec_attr;
     _lv_obj_style_t * styles;
+#if LV_OBJ_STYLE_CACHE_SIZE
+    struct _lv_obj_style_cache_t * style_cache; /**< The resolved style properties. Allocated on first use.*/
+#endif
     void * user_data;
     lv_area_t coords;
     lv_obj_flag_t flags;
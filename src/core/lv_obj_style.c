@@ -18,6 +18,10 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if LV_OBJ_STYLE_CACHE_SIZE && (LV_OBJ_STYLE_CACHE_SIZE & (LV_OBJ_STYLE_CACHE_SIZE - 1))
+    #error "LV_OBJ_STYLE_CACHE_SIZE must be a power of 2"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -38,6 +42,21 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 } cache_t;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+typedef struct {
+    lv_style_value_t value;
+    lv_style_prop_t prop;       /*`LV_STYLE_PROP_INV` if the entry is empty*/
+    uint8_t part;               /*The part shifted down to 0..255*/
+} style_cache_entry_t;
+
+/*The resolved style properties of an object. Direct mapped: a property of a part can be only in one entry.*/
+typedef struct _lv_obj_style_cache_t {
+    uint32_t gen;               /*`style_cache_gen` when the entries were added*/
+    lv_state_t state;           /*The state of the object when the entries were added*/
+    style_cache_entry_t entries[LV_OBJ_STYLE_CACHE_SIZE];
+} _lv_obj_style_cache_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -48,6 +67,10 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#if LV_OBJ_STYLE_CACHE_SIZE
+static style_cache_entry_t * get_cache_entry(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -62,6 +85,9 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+#if LV_OBJ_STYLE_CACHE_SIZE
+static uint32_t style_cache_gen;    /*Incremented to drop the cached style properties of all objects*/
+#endif
 
 /**********************
  *      MACROS
@@ -218,6 +244,11 @@ void lv_obj_remove_style_all(struct _lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*The style can be used by any object*/
+    style_cache_gen++;
+#endif
+
     if(!style_refr) return;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
@@ -234,6 +265,9 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The styles have changed even if they are not refreshed now*/
+    _lv_obj_style_cache_invalidate(obj, prop);
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -288,49 +322,19 @@ void lv_obj_enable_style_refresh(bool en)
 
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
-    lv_style_value_t value_act = { .ptr = NULL };
-    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
-    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) break;
-        if(!inheritable) break;
-
-        /*If not found, check the `MAIN` style first*/
-        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
-        }
-
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
-    }
-
-    if(found != LV_STYLE_RES_FOUND) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
-
-            if(cls) {
-                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
-            }
-            else {
-                value_act.num = 0;
-            }
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
-        }
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_entry_t * entry = get_cache_entry(obj, part, prop);
+    if(entry == NULL) return resolve_prop(obj, part, prop);
+
+    if(entry->prop != prop || entry->part != (uint8_t)(part >> 16)) {
+        entry->value = resolve_prop(obj, part, prop);
+        entry->prop = prop;
+        entry->part = (uint8_t)(part >> 16);
     }
-    return value_act;
+    return entry->value;
+#else
+    return resolve_prop(obj, part, prop);
+#endif
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
@@ -409,6 +413,7 @@ void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t
 
     _lv_obj_style_t * style_trans = get_trans_style(obj, part);
     lv_style_set_prop((lv_style_t *)style_trans->style, tr_dsc->prop, v1);  /*Be sure `trans_style` has a valid value*/
+    _lv_obj_style_cache_invalidate(obj, tr_dsc->prop);
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
         if(v1.num == LV_RADIUS_CIRCLE || v2.num == LV_RADIUS_CIRCLE) {
@@ -517,6 +522,46 @@ _lv_style_state_cmp_t _lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t sta
     return res;
 }
 
+void _lv_obj_style_cache_invalidate(lv_obj_t * obj, lv_style_prop_t prop)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_t * cache = obj->style_cache;
+    if(cache) {
+        if(prop == LV_STYLE_PROP_ANY) {
+            lv_memzero(cache->entries, sizeof(cache->entries));
+        }
+        else {
+            uint32_t i;
+            for(i = 0; i < LV_OBJ_STYLE_CACHE_SIZE; i++) {
+                if(cache->entries[i].prop == prop) cache->entries[i].prop = LV_STYLE_PROP_INV;
+            }
+        }
+    }
+
+    /*The children might have inherited the values*/
+    if(prop == LV_STYLE_PROP_ANY || lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE)) {
+        uint32_t i;
+        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+        for(i = 0; i < child_cnt; i++) {
+            _lv_obj_style_cache_invalidate(obj->spec_attr->children[i], prop);
+        }
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(prop);
+#endif
+}
+
+void _lv_obj_style_cache_free(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_free(obj->style_cache);
+    obj->style_cache = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 void lv_obj_fade_in(lv_obj_t * obj, uint32_t time, uint32_t delay)
 {
     lv_anim_t a;
@@ -706,6 +751,91 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_sty
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Get the value of a style property from the styles of an object and its parents, or the default value
+ * @param obj       pointer to an object
+ * @param part      a part of the object
+ * @param prop      a style property
+ * @return          the value of the property
+ */
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act = { .ptr = NULL };
+    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
+    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) break;
+        if(!inheritable) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(found != LV_STYLE_RES_FOUND) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            if(cls) {
+                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+            }
+            else {
+                value_act.num = 0;
+            }
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    return value_act;
+}
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Get the entry of the cache where a style property of an object's part is or should be stored
+ * @return the entry or NULL if the cache can't be used
+ */
+static style_cache_entry_t * get_cache_entry(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    /*The transitions read the properties of other states*/
+    if(obj->skip_trans) return NULL;
+
+    lv_obj_t * obj_mut = (lv_obj_t *)obj;
+    _lv_obj_style_cache_t * cache = obj_mut->style_cache;
+    if(cache == NULL) {
+        cache = lv_malloc(sizeof(_lv_obj_style_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        obj_mut->style_cache = cache;
+        cache->gen = style_cache_gen - 1;
+    }
+
+    if(cache->gen != style_cache_gen || cache->state != obj->state) {
+        lv_memzero(cache->entries, sizeof(cache->entries));
+        cache->gen = style_cache_gen;
+        cache->state = obj->state;
+    }
+
+    uint32_t idx = (prop + (part >> 16) * 7) & (LV_OBJ_STYLE_CACHE_SIZE - 1);
+    return &cache->entries[idx];
+}
+#endif
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -776,6 +906,7 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
                     lv_style_remove_prop((lv_style_t *)obj->styles[i].style, tr->prop);
                 }
             }
+            _lv_obj_style_cache_invalidate(obj, tr->prop);
 
             /*Free the transition descriptor too*/
             lv_anim_del(tr, NULL);
@@ -872,6 +1003,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     lv_style_set_prop((lv_style_t *)style_trans->style, tr->prop,
                       tr->start_value);  /*Be sure `trans_style` has a valid value*/
+    _lv_obj_style_cache_invalidate(tr->obj, tr->prop);
 
 }
 
@@ -902,6 +1034,7 @@ static void trans_anim_ready_cb(lv_anim_t * a)
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                _lv_obj_style_cache_invalidate(obj, prop);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
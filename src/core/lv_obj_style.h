@@ -200,6 +200,21 @@ void _lv_obj_style_create_transition(struct _lv_obj_t * obj, lv_part_t part, lv_
  */
 _lv_style_state_cmp_t _lv_obj_style_state_compare(struct _lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+/**
+ * Used internally to drop the cached values of a style property if the styles of an object change
+ * without `lv_obj_refresh_style()` being called. The values of the children are dropped too if
+ * the property is inherited. Does nothing if `LV_OBJ_STYLE_CACHE_SIZE == 0`.
+ * @param obj       pointer to an object
+ * @param prop      a style property or `LV_STYLE_PROP_ANY` to drop all values
+ */
+void _lv_obj_style_cache_invalidate(struct _lv_obj_t * obj, lv_style_prop_t prop);
+
+/**
+ * Used internally to free the cached style properties of an object when it's deleted
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_free(struct _lv_obj_t * obj);
+
 /**
  * Fade in an an object and all its children.
  * @param obj       the object to fade in
@@ -175,6 +175,9 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+    /*The inherited style properties come from the new parent*/
+    _lv_obj_style_cache_invalidate(obj, LV_STYLE_PROP_ANY);
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_readjust_scroll(old_parent, LV_ANIM_OFF);
     lv_obj_scrollbar_invalidate(old_parent);
@@ -250,6 +253,12 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+    if(parent != parent2) {
+        /*The inherited style properties come from the new parents*/
+        _lv_obj_style_cache_invalidate(obj1, LV_STYLE_PROP_ANY);
+        _lv_obj_style_cache_invalidate(obj2, LV_STYLE_PROP_ANY);
+    }
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
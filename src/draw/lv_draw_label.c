@@ -30,6 +30,10 @@
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_letter_cb_t cb);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                             uint32_t line_start, int32_t w);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -140,10 +144,20 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
+    /*Use the stored line breaks only if they were created for this text*/
+    const lv_txt_layout_t * layout = dsc->layout;
+    if(layout && !lv_txt_layout_is_valid(layout, dsc->text, font, dsc->letter_space, dsc->line_space,
+                                         lv_area_get_width(coords), dsc->flag)) {
+        layout = NULL;
+    }
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(layout) {
+        w = layout->size.x;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -168,38 +182,50 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
+    /*The hint is not required if the lines are already known*/
+    lv_draw_label_hint_t * hint = layout ? NULL : dsc->hint;
+
     /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    if(hint && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
-        if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
-            dsc->hint->line_start = -1;
+        if(LV_ABS(hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
+            hint->line_start = -1;
         }
-        last_line_start = dsc->hint->line_start;
+        last_line_start = hint->line_start;
     }
 
     /*Use the hint if it's valid*/
-    if(dsc->hint && last_line_start >= 0) {
+    if(hint && last_line_start >= 0) {
         line_start = last_line_start;
-        pos.y += dsc->hint->y;
+        pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                           dsc->flag);
+    /*With the stored lines jump to the first visible line directly*/
+    if(layout && line_height > 0 && pos.y + line_height_font < draw_unit->clip_area->y1) {
+        line_idx = lv_txt_layout_get_line_at_y(layout, draw_unit->clip_area->y1 - pos.y);
+        if(line_idx >= layout->line_cnt) return;
+        line_start = layout->lines[line_idx].start;
+        pos.y += lv_txt_layout_get_line_y(layout, line_idx);
+    }
+
+    uint32_t line_end = get_line_end(dsc, layout, line_idx, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_unit->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, layout, line_idx, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
-        if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
-            dsc->hint->line_start = line_start;
-            dsc->hint->y          = pos.y - coords->y1;
-            dsc->hint->coord_y    = coords->y1;
+        if(hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && hint->line_start < 0) {
+            hint->line_start = line_start;
+            hint->y          = pos.y - coords->y1;
+            hint->coord_y    = coords->y1;
         }
 
         if(dsc->text[line_start] == '\0') return;
@@ -207,14 +233,14 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -249,9 +275,17 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
         /*Write all letter of a line*/
         i = 0;
 #if LV_USE_BIDI
-        char * bidi_txt = lv_malloc(line_end - line_start + 1);
-        LV_ASSERT_MALLOC(bidi_txt);
-        _lv_bidi_process_paragraph(dsc->text + line_start, bidi_txt, line_end - line_start, base_dir, NULL, 0);
+        /*Use the lines stored in visual order if they were created with this direction*/
+        char * bidi_txt;
+        bool bidi_txt_stored = layout && layout->bidi_text && layout->bidi_dir == base_dir;
+        if(bidi_txt_stored) {
+            bidi_txt = &layout->bidi_text[line_start + line_idx];
+        }
+        else {
+            bidi_txt = lv_malloc(line_end - line_start + 1);
+            LV_ASSERT_MALLOC(bidi_txt);
+            _lv_bidi_process_paragraph(dsc->text + line_start, bidi_txt, line_end - line_start, base_dir, NULL, 0);
+        }
 #else
         const char * bidi_txt = dsc->text + line_start;
 #endif
@@ -320,25 +354,24 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
         }
 
 #if LV_USE_BIDI
-        lv_free(bidi_txt);
+        if(!bidi_txt_stored) lv_free(bidi_txt);
         bidi_txt = NULL;
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, layout, line_idx, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -410,3 +443,25 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     LV_PROFILER_END;
 }
 
+/**
+ * Get the end of a line from the layout, or by breaking the line if there is no layout
+ * @return byte index of the first character after the line
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                             uint32_t line_start, int32_t w)
+{
+    if(layout) return lv_txt_layout_get_line_end(layout, line_idx);
+
+    return line_start + _lv_txt_get_next_line(&dsc->text[line_start], dsc->font, dsc->letter_space, w, NULL, dsc->flag);
+}
+
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end)
+{
+    if(layout) {
+        if(line_idx < layout->line_cnt) return layout->lines[line_idx].width;
+        else return 0;
+    }
+
+    return lv_txt_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
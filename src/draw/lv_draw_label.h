@@ -70,6 +70,9 @@ typedef struct {
 uint8_t text_local  :
     1;        /**< 1: malloc buffer and copy `text` there. 0: `text` is const and it's pointer will be valid during rendering*/
     lv_draw_label_hint_t * hint;
+    /** Line breaks of `text` to use instead of breaking the lines again.
+     * Ignored if it was created with different parameters than in this descriptor.*/
+    const lv_txt_layout_t * layout;
 } lv_draw_label_dsc_t;
 
 typedef enum {
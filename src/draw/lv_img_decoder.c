@@ -25,6 +25,10 @@ typedef struct {
     lv_fs_file_t f;
     lv_color_t * palette;
     lv_opa_t * opa;
+    const void * map;       /*The whole file if the driver could map it*/
+    uint32_t map_size;
+    uint8_t * buf;          /*The data read from the file if it couldn't be mapped*/
+    void * decoded;         /*The converted pixels of indexed images*/
 } lv_img_decoder_built_in_data_t;
 
 /**********************
@@ -32,6 +36,13 @@ typedef struct {
  **********************/
 static lv_res_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, lv_coord_t y,
                                     lv_coord_t w_px, const uint8_t * in, lv_color32_t * out);
+static lv_res_t built_in_set_data(lv_img_decoder_dsc_t * dsc, lv_color_format_t cf, const uint8_t * data,
+                                  void ** decoded);
+static lv_res_t built_in_file_load(lv_img_decoder_built_in_data_t * user_data, uint32_t min_size);
+static uint32_t built_in_get_data_size(const lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id,
+                             bool need_img_data);
+static void built_in_file_close(lv_img_decoder_built_in_data_t * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -100,62 +111,12 @@ lv_res_t lv_img_decoder_get_info(const void * src, lv_img_header_t * header)
 
 lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id)
 {
-    lv_memzero(dsc, sizeof(lv_img_decoder_dsc_t));
-
-    if(src == NULL) return LV_RES_INV;
-    lv_img_src_t src_type = lv_img_src_get_type(src);
-    if(src_type == LV_IMG_SRC_VARIABLE) {
-        const lv_img_dsc_t * img_dsc = src;
-        if(img_dsc->data == NULL) return LV_RES_INV;
-    }
-
-    dsc->color    = color;
-    dsc->src_type = src_type;
-    dsc->frame_id = frame_id;
-
-    if(dsc->src_type == LV_IMG_SRC_FILE) {
-        size_t fnlen = lv_strlen(src);
-        dsc->src = lv_malloc(fnlen + 1);
-        LV_ASSERT_MALLOC(dsc->src);
-        if(dsc->src == NULL) {
-            LV_LOG_WARN("out of memory");
-            return LV_RES_INV;
-        }
-        lv_strcpy((char *)dsc->src, src);
-    }
-    else {
-        dsc->src = src;
-    }
-
-    lv_res_t res = LV_RES_INV;
-
-    lv_img_decoder_t * decoder;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), decoder) {
-        /*Info and Open callbacks are required*/
-        if(decoder->info_cb == NULL || decoder->open_cb == NULL) continue;
-
-        res = decoder->info_cb(decoder, src, &dsc->header);
-        if(res != LV_RES_OK) continue;
-
-        dsc->decoder = decoder;
-        res = decoder->open_cb(decoder, dsc);
-
-        /*Opened successfully. It is a good decoder for this image source*/
-        if(res == LV_RES_OK) return res;
-
-        /*Prepare for the next loop*/
-        lv_memzero(&dsc->header, sizeof(lv_img_header_t));
-
-        dsc->error_msg = NULL;
-        dsc->img_data  = NULL;
-        dsc->user_data = NULL;
-        dsc->time_to_open = 0;
-    }
-
-    if(dsc->src_type == LV_IMG_SRC_FILE)
-        lv_free((void *)dsc->src);
+    return decoder_open(dsc, src, color, frame_id, false);
+}
 
-    return res;
+lv_res_t lv_img_decoder_open_full(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id)
+{
+    return decoder_open(dsc, src, color, frame_id, true);
 }
 
 /**
@@ -341,77 +302,269 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
 
         lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
         lv_memcpy(&user_data->f, &f, sizeof(f));
+
+        /*The file needs to contain the whole palette and all pixels as the data is used directly*/
+        uint32_t min_size = sizeof(lv_img_header_t) + built_in_get_data_size(&dsc->header);
+        lv_res_t load_res = built_in_file_load(user_data, min_size);
+        if(load_res == LV_RES_OK) {
+            const uint8_t * data = user_data->map ? user_data->map : user_data->buf;
+            load_res = built_in_set_data(dsc, dsc->header.cf, data + sizeof(lv_img_header_t), &user_data->decoded);
+        }
+
+        if(load_res != LV_RES_OK) {
+            built_in_file_close(user_data);
+            lv_free(user_data);
+            dsc->user_data = NULL;
+            dsc->img_data = NULL;
+        }
+        return load_res;
     }
     else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         /*The variables should have valid data*/
-        if(((lv_img_dsc_t *)dsc->src)->data == NULL) {
+        lv_img_dsc_t * img_dsc = (lv_img_dsc_t *)dsc->src;
+        if(img_dsc->data == NULL) {
             return LV_RES_INV;
         }
+
+        void * decoded = NULL;
+        return built_in_set_data(dsc, img_dsc->header.cf, img_dsc->data, &decoded);
     }
 
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+    return LV_RES_INV;
+}
+
+/**
+ * Close the pending decoding. Free resources etc.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ */
+void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder); /*Unused*/
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+        if(user_data) {
+            built_in_file_close(user_data);
+            lv_free(user_data);
+            dsc->user_data = NULL;
+        }
+    }
+    else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         lv_img_dsc_t * img_dsc = (lv_img_dsc_t *)dsc->src;
         lv_color_format_t cf = img_dsc->header.cf;
         if(cf >= LV_COLOR_FORMAT_I1 && cf <= LV_COLOR_FORMAT_I8) {
-            switch(cf) {
-                case LV_COLOR_FORMAT_I1:
-                    dsc->palette_size = 2;
-                    break;
-                case LV_COLOR_FORMAT_I2:
-                    dsc->palette_size = 4;
-                    break;
-                case LV_COLOR_FORMAT_I4:
-                    dsc->palette_size = 16;
-                    break;
-                case LV_COLOR_FORMAT_I8:
-                    dsc->palette_size = 256;
-                    break;
-                default:
-                    LV_LOG_WARN("Unexpected color format");
-                    return LV_RES_INV;
-            }
+            lv_free((void *)dsc->img_data);
+        }
+    }
+    dsc->img_data = NULL;
+}
 
-            dsc->img_data = lv_malloc(sizeof(lv_color32_t) * img_dsc->header.w *  img_dsc->header.h);
-            dsc->palette = (const lv_color32_t *)img_dsc->data;
-            dsc->header.cf = LV_COLOR_FORMAT_ARGB8888;
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
 
-            uint32_t y;
-            for(y = 0; y < img_dsc->header.h; y++) {
-                decode_indexed_line(cf, dsc->palette, y, img_dsc->header.w, img_dsc->data, (lv_color32_t *) dsc->img_data);
-            }
-        }
-        else {
-            /*In case of uncompressed formats the image stored in the ROM/RAM.
-             *So simply give its pointer*/
-            dsc->img_data = ((lv_img_dsc_t *)dsc->src)->data;
+/**
+ * Find a decoder which can open the image. See `lv_img_decoder_open`.
+ * @param need_img_data     true: the decoder should provide the whole image in `img_data`, not only lines
+ */
+static lv_res_t decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id,
+                             bool need_img_data)
+{
+    lv_memzero(dsc, sizeof(lv_img_decoder_dsc_t));
+
+    if(src == NULL) return LV_RES_INV;
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = src;
+        if(img_dsc->data == NULL) return LV_RES_INV;
+    }
+
+    dsc->color    = color;
+    dsc->src_type = src_type;
+    dsc->frame_id = frame_id;
+    dsc->need_img_data = need_img_data;
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        size_t fnlen = lv_strlen(src);
+        dsc->src = lv_malloc(fnlen + 1);
+        LV_ASSERT_MALLOC(dsc->src);
+        if(dsc->src == NULL) {
+            LV_LOG_WARN("out of memory");
+            return LV_RES_INV;
         }
-        return LV_RES_OK;
+        lv_strcpy((char *)dsc->src, src);
     }
     else {
-        /*TODO indexed formats needs to be read here*/
-        /*If it's a file it need to be read line by line later*/
-        return LV_RES_OK;
+        dsc->src = src;
     }
+
+    lv_res_t res = LV_RES_INV;
+
+    lv_img_decoder_t * decoder;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), decoder) {
+        /*Info and Open callbacks are required*/
+        if(decoder->info_cb == NULL || decoder->open_cb == NULL) continue;
+
+        res = decoder->info_cb(decoder, src, &dsc->header);
+        if(res != LV_RES_OK) continue;
+
+        dsc->decoder = decoder;
+        res = decoder->open_cb(decoder, dsc);
+
+        /*Opened successfully. It is a good decoder for this image source*/
+        if(res == LV_RES_OK) return res;
+
+        /*Prepare for the next loop*/
+        lv_memzero(&dsc->header, sizeof(lv_img_header_t));
+
+        dsc->error_msg = NULL;
+        dsc->img_data  = NULL;
+        dsc->user_data = NULL;
+        dsc->time_to_open = 0;
+    }
+
+    if(dsc->src_type == LV_IMG_SRC_FILE)
+        lv_free((void *)dsc->src);
+
+    return res;
 }
 
 /**
- * Close the pending decoding. Free resources etc.
- * @param decoder pointer to the decoder the function associated with
+ * Set the pixels of an opened image. Indexed images are converted to ARGB8888,
+ * other formats are used directly from `data`.
  * @param dsc pointer to decoder descriptor
+ * @param cf the color format of `data`
+ * @param data the palette and pixels of the image
+ * @param decoded store the allocated buffer here if the pixels were converted
+ * @return LV_RES_OK: `dsc->img_data` is set; LV_RES_INV: unknown format or out of memory
  */
-void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+static lv_res_t built_in_set_data(lv_img_decoder_dsc_t * dsc, lv_color_format_t cf, const uint8_t * data,
+                                  void ** decoded)
 {
-    LV_UNUSED(decoder); /*Unused*/
-    lv_img_dsc_t * img_dsc = (lv_img_dsc_t *)dsc->src;
-    lv_color_format_t cf = img_dsc->header.cf;
     if(cf >= LV_COLOR_FORMAT_I1 && cf <= LV_COLOR_FORMAT_I8) {
-        lv_free((void *)dsc->img_data);
+        switch(cf) {
+            case LV_COLOR_FORMAT_I1:
+                dsc->palette_size = 2;
+                break;
+            case LV_COLOR_FORMAT_I2:
+                dsc->palette_size = 4;
+                break;
+            case LV_COLOR_FORMAT_I4:
+                dsc->palette_size = 16;
+                break;
+            case LV_COLOR_FORMAT_I8:
+                dsc->palette_size = 256;
+                break;
+            default:
+                LV_LOG_WARN("Unexpected color format");
+                return LV_RES_INV;
+        }
+
+        lv_color32_t * out = lv_malloc(sizeof(lv_color32_t) * dsc->header.w *  dsc->header.h);
+        LV_ASSERT_MALLOC(out);
+        if(out == NULL) {
+            LV_LOG_WARN("out of memory");
+            return LV_RES_INV;
+        }
+
+        dsc->palette = (const lv_color32_t *)data;
+        dsc->header.cf = LV_COLOR_FORMAT_ARGB8888;
+
+        uint32_t y;
+        for(y = 0; y < dsc->header.h; y++) {
+            decode_indexed_line(cf, dsc->palette, y, dsc->header.w, data, out);
+        }
+        dsc->img_data = (const uint8_t *)out;
+        *decoded = out;
     }
+    else {
+        /*In case of uncompressed formats the image stored in the ROM/RAM (or mapped file).
+         *So simply give its pointer*/
+        dsc->img_data = data;
+    }
+
+    return LV_RES_OK;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Make the whole content of an opened file available in the memory.
+ * Map it if the driver supports it, else read it into a buffer.
+ * @param user_data the decoder's data with the opened file
+ * @param min_size the size of the header, the palette and the pixels. Smaller files are invalid.
+ * @return LV_RES_OK: `map` or `buf` is set; LV_RES_INV: error
+ */
+static lv_res_t built_in_file_load(lv_img_decoder_built_in_data_t * user_data, uint32_t min_size)
+{
+    lv_fs_file_t * f = &user_data->f;
+    if(lv_fs_map(f, &user_data->map, &user_data->map_size) == LV_FS_RES_OK) {
+        if(user_data->map_size >= min_size) return LV_RES_OK;
+        LV_LOG_WARN("Built-in image decoder: the file is too small");
+        return LV_RES_INV;
+    }
+
+    uint32_t size;
+    if(lv_fs_seek(f, 0, LV_FS_SEEK_END) != LV_FS_RES_OK ||
+       lv_fs_tell(f, &size) != LV_FS_RES_OK ||
+       lv_fs_seek(f, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        LV_LOG_WARN("Built-in image decoder can't get the file's size");
+        return LV_RES_INV;
+    }
+
+    if(size < min_size) {
+        LV_LOG_WARN("Built-in image decoder: the file is too small");
+        return LV_RES_INV;
+    }
+
+    user_data->buf = lv_malloc(size);
+    LV_ASSERT_MALLOC(user_data->buf);
+    if(user_data->buf == NULL) {
+        LV_LOG_WARN("out of memory");
+        return LV_RES_INV;
+    }
+
+    uint32_t br;
+    if(lv_fs_read(f, user_data->buf, size, &br) != LV_FS_RES_OK || br != size) {
+        LV_LOG_WARN("Built-in image decoder can't read the file");
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Get the size of the palette and the pixels of an image in the built-in format
+ * @param header the header of the image
+ * @return the size of the data after the header in bytes
+ */
+static uint32_t built_in_get_data_size(const lv_img_header_t * header)
+{
+    uint32_t w = header->w;
+    uint32_t h = header->h;
+    switch(header->cf) {
+        case LV_COLOR_FORMAT_I1:
+            return 2 * sizeof(lv_color32_t) + ((w + 7) >> 3) * h;
+        case LV_COLOR_FORMAT_I2:
+            return 4 * sizeof(lv_color32_t) + ((w + 3) >> 2) * h;
+        case LV_COLOR_FORMAT_I4:
+            return 16 * sizeof(lv_color32_t) + ((w + 1) >> 1) * h;
+        case LV_COLOR_FORMAT_I8:
+            return 256 * sizeof(lv_color32_t) + w * h;
+        default:
+            return w * h * lv_color_format_get_size(header->cf);
+    }
+}
+
+static void built_in_file_close(lv_img_decoder_built_in_data_t * user_data)
+{
+    if(user_data->decoded) lv_free(user_data->decoded);
+    if(user_data->buf) lv_free(user_data->buf);
+    if(user_data->map) lv_fs_unmap(&user_data->f, user_data->map, user_data->map_size);
+    lv_fs_close(&user_data->f);
+
+    user_data->decoded = NULL;
+    user_data->buf = NULL;
+    user_data->map = NULL;
+}
 
 static lv_res_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, lv_coord_t y,
                                     lv_coord_t w_px, const uint8_t * in, lv_color32_t * out)
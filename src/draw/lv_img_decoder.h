@@ -133,6 +133,10 @@ typedef struct _lv_img_decoder_dsc_t {
 
     /**Store any custom data here is required*/
     void * user_data;
+
+    /**1: the whole decoded image is required in `img_data`, so the decoder shouldn't provide it only line by line.
+     * Set by `lv_img_decoder_open_full`*/
+    uint8_t need_img_data : 1;
 } lv_img_decoder_dsc_t;
 
 /**********************
@@ -171,6 +175,18 @@ lv_res_t lv_img_decoder_get_info(const void * src, lv_img_header_t * header);
  */
 lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Open an image like `lv_img_decoder_open` but ask the decoder to provide the whole decoded image in `dsc->img_data`
+ * even if it could decode it only line by line (e.g. because the image needs to be transformed).
+ * @param dsc describes a decoding session. Simply a pointer to an `lv_img_decoder_dsc_t` variable.
+ * @param src the image source
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @return LV_RES_OK: opened the image. `dsc->header` is set, `dsc->img_data` is set if the decoder supports it.
+ *         LV_RES_INV: none of the registered image decoders were able to open the image.
+ */
+lv_res_t lv_img_decoder_open_full(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id);
+
 /**
  * Read a line from an opened image
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -169,7 +169,31 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_img(lv_draw_unit_t * draw_unit, const lv_d
     bool transformed = draw_dsc->angle != 0 || draw_dsc->zoom != LV_ZOOM_NONE ? true : false;
 
     lv_img_decoder_dsc_t decoder_dsc;
-    lv_img_decoder_open(&decoder_dsc, draw_dsc->src, draw_dsc->recolor, -1);
+    lv_res_t res = lv_img_decoder_open(&decoder_dsc, draw_dsc->src, draw_dsc->recolor, -1);
+    if(res != LV_RES_OK) {
+        LV_LOG_WARN("Couldn't open the image");
+        return;
+    }
+
+    /*If the decoder provides only lines (`img_data == NULL`) they are read into a temporary buffer below.
+     *It works only if the image is not transformed, else ask the decoder to decode the whole image.*/
+    if(decoder_dsc.img_data == NULL &&
+       (decoder_dsc.decoder->read_line_cb == NULL || transformed ||
+        decoder_dsc.header.cf == LV_COLOR_FORMAT_RGB565A8)) {
+        lv_img_decoder_close(&decoder_dsc);
+        res = lv_img_decoder_open_full(&decoder_dsc, draw_dsc->src, draw_dsc->recolor, -1);
+        if(res != LV_RES_OK) {
+            LV_LOG_WARN("Couldn't open the image");
+            return;
+        }
+
+        if(decoder_dsc.img_data == NULL) {
+            LV_LOG_WARN("Can't draw the image without its decoded pixel data");
+            lv_img_decoder_close(&decoder_dsc);
+            return;
+        }
+    }
+
     const uint8_t * src_buf = decoder_dsc.img_data;
 
     lv_color_format_t cf = decoder_dsc.header.cf;
@@ -182,7 +206,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_img(lv_draw_unit_t * draw_unit, const lv_d
     blend_dsc.blend_mode = draw_dsc->blend_mode;
 
 
-    if(!transformed && cf == LV_COLOR_FORMAT_A8) {
+    if(!transformed && src_buf && cf == LV_COLOR_FORMAT_A8) {
         lv_area_t clipped_coords;
         if(!_lv_area_intersect(&clipped_coords, coords, draw_unit->clip_area)) return;
 
@@ -195,7 +219,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_img(lv_draw_unit_t * draw_unit, const lv_d
         blend_dsc.blend_area = coords;
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
-    else if(!transformed && cf == LV_COLOR_FORMAT_RGB565A8 && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
+    else if(!transformed && src_buf && cf == LV_COLOR_FORMAT_RGB565A8 && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
         lv_coord_t src_w = lv_area_get_width(coords);
         lv_coord_t src_h = lv_area_get_height(coords);
         blend_dsc.src_area = coords;
@@ -209,7 +233,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_img(lv_draw_unit_t * draw_unit, const lv_d
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
     /*The simplest case just copy the pixels into the draw_buf. Blending will convert the colors if needed*/
-    else if(!transformed && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
+    else if(!transformed && src_buf && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
         blend_dsc.src_area = coords;
         blend_dsc.src_buf = src_buf;
         blend_dsc.blend_area = coords;
@@ -274,7 +298,16 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_img(lv_draw_unit_t * draw_unit, const lv_d
             lv_area_t relative_area;
             lv_area_copy(&relative_area, &blend_area);
             lv_area_move(&relative_area, -coords->x1, -coords->y1);
-            if(transformed) {
+            if(src_buf == NULL) {
+                /*Read the lines one-by-one from the decoder*/
+                uint8_t * dest_buf_tmp = tmp_buf;
+                lv_coord_t y;
+                for(y = relative_area.y1; y <= relative_area.y2; y++) {
+                    lv_img_decoder_read_line(&decoder_dsc, relative_area.x1, y, blend_w, dest_buf_tmp);
+                    dest_buf_tmp += blend_w * px_size;
+                }
+            }
+            else if(transformed) {
                 lv_draw_sw_transform(draw_unit, &relative_area, src_buf, src_w, src_h, src_w,
                                      draw_dsc, &sup, cf, tmp_buf);
             }
@@ -119,6 +119,12 @@ uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32
     return g.adv_w;
 }
 
+void lv_font_set_kerning(lv_font_t * font, lv_font_kerning_t kerning)
+{
+    LV_ASSERT_NULL(font);
+    font->kerning = kerning;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -14,10 +14,41 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    #define BITMAP_CACHE_BUCKET_CNT     64      /*Must be power of 2*/
+    /*Larger bitmaps are not cached to not evict many small ones*/
+    #define BITMAP_CACHE_MAX_SIZE       (LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE / 4)
+
+    #if LV_USE_OS
+        #define BITMAP_CACHE_LOCK()     lv_mutex_lock(&bitmap_cache.lock)
+        #define BITMAP_CACHE_UNLOCK()   lv_mutex_unlock(&bitmap_cache.lock)
+    #else
+        #define BITMAP_CACHE_LOCK()
+        #define BITMAP_CACHE_UNLOCK()
+    #endif
+#endif
+
+#define FONT_LOOKUP     (LV_USE_FONT_GLYPH_ID_LOOKUP || LV_USE_FONT_KERN_LOOKUP)
+
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+    #define GID_PAGE_SIZE               256     /*Letters in a page of the glyph ID lookup table*/
+#endif
+
+#if FONT_LOOKUP
+    #if LV_USE_OS
+        #define LOOKUP_LOCK()     lv_mutex_lock(&lookup_lock)
+        #define LOOKUP_UNLOCK()   lv_mutex_unlock(&lookup_lock)
+    #else
+        #define LOOKUP_LOCK()
+        #define LOOKUP_UNLOCK()
+    #endif
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -28,10 +59,43 @@ typedef enum {
     RLE_STATE_COUNTER,
 } rle_state_t;
 
+/*State of the RLE decompression. Stored on the stack so that glyphs can be decompressed in parallel*/
+typedef struct {
+    uint32_t rdp;
+    const uint8_t * in;
+    uint8_t bpp;
+    uint8_t prev_v;
+    uint8_t cnt;
+    rle_state_t state;
+} rle_t;
+
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+typedef struct _bitmap_cache_entry_t {
+    struct _bitmap_cache_entry_t * hash_next;
+    struct _bitmap_cache_entry_t * lru_prev;
+    struct _bitmap_cache_entry_t * lru_next;
+    const void * fdsc;
+    uint32_t gid;
+    uint32_t size;
+    /*The A8 bitmap follows the entry*/
+} bitmap_cache_entry_t;
+
+typedef struct {
+    bitmap_cache_entry_t * buckets[BITMAP_CACHE_BUCKET_CNT];
+    bitmap_cache_entry_t * lru_head;    /*Most recently used*/
+    bitmap_cache_entry_t * lru_tail;    /*Least recently used*/
+    lv_font_fmt_txt_bitmap_cache_stats_t stats;
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} bitmap_cache_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
@@ -39,23 +103,53 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp, bool prefilter);
-    static inline void decompress_line(uint8_t * out, lv_coord_t w);
+    static inline void decompress_line(rle_t * rle, uint8_t * out, lv_coord_t w);
     static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len);
-    static inline void rle_init(const uint8_t * in,  uint8_t bpp);
-    static inline uint8_t rle_next(void);
+    static inline void rle_init(rle_t * rle, const uint8_t * in,  uint8_t bpp);
+    static inline uint8_t rle_next(rle_t * rle);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    static bool bitmap_cache_get(const void * fdsc, uint32_t gid, uint8_t * bitmap_out, uint32_t size);
+    static void bitmap_cache_add(const void * fdsc, uint32_t gid, const uint8_t * bitmap, uint32_t size);
+    static void bitmap_cache_remove(bitmap_cache_entry_t * e);
+#endif
+
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+    static uint32_t lookup_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+    static const uint16_t ** glyph_lookup_create(const lv_font_fmt_txt_dsc_t * fdsc);
+    static const uint16_t * glyph_lookup_fill_page(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t page_id);
+#endif
+
+#if LV_USE_FONT_KERN_LOOKUP
+    static bool lookup_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right,
+                                  int8_t * value);
+    static bool kern_lookup_create(const lv_font_fmt_txt_dsc_t * fdsc);
+    static inline uint32_t kern_lookup_hash(uint32_t key, uint32_t mask);
+#endif
+
+#if FONT_LOOKUP
+    static void lookup_register(lv_font_fmt_txt_glyph_cache_t * cache);
+    static void lookup_free(lv_font_fmt_txt_glyph_cache_t * cache);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
-#if LV_USE_FONT_COMPRESSED
-    static uint32_t rle_rdp;
-    static const uint8_t * rle_in;
-    static uint8_t rle_bpp;
-    static uint8_t rle_prev_v;
-    static uint8_t rle_cnt;
-    static rle_state_t rle_state;
-#endif /*LV_USE_FONT_COMPRESSED*/
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    static bitmap_cache_t bitmap_cache;
+#endif
+
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+    static const uint16_t glyph_lookup_empty_page[1];  /*Marks the pages without glyphs*/
+#endif
+
+#if FONT_LOOKUP
+    static lv_font_fmt_txt_glyph_cache_t * lookup_head;  /*Caches with allocated lookup tables*/
+    #if LV_USE_OS
+        static lv_mutex_t lookup_lock;
+    #endif
+#endif
 
 static const uint8_t opa4_table[16] = {0,  17, 34,  51,
                                        68, 85, 102, 119,
@@ -96,8 +190,23 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    if(bitmap_cache_get(fdsc, gid, bitmap_out, gsize)) return bitmap_out;
+#endif
+
+    /*The bitmaps of the lazy loaded fonts are read only when they are needed*/
+    uint8_t * bitmap_read = NULL;
+    const uint8_t * bitmap_in;
+    if(fdsc->read_glyph_bitmap_cb) {
+        bitmap_read = fdsc->read_glyph_bitmap_cb(fdsc, gid);
+        if(bitmap_read == NULL) return NULL;
+        bitmap_in = bitmap_read;
+    }
+    else {
+        bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    }
+
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
         int32_t i;
         if(fdsc->bpp == 1) {
             int32_t gsize_floor = gsize & ~(0x7);
@@ -151,23 +260,27 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
                 bitmap_out[gsize - 1] = opa4_table[(*bitmap_in) >> 4];
             }
         }
-        return bitmap_out;
     }
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
+        decompress(bitmap_in, bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return bitmap_out;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        lv_free(bitmap_read);
         return NULL;
 #endif
     }
 
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
+    lv_free(bitmap_read);
+
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    bitmap_cache_add(fdsc, gid, bitmap_out, gsize);
+#endif
+
+    return bitmap_out;
 }
 
 /**
@@ -192,7 +305,7 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     if(!gid) return false;
 
     int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
+    if(fdsc->kern_dsc && font->kerning == LV_FONT_KERNING_NORMAL) {
         uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
         if(gid_next) {
             kvalue = get_kern_value(font, gid, gid_next);
@@ -223,6 +336,100 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+void _lv_font_fmt_txt_init(void)
+{
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    lv_memzero(&bitmap_cache, sizeof(bitmap_cache));
+#if LV_USE_OS
+    lv_mutex_init(&bitmap_cache.lock);
+#endif
+#endif
+
+#if FONT_LOOKUP
+    lookup_head = NULL;
+#if LV_USE_OS
+    lv_mutex_init(&lookup_lock);
+#endif
+#endif
+}
+
+void _lv_font_clean_up_fmt_txt(void)
+{
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    lv_font_fmt_txt_bitmap_cache_drop(NULL);
+#endif
+
+#if FONT_LOOKUP
+    LOOKUP_LOCK();
+    while(lookup_head) {
+        lv_font_fmt_txt_glyph_cache_t * next = lookup_head->next;
+        lookup_free(lookup_head);
+        lookup_head = next;
+    }
+    LOOKUP_UNLOCK();
+#endif
+
+#if LV_USE_OS
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    lv_mutex_delete(&bitmap_cache.lock);
+#endif
+#if FONT_LOOKUP
+    lv_mutex_delete(&lookup_lock);
+#endif
+#endif
+}
+
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+void lv_font_fmt_txt_bitmap_cache_drop(const lv_font_t * font)
+{
+    BITMAP_CACHE_LOCK();
+    bitmap_cache_entry_t * e = bitmap_cache.lru_head;
+    while(e) {
+        bitmap_cache_entry_t * next = e->lru_next;
+        if(font == NULL || e->fdsc == font->dsc) bitmap_cache_remove(e);
+        e = next;
+    }
+    BITMAP_CACHE_UNLOCK();
+}
+
+void lv_font_fmt_txt_bitmap_cache_get_stats(lv_font_fmt_txt_bitmap_cache_stats_t * stats)
+{
+    BITMAP_CACHE_LOCK();
+    *stats = bitmap_cache.stats;
+    BITMAP_CACHE_UNLOCK();
+}
+
+void lv_font_fmt_txt_bitmap_cache_reset_stats(void)
+{
+    BITMAP_CACHE_LOCK();
+    uint32_t used_size = bitmap_cache.stats.used_size;
+    lv_memzero(&bitmap_cache.stats, sizeof(bitmap_cache.stats));
+    bitmap_cache.stats.used_size = used_size;
+    BITMAP_CACHE_UNLOCK();
+}
+#endif
+
+#if FONT_LOOKUP
+void lv_font_fmt_txt_lookup_drop(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    if(cache == NULL) return;
+
+    LOOKUP_LOCK();
+    lv_font_fmt_txt_glyph_cache_t ** p = &lookup_head;
+    while(*p) {
+        if(*p == cache) {
+            *p = cache->next;
+            lookup_free(cache);
+            break;
+        }
+        p = &(*p)->next;
+    }
+    LOOKUP_UNLOCK();
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -231,11 +438,23 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
 
-    /*Check the cache first*/
-    //    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+    if(fdsc->cache) return lookup_glyph_id(fdsc, letter);
+#endif
 
+    return find_glyph_id(fdsc, letter);
+}
+
+/**
+ * Search the glyph ID of a letter in the cmaps of the font
+ * @param fdsc      pointer to the font's descriptor
+ * @param letter    a UNICODE letter
+ * @return          the glyph ID or 0 if the letter is not in the font
+ */
+static uint32_t find_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -272,20 +491,10 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             }
         }
 
-        /*Update the cache*/
-        //        if(fdsc->cache) {
-        //            fdsc->cache->last_letter = letter;
-        //            fdsc->cache->last_glyph_id = glyph_id;
-        //        }
         return glyph_id;
     }
 
-    //    if(fdsc->cache) {
-    //        fdsc->cache->last_letter = letter;
-    //        fdsc->cache->last_glyph_id = 0;
-    //    }
     return 0;
-
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
@@ -295,6 +504,10 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
+#if LV_USE_FONT_KERN_LOOKUP
+        if(fdsc->cache && lookup_kern_value(fdsc, gid_left, gid_right, &value)) return value;
+#endif
+
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
         if(kdsc->glyph_ids_size == 0) {
@@ -365,6 +578,427 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element)
     else return (int32_t) ref16_p[1] - element16_p[1];
 }
 
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+static inline uint32_t bitmap_cache_hash(const void * fdsc, uint32_t gid)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)fdsc >> 4) ^ (gid * 2654435761U);
+    return (h ^ (h >> 16)) & (BITMAP_CACHE_BUCKET_CNT - 1);
+}
+
+/**
+ * Copy the cached bitmap of a glyph to `bitmap_out`.
+ * The bitmap is copied to not be freed while it's drawn by an other draw unit.
+ * @return true: the bitmap was found
+ */
+static bool bitmap_cache_get(const void * fdsc, uint32_t gid, uint8_t * bitmap_out, uint32_t size)
+{
+    BITMAP_CACHE_LOCK();
+    bitmap_cache_entry_t * e = bitmap_cache.buckets[bitmap_cache_hash(fdsc, gid)];
+    while(e) {
+        if(e->fdsc == fdsc && e->gid == gid && e->size == size) break;
+        e = e->hash_next;
+    }
+
+    if(e == NULL) {
+        bitmap_cache.stats.miss++;
+        BITMAP_CACHE_UNLOCK();
+        return false;
+    }
+
+    /*Move to the head of the LRU list*/
+    if(e != bitmap_cache.lru_head) {
+        e->lru_prev->lru_next = e->lru_next;
+        if(e->lru_next) e->lru_next->lru_prev = e->lru_prev;
+        else bitmap_cache.lru_tail = e->lru_prev;
+
+        e->lru_prev = NULL;
+        e->lru_next = bitmap_cache.lru_head;
+        bitmap_cache.lru_head->lru_prev = e;
+        bitmap_cache.lru_head = e;
+    }
+
+    lv_memcpy(bitmap_out, e + 1, size);
+    bitmap_cache.stats.hit++;
+    BITMAP_CACHE_UNLOCK();
+    return true;
+}
+
+/**
+ * Add the A8 bitmap of a glyph to the cache. Drop the least recently used bitmaps if required.
+ */
+static void bitmap_cache_add(const void * fdsc, uint32_t gid, const uint8_t * bitmap, uint32_t size)
+{
+    uint32_t entry_size = sizeof(bitmap_cache_entry_t) + size;
+    if(entry_size > BITMAP_CACHE_MAX_SIZE) return;
+
+    BITMAP_CACHE_LOCK();
+    while(bitmap_cache.lru_tail && bitmap_cache.stats.used_size + entry_size > LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE) {
+        bitmap_cache_remove(bitmap_cache.lru_tail);
+        bitmap_cache.stats.evict++;
+    }
+
+    /*An other draw unit might have added it in the meantime*/
+    uint32_t h = bitmap_cache_hash(fdsc, gid);
+    bitmap_cache_entry_t * e = bitmap_cache.buckets[h];
+    while(e) {
+        if(e->fdsc == fdsc && e->gid == gid) {
+            BITMAP_CACHE_UNLOCK();
+            return;
+        }
+        e = e->hash_next;
+    }
+
+    e = lv_malloc(entry_size);
+    if(e == NULL) {
+        BITMAP_CACHE_UNLOCK();
+        return;
+    }
+
+    e->fdsc = fdsc;
+    e->gid = gid;
+    e->size = size;
+    lv_memcpy(e + 1, bitmap, size);
+
+    e->hash_next = bitmap_cache.buckets[h];
+    bitmap_cache.buckets[h] = e;
+
+    e->lru_prev = NULL;
+    e->lru_next = bitmap_cache.lru_head;
+    if(bitmap_cache.lru_head) bitmap_cache.lru_head->lru_prev = e;
+    else bitmap_cache.lru_tail = e;
+    bitmap_cache.lru_head = e;
+
+    bitmap_cache.stats.used_size += entry_size;
+    BITMAP_CACHE_UNLOCK();
+}
+
+/**
+ * Unlink and free a cached bitmap. The cache needs to be locked.
+ */
+static void bitmap_cache_remove(bitmap_cache_entry_t * e)
+{
+    bitmap_cache_entry_t ** p = &bitmap_cache.buckets[bitmap_cache_hash(e->fdsc, e->gid)];
+    while(*p != e) p = &(*p)->hash_next;
+    *p = e->hash_next;
+
+    if(e->lru_prev) e->lru_prev->lru_next = e->lru_next;
+    else bitmap_cache.lru_head = e->lru_next;
+    if(e->lru_next) e->lru_next->lru_prev = e->lru_prev;
+    else bitmap_cache.lru_tail = e->lru_prev;
+
+    bitmap_cache.stats.used_size -= sizeof(bitmap_cache_entry_t) + e->size;
+    lv_free(e);
+}
+#endif /*LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE*/
+
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+/**
+ * Get the glyph ID of a letter from the lookup table of the font.
+ * The table and its pages are created when they are used first.
+ * @param fdsc      pointer to the font's descriptor
+ * @param letter    a UNICODE letter
+ * @return          the glyph ID or 0 if the letter is not in the font
+ */
+static uint32_t lookup_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    const uint16_t * page = NULL;
+    uint32_t gid = 0;
+
+    /*Other threads can create or free the table, so read it only with the lock taken*/
+    LOOKUP_LOCK();
+    if(cache->gid_pages || glyph_lookup_create(fdsc)) {
+        /*Letters before the first page wrap around and fail this check too*/
+        uint32_t page_id = letter / GID_PAGE_SIZE - cache->gid_page_first;
+        if(page_id >= cache->gid_page_cnt) {
+            page = glyph_lookup_empty_page;
+        }
+        else {
+            page = cache->gid_pages[page_id];
+            if(page == NULL) page = glyph_lookup_fill_page(fdsc, page_id);
+        }
+    }
+
+    if(page && page != glyph_lookup_empty_page) gid = page[letter % GID_PAGE_SIZE];
+    LOOKUP_UNLOCK();
+
+    /*The table couldn't be allocated*/
+    if(page == NULL) return find_glyph_id(fdsc, letter);
+
+    return gid;
+}
+
+/**
+ * Allocate the table of pages for the range of letters covered by the cmaps.
+ * Should be called with the lock taken.
+ * @param fdsc      pointer to the font's descriptor
+ * @return          the table of pages or NULL on error
+ */
+static const uint16_t ** glyph_lookup_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->range_length == 0) continue;
+        min = LV_MIN(min, cmap->range_start);
+        max = LV_MAX(max, cmap->range_start + cmap->range_length - 1);
+    }
+    if(min > max) return NULL;
+
+    uint32_t first = min / GID_PAGE_SIZE;
+    uint32_t cnt = max / GID_PAGE_SIZE - first + 1;
+    const uint16_t ** pages = lv_malloc(cnt * sizeof(uint16_t *));
+    LV_ASSERT_MALLOC(pages);
+    if(pages == NULL) return NULL;
+
+    lv_memzero(pages, cnt * sizeof(uint16_t *));
+    cache->gid_page_first = first;
+    cache->gid_page_cnt = cnt;
+    cache->gid_pages = pages;
+    lookup_register(cache);
+
+    return pages;
+}
+
+/**
+ * Create a page of the lookup table with the glyph IDs of its letters.
+ * Should be called with the lock taken.
+ * @param fdsc      pointer to the font's descriptor
+ * @param page_id   index of the page in the table
+ * @return          the page, `glyph_lookup_empty_page` if there are no glyphs in the page or NULL on error
+ */
+static const uint16_t * glyph_lookup_fill_page(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t page_id)
+{
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+
+    uint16_t * new_page = lv_malloc(GID_PAGE_SIZE * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(new_page);
+    if(new_page == NULL) return NULL;
+
+    lv_memzero(new_page, GID_PAGE_SIZE * sizeof(uint16_t));
+    uint32_t page_start = (cache->gid_page_first + page_id) * GID_PAGE_SIZE;
+    uint32_t page_end = page_start + GID_PAGE_SIZE - 1;
+    bool has_glyph = false;
+
+    /*If the cmaps overlap the first one is used for a letter, so go backward to overwrite the later ones*/
+    int32_t i;
+    for(i = fdsc->cmap_num - 1; i >= 0; i--) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->range_length == 0) continue;
+
+        uint32_t start = LV_MAX(page_start, cmap->range_start);
+        uint32_t end = LV_MIN(page_end, cmap->range_start + cmap->range_length - 1);
+        if(start > end) continue;
+
+        /*Clear the letters of the later cmaps and the letters missing from sparse cmaps*/
+        lv_memzero(&new_page[start - page_start], (end - start + 1) * sizeof(uint16_t));
+
+        uint32_t letter;
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            for(letter = start; letter <= end; letter++) {
+                new_page[letter - page_start] = cmap->glyph_id_start + (letter - cmap->range_start);
+            }
+        }
+        else if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+            for(letter = start; letter <= end; letter++) {
+                new_page[letter - page_start] = cmap->glyph_id_start + gid_ofs_8[letter - cmap->range_start];
+            }
+        }
+        else {
+            /*Find the first letter of the page in the sorted list of relative code points*/
+            const uint16_t * list = cmap->unicode_list;
+            uint32_t rcp_start = start - cmap->range_start;
+            uint32_t rcp_end = end - cmap->range_start;
+            uint32_t lo = 0;
+            uint32_t hi = cmap->list_length;
+            while(lo < hi) {
+                uint32_t mid = (lo + hi) / 2;
+                if(list[mid] < rcp_start) lo = mid + 1;
+                else hi = mid;
+            }
+
+            const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+            uint32_t k;
+            for(k = lo; k < cmap->list_length && list[k] <= rcp_end; k++) {
+                letter = cmap->range_start + list[k];
+                if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+                    new_page[letter - page_start] = cmap->glyph_id_start + k;
+                }
+                else {
+                    new_page[letter - page_start] = cmap->glyph_id_start + gid_ofs_16[k];
+                }
+            }
+        }
+    }
+
+    for(i = 0; i < GID_PAGE_SIZE; i++) {
+        if(new_page[i]) {
+            has_glyph = true;
+            break;
+        }
+    }
+
+    const uint16_t * page;
+    if(has_glyph) {
+        page = new_page;
+    }
+    else {
+        lv_free(new_page);
+        page = glyph_lookup_empty_page;
+    }
+    cache->gid_pages[page_id] = page;
+
+    return page;
+}
+
+#endif /*LV_USE_FONT_GLYPH_ID_LOOKUP*/
+
+#if LV_USE_FONT_KERN_LOOKUP
+/**
+ * Get the kerning value of a glyph pair from the hash table of the font's kerning pairs.
+ * The table is created when it's used first.
+ * @param fdsc      pointer to the font's descriptor
+ * @param gid_left  glyph ID of the left letter
+ * @param gid_right glyph ID of the right letter
+ * @param value     store the kerning value here
+ * @return          true: `value` is set; false: the table couldn't be created
+ */
+static bool lookup_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right,
+                              int8_t * value)
+{
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+
+    /*Other threads can create or free the table, so read it only with the lock taken*/
+    LOOKUP_LOCK();
+    bool res = cache->kern_keys != NULL || kern_lookup_create(fdsc);
+    if(res) {
+        /*IDs are at most 16 bit. 0 marks the empty slots but glyph 0 is never looked up*/
+        uint32_t key = (gid_left << 16) | gid_right;
+        uint32_t mask = cache->kern_mask;
+        const uint32_t * keys = cache->kern_keys;
+        uint32_t i = kern_lookup_hash(key, mask);
+        *value = 0;
+        while(keys[i] != 0) {
+            if(keys[i] == key) {
+                *value = cache->kern_values[i];
+                break;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+    LOOKUP_UNLOCK();
+
+    return res;
+}
+
+/**
+ * Create an open addressing hash table from the kerning pairs of a font.
+ * Should be called with the lock taken.
+ * @param fdsc      pointer to the font's descriptor
+ * @return          true: the table is created
+ */
+static bool kern_lookup_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+    if(kdsc->glyph_ids_size > 1) return false;
+
+    /*Keep the table at most half full to have short probe sequences*/
+    uint32_t size = 16;
+    while(size < kdsc->pair_cnt * 2) size <<= 1;
+
+    uint32_t * keys = lv_malloc(size * (sizeof(uint32_t) + sizeof(int8_t)));
+    LV_ASSERT_MALLOC(keys);
+    if(keys == NULL) return false;
+
+    lv_memzero(keys, size * (sizeof(uint32_t) + sizeof(int8_t)));
+    int8_t * values = (int8_t *)&keys[size];
+    uint32_t mask = size - 1;
+
+    uint32_t i;
+    for(i = 0; i < kdsc->pair_cnt; i++) {
+        if(kdsc->values[i] == 0) continue;
+
+        uint32_t key;
+        if(kdsc->glyph_ids_size == 0) {
+            const uint8_t * g_ids = kdsc->glyph_ids;
+            key = ((uint32_t)g_ids[i * 2] << 16) | g_ids[i * 2 + 1];
+        }
+        else {
+            const uint16_t * g_ids = kdsc->glyph_ids;
+            key = ((uint32_t)g_ids[i * 2] << 16) | g_ids[i * 2 + 1];
+        }
+        if(key == 0) continue;
+
+        uint32_t h = kern_lookup_hash(key, mask);
+        while(keys[h] != 0 && keys[h] != key) h = (h + 1) & mask;
+        keys[h] = key;
+        values[h] = kdsc->values[i];
+    }
+
+    cache->kern_values = values;
+    cache->kern_mask = mask;
+    cache->kern_keys = keys;
+    lookup_register(cache);
+
+    return true;
+}
+
+static inline uint32_t kern_lookup_hash(uint32_t key, uint32_t mask)
+{
+    /*Fibonacci hashing to spread the similar IDs*/
+    return ((key * 2654435761U) >> 16) & mask;
+}
+#endif /*LV_USE_FONT_KERN_LOOKUP*/
+
+#if FONT_LOOKUP
+/**
+ * Add a cache to the list of caches with allocated lookup tables if it's not added yet.
+ * Should be called with the lock taken.
+ * @param cache     pointer to the cache of a font
+ */
+static void lookup_register(lv_font_fmt_txt_glyph_cache_t * cache)
+{
+    lv_font_fmt_txt_glyph_cache_t * c;
+    for(c = lookup_head; c; c = c->next) {
+        if(c == cache) return;
+    }
+
+    cache->next = lookup_head;
+    lookup_head = cache;
+}
+
+static void lookup_free(lv_font_fmt_txt_glyph_cache_t * cache)
+{
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+    uint32_t i;
+    for(i = 0; i < cache->gid_page_cnt; i++) {
+        if(cache->gid_pages[i] != glyph_lookup_empty_page) lv_free((void *)cache->gid_pages[i]);
+    }
+    lv_free(cache->gid_pages);
+
+    cache->gid_pages = NULL;
+    cache->gid_page_first = 0;
+    cache->gid_page_cnt = 0;
+#endif
+
+#if LV_USE_FONT_KERN_LOOKUP
+    /*The values are in the same allocation*/
+    lv_free((void *)cache->kern_keys);
+    cache->kern_keys = NULL;
+    cache->kern_values = NULL;
+    cache->kern_mask = 0;
+#endif
+
+    cache->next = NULL;
+}
+#endif /*FONT_LOOKUP*/
+
 #if LV_USE_FONT_COMPRESSED
 /**
  * The compress a glyph's bitmap
@@ -389,7 +1023,8 @@ static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord
             break;
     }
 
-    rle_init(in, bpp);
+    rle_t rle;
+    rle_init(&rle, in, bpp);
 
     uint8_t * line_buf1 = lv_malloc(w);
 
@@ -399,7 +1034,7 @@ static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord
         line_buf2 = lv_malloc(w);
     }
 
-    decompress_line(line_buf1, w);
+    decompress_line(&rle, line_buf1, w);
 
     lv_coord_t y;
     lv_coord_t x;
@@ -411,7 +1046,7 @@ static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord
 
     for(y = 1; y < h; y++) {
         if(prefilter) {
-            decompress_line(line_buf2, w);
+            decompress_line(&rle, line_buf2, w);
 
             for(x = 0; x < w; x++) {
                 line_buf1[x] = line_buf2[x] ^ line_buf1[x];
@@ -419,7 +1054,7 @@ static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord
             }
         }
         else {
-            decompress_line(line_buf1, w);
+            decompress_line(&rle, line_buf1, w);
 
             for(x = 0; x < w; x++) {
                 out[x] = opa_table[line_buf1[x]];
@@ -434,14 +1069,15 @@ static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord
 
 /**
  * Decompress one line. Store one pixel per byte
+ * @param rle state of the decompression
  * @param out output buffer
  * @param w width of the line in pixel count
  */
-static inline void decompress_line(uint8_t * out, lv_coord_t w)
+static inline void decompress_line(rle_t * rle, uint8_t * out, lv_coord_t w)
 {
     lv_coord_t i;
     for(i = 0; i < w; i++) {
-        out[i] = rle_next();
+        out[i] = rle_next(rle);
     }
 }
 
@@ -487,67 +1123,67 @@ static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len
     }
 }
 
-static inline void rle_init(const uint8_t * in,  uint8_t bpp)
+static inline void rle_init(rle_t * rle, const uint8_t * in,  uint8_t bpp)
 {
-    rle_in = in;
-    rle_bpp = bpp;
-    rle_state = RLE_STATE_SINGLE;
-    rle_rdp = 0;
-    rle_prev_v = 0;
-    rle_cnt = 0;
+    rle->in = in;
+    rle->bpp = bpp;
+    rle->state = RLE_STATE_SINGLE;
+    rle->rdp = 0;
+    rle->prev_v = 0;
+    rle->cnt = 0;
 }
 
-static inline uint8_t rle_next(void)
+static inline uint8_t rle_next(rle_t * rle)
 {
     uint8_t v = 0;
     uint8_t ret = 0;
 
-    if(rle_state == RLE_STATE_SINGLE) {
-        ret = get_bits(rle_in, rle_rdp, rle_bpp);
-        if(rle_rdp != 0 && rle_prev_v == ret) {
-            rle_cnt = 0;
-            rle_state = RLE_STATE_REPEATE;
+    if(rle->state == RLE_STATE_SINGLE) {
+        ret = get_bits(rle->in, rle->rdp, rle->bpp);
+        if(rle->rdp != 0 && rle->prev_v == ret) {
+            rle->cnt = 0;
+            rle->state = RLE_STATE_REPEATE;
         }
 
-        rle_prev_v = ret;
-        rle_rdp += rle_bpp;
+        rle->prev_v = ret;
+        rle->rdp += rle->bpp;
     }
-    else if(rle_state == RLE_STATE_REPEATE) {
-        v = get_bits(rle_in, rle_rdp, 1);
-        rle_cnt++;
-        rle_rdp += 1;
+    else if(rle->state == RLE_STATE_REPEATE) {
+        v = get_bits(rle->in, rle->rdp, 1);
+        rle->cnt++;
+        rle->rdp += 1;
         if(v == 1) {
-            ret = rle_prev_v;
-            if(rle_cnt == 11) {
-                rle_cnt = get_bits(rle_in, rle_rdp, 6);
-                rle_rdp += 6;
-                if(rle_cnt != 0) {
-                    rle_state = RLE_STATE_COUNTER;
+            ret = rle->prev_v;
+            if(rle->cnt == 11) {
+                rle->cnt = get_bits(rle->in, rle->rdp, 6);
+                rle->rdp += 6;
+                if(rle->cnt != 0) {
+                    rle->state = RLE_STATE_COUNTER;
                 }
                 else {
-                    ret = get_bits(rle_in, rle_rdp, rle_bpp);
-                    rle_prev_v = ret;
-                    rle_rdp += rle_bpp;
-                    rle_state = RLE_STATE_SINGLE;
+                    ret = get_bits(rle->in, rle->rdp, rle->bpp);
+                    rle->prev_v = ret;
+                    rle->rdp += rle->bpp;
+                    rle->state = RLE_STATE_SINGLE;
                 }
             }
         }
         else {
-            ret = get_bits(rle_in, rle_rdp, rle_bpp);
-            rle_prev_v = ret;
-            rle_rdp += rle_bpp;
-            rle_state = RLE_STATE_SINGLE;
+            ret = get_bits(rle->in, rle->rdp, rle->bpp);
+            rle->prev_v = ret;
+            rle->rdp += rle->bpp;
+            rle->state = RLE_STATE_SINGLE;
         }
 
     }
-    else if(rle_state == RLE_STATE_COUNTER) {
-        ret = rle_prev_v;
-        rle_cnt--;
-        if(rle_cnt == 0) {
-            ret = get_bits(rle_in, rle_rdp, rle_bpp);
-            rle_prev_v = ret;
-            rle_rdp += rle_bpp;
-            rle_state = RLE_STATE_SINGLE;
+    else if(rle->state == RLE_STATE_COUNTER) {
+        ret = rle->prev_v;
+        rle->cnt--;
+        if(rle->cnt == 0) {
+            ret = get_bits(rle->in, rle->rdp, rle->bpp);
+            rle->prev_v = ret;
+            rle->rdp += rle->bpp;
+            rle->state = RLE_STATE_SINGLE;
         }
     }
 
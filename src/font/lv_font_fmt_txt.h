@@ -156,13 +156,28 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
-typedef struct {
+typedef struct _lv_font_fmt_txt_glyph_cache_t {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+    /*Filled at run time, shouldn't be initialized in the font's source*/
+    const uint16_t ** gid_pages;    /*Glyph IDs of the letters in pages of 256 letters. Allocated when used first*/
+    uint32_t gid_page_first;        /*Index of the first page (`letter >> 8`)*/
+    uint32_t gid_page_cnt;
+#endif
+#if LV_USE_FONT_KERN_LOOKUP
+    /*Hash table of the kerning pairs. Allocated when used first*/
+    const uint32_t * kern_keys;     /*`left_glyph_id << 16 | right_glyph_id` or 0 for empty slots*/
+    const int8_t * kern_values;
+    uint32_t kern_mask;             /*Size of the table - 1*/
+#endif
+#if LV_USE_FONT_GLYPH_ID_LOOKUP || LV_USE_FONT_KERN_LOOKUP
+    struct _lv_font_fmt_txt_glyph_cache_t * next;   /*Linked list of the caches with allocated memory*/
+#endif
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
-typedef struct {
+typedef struct _lv_font_fmt_txt_dsc_t {
     /*The bitmaps of all glyphs*/
     const uint8_t * glyph_bitmap;
 
@@ -199,8 +214,24 @@ typedef struct {
     uint16_t bitmap_format  : 2;
 
     lv_font_fmt_txt_glyph_cache_t * cache;
+
+    /**
+     * Optional. If set, the glyph bitmaps are not stored in `glyph_bitmap`, but this callback is called
+     * to read the packed or compressed bitmap of a glyph when it's needed (e.g. from a file).
+     * Should return a buffer allocated with `lv_malloc()` (freed by the caller) or NULL on error.
+     */
+    uint8_t * (*read_glyph_bitmap_cb)(const struct _lv_font_fmt_txt_dsc_t * dsc, uint32_t glyph_id);
 } lv_font_fmt_txt_dsc_t;
 
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+typedef struct {
+    uint32_t hit;           /**< Number of bitmaps found in the cache*/
+    uint32_t miss;          /**< Number of bitmaps decoded from the font*/
+    uint32_t evict;         /**< Number of bitmaps dropped to make room for new ones*/
+    uint32_t used_size;     /**< Bytes used by the cached bitmaps*/
+} lv_font_fmt_txt_bitmap_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -227,11 +258,45 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Initialize the shared resources of the fonts. Called by `lv_init()`.
+ */
+void _lv_font_fmt_txt_init(void);
+
 /**
  * Free the allocated memories.
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+/**
+ * Drop the cached bitmaps of a font. Needs to be called before freeing a font
+ * which was created at run time. `lv_font_free()` calls it automatically.
+ * @param font      pointer to a font or NULL to drop the bitmaps of all fonts
+ */
+void lv_font_fmt_txt_bitmap_cache_drop(const lv_font_t * font);
+
+/**
+ * Get the statistics of the glyph bitmap cache
+ * @param stats     store the statistics here
+ */
+void lv_font_fmt_txt_bitmap_cache_get_stats(lv_font_fmt_txt_bitmap_cache_stats_t * stats);
+
+/**
+ * Reset the counters of the glyph bitmap cache's statistics
+ */
+void lv_font_fmt_txt_bitmap_cache_reset_stats(void);
+#endif
+
+#if LV_USE_FONT_GLYPH_ID_LOOKUP || LV_USE_FONT_KERN_LOOKUP
+/**
+ * Free the glyph ID and kerning lookup tables of a font. Needs to be called before freeing a font
+ * which was created at run time. `lv_font_free()` calls it automatically.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_lookup_drop(const lv_font_t * font);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -12,11 +12,31 @@
 
 #include "../lvgl.h"
 #include "../misc/lv_fs.h"
+#include "../osal/lv_os.h"
 #include "lv_font_loader.h"
 
 /**********************
  *      TYPEDEFS
  **********************/
+/*The `dsc` of the loaded fonts. The file stays open while the glyph bitmaps are used from its mapping
+ *or read from it on demand*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t dsc;  /*Must be the first to be freed as `lv_font_fmt_txt_dsc_t`*/
+    lv_fs_file_t file;
+    const uint8_t * map;        /*The mapped file or NULL if the bitmaps were copied*/
+    uint32_t map_size;
+    lv_font_fmt_txt_glyph_cache_t cache;
+
+    /*Lazy loading: the bitmaps are read from `file` when they are needed*/
+    bool lazy;
+    uint8_t glyph_header_bits;  /*Bits before the bitmap in the data of a glyph*/
+    uint32_t glyph_start;       /*Position of the glyph table in the file*/
+    uint32_t * glyph_offset;    /*Offset of the glyphs' data in the glyph table. +1 item for the end of the table*/
+#if LV_USE_OS
+    lv_mutex_t lock;            /*Protects `file`*/
+#endif
+} font_loader_dsc_t;
+
 typedef struct {
     lv_fs_file_t * fp;
     int8_t bit_pos;
@@ -64,7 +84,10 @@ typedef struct cmap_table_bin {
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static lv_font_t * font_load(const char * font_name, bool lazy);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, const uint8_t * map, uint32_t map_size, bool lazy);
+static bool read_glyph_bitmap(lv_fs_file_t * fp, uint32_t pos, int nbits, int bmp_size, uint8_t * out);
+static uint8_t * read_glyph_bitmap_lazy(const lv_font_fmt_txt_dsc_t * dsc, uint32_t glyph_id);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -85,29 +108,20 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
  */
 lv_font_t * lv_font_load(const char * font_name)
 {
-    lv_fs_file_t file;
-    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
-    if(res != LV_FS_RES_OK)
-        return NULL;
-
-    lv_font_t * font = lv_malloc(sizeof(lv_font_t));
-    if(font) {
-        memset(font, 0, sizeof(lv_font_t));
-        if(!lvgl_load_font(&file, font)) {
-            LV_LOG_WARN("Error loading font file: %s\n", font_name);
-            /*
-            * When `lvgl_load_font` fails it can leak some pointers.
-            * All non-null pointers can be assumed as allocated and
-            * `lv_font_free` should free them correctly.
-            */
-            lv_font_free(font);
-            font = NULL;
-        }
-    }
-
-    lv_fs_close(&file);
+    return font_load(font_name, false);
+}
 
-    return font;
+/**
+ * Loads a `lv_font_t` object from a binary font file but reads the glyph bitmaps only when they are drawn.
+ * Only the header, the character maps, the glyph descriptors and the kerning are loaded into the RAM.
+ * If the file can be memory mapped the bitmaps are used from the mapping instead.
+ * The file stays open until the font is freed with `lv_font_free()`.
+ * @param font_name filename where the font file is located
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_lazy(const char * font_name)
+{
+    return font_load(font_name, true);
 }
 
 /**
@@ -120,6 +134,12 @@ void lv_font_free(lv_font_t * font)
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+            lv_font_fmt_txt_bitmap_cache_drop(font);
+#endif
+#if LV_USE_FONT_GLYPH_ID_LOOKUP || LV_USE_FONT_KERN_LOOKUP
+            lv_font_fmt_txt_lookup_drop(font);
+#endif
 
             if(dsc->kern_classes == 0) {
                 lv_font_fmt_txt_kern_pair_t * kern_dsc =
@@ -166,9 +186,21 @@ void lv_font_free(lv_font_t * font)
                 lv_free(cmaps);
             }
 
-            if(NULL != dsc->glyph_bitmap) {
+            font_loader_dsc_t * loader_dsc = (font_loader_dsc_t *)dsc;
+            if(loader_dsc->map) {
+                lv_fs_unmap(&loader_dsc->file, loader_dsc->map, loader_dsc->map_size);
+                lv_fs_close(&loader_dsc->file);
+            }
+            else if(loader_dsc->lazy) {
+                lv_fs_close(&loader_dsc->file);
+#if LV_USE_OS
+                lv_mutex_delete(&loader_dsc->lock);
+#endif
+            }
+            else if(NULL != dsc->glyph_bitmap) {
                 lv_free((void *)dsc->glyph_bitmap);
             }
+            lv_free(loader_dsc->glyph_offset);
             if(NULL != dsc->glyph_dsc) {
                 lv_free((void *)dsc->glyph_dsc);
             }
@@ -182,6 +214,57 @@ void lv_font_free(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_font_t * font_load(const char * font_name, bool lazy)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK)
+        return NULL;
+
+    /*Try to use the glyph bitmaps directly from the file without copying them*/
+    const void * map = NULL;
+    uint32_t map_size = 0;
+    lv_fs_map(&file, &map, &map_size);
+
+    lv_font_t * font = lv_malloc(sizeof(lv_font_t));
+    if(font) {
+        memset(font, 0, sizeof(lv_font_t));
+        if(!lvgl_load_font(&file, font, map, map_size, lazy)) {
+            LV_LOG_WARN("Error loading font file: %s\n", font_name);
+            /*
+            * When `lvgl_load_font` fails it can leak some pointers.
+            * All non-null pointers can be assumed as allocated and
+            * `lv_font_free` should free them correctly.
+            * The mapping and the file are released below so forget them here.
+            */
+            font_loader_dsc_t * loader_dsc = (font_loader_dsc_t *)font->dsc;
+            if(loader_dsc && loader_dsc->map) {
+                loader_dsc->map = NULL;
+                loader_dsc->dsc.glyph_bitmap = NULL;
+            }
+            if(loader_dsc) loader_dsc->lazy = false;
+            lv_font_free(font);
+            font = NULL;
+        }
+        else {
+            font_loader_dsc_t * loader_dsc = (font_loader_dsc_t *)font->dsc;
+            if(loader_dsc->map || loader_dsc->lazy) {
+                /*Keep the file open while the mapping is used or the bitmaps are read. Closed in `lv_font_free`*/
+                lv_memcpy(&loader_dsc->file, &file, sizeof(file));
+#if LV_USE_OS
+                if(loader_dsc->lazy) lv_mutex_init(&loader_dsc->lock);
+#endif
+                return font;
+            }
+        }
+    }
+
+    if(map) lv_fs_unmap(&file, map, map_size);
+    lv_fs_close(&file);
+
+    return font;
+}
+
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
 {
     bit_iterator_t it;
@@ -335,9 +418,12 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
     return success ? cmaps_length : -1;
 }
 
-static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+static int32_t load_glyph(lv_fs_file_t * fp, font_loader_dsc_t * loader_dsc, const uint8_t * map, uint32_t map_size,
+                          bool lazy, uint32_t start, uint32_t ** glyph_offset_p, uint32_t loca_count,
+                          font_header_bin_t * header)
 {
+    lv_font_fmt_txt_dsc_t * font_dsc = &loader_dsc->dsc;
+    uint32_t * glyph_offset = *glyph_offset_p;
     int32_t glyph_length = read_label(fp, start, "glyf");
     if(glyph_length < 0) {
         return -1;
@@ -414,6 +500,34 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         }
     }
 
+    /*If the file is mapped and the bitmaps are byte aligned use them from the file directly*/
+    int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+    bool use_map = map != NULL && nbits % 8 == 0 && (uint64_t)start + glyph_length <= map_size;
+#if LV_FONT_FMT_TXT_LARGE == 0
+    if(glyph_length >= (1 << 20)) use_map = false;  /*`bitmap_index` can't address the whole table*/
+#endif
+    if(use_map) {
+        for(unsigned int i = 1; i < loca_count; ++i) {
+            glyph_dsc[i].bitmap_index = glyph_offset[i] + nbits / 8;
+        }
+        font_dsc->glyph_bitmap = map + start;
+        loader_dsc->map = map;
+        loader_dsc->map_size = map_size;
+        return glyph_length;
+    }
+
+    if(lazy) {
+        /*Keep only the offsets to read the bitmaps when they are needed*/
+        glyph_offset[loca_count] = glyph_length;
+        loader_dsc->glyph_offset = glyph_offset;
+        *glyph_offset_p = NULL;
+        loader_dsc->glyph_start = start;
+        loader_dsc->glyph_header_bits = nbits;
+        loader_dsc->lazy = true;
+        font_dsc->read_glyph_bitmap_cb = read_glyph_bitmap_lazy;
+        return glyph_length;
+    }
+
     uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
@@ -421,19 +535,6 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
     cur_bmp_size = 0;
 
     for(unsigned int i = 1; i < loca_count; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
-        if(res != LV_FS_RES_OK) {
-            return -1;
-        }
-        bit_iterator_t bit_it = init_bit_iterator(fp);
-
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
-
-        read_bits(&bit_it, nbits, &res);
-        if(res != LV_FS_RES_OK) {
-            return -1;
-        }
-
         if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) {
             continue;
         }
@@ -441,31 +542,91 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
-        if(nbits % 8 == 0) {  /*Fast path*/
-            if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
-                return -1;
-            }
+        if(!read_glyph_bitmap(fp, start + glyph_offset[i], nbits, bmp_size, &glyph_bmp[cur_bmp_size])) {
+            return -1;
         }
-        else {
-            for(int k = 0; k < bmp_size - 1; ++k) {
-                glyph_bmp[cur_bmp_size + k] = read_bits(&bit_it, 8, &res);
-                if(res != LV_FS_RES_OK) {
-                    return -1;
-                }
-            }
-            glyph_bmp[cur_bmp_size + bmp_size - 1] = read_bits(&bit_it, 8 - nbits % 8, &res);
-            if(res != LV_FS_RES_OK) {
-                return -1;
-            }
 
-            /*The last fragment should be on the MSB but read_bits() will place it to the LSB*/
-            glyph_bmp[cur_bmp_size + bmp_size - 1] = glyph_bmp[cur_bmp_size + bmp_size - 1] << (nbits % 8);
+        cur_bmp_size += bmp_size;
+    }
+    return glyph_length;
+}
+
+/**
+ * Read the bitmap of a glyph from the glyph table
+ * @param fp        pointer to the font file
+ * @param pos       position of the glyph's data in the file
+ * @param nbits     number of bits of the glyph's descriptor before the bitmap
+ * @param bmp_size  size of the bitmap in bytes
+ * @param out       store the bitmap here
+ * @return          true: the bitmap was read
+ */
+static bool read_glyph_bitmap(lv_fs_file_t * fp, uint32_t pos, int nbits, int bmp_size, uint8_t * out)
+{
+    lv_fs_res_t res = lv_fs_seek(fp, pos, LV_FS_SEEK_SET);
+    if(res != LV_FS_RES_OK) {
+        return false;
+    }
+    bit_iterator_t bit_it = init_bit_iterator(fp);
 
+    read_bits(&bit_it, nbits, &res);
+    if(res != LV_FS_RES_OK) {
+        return false;
+    }
+
+    if(nbits % 8 == 0) {  /*Fast path*/
+        return lv_fs_read(fp, out, bmp_size, NULL) == LV_FS_RES_OK;
+    }
+
+    for(int k = 0; k < bmp_size - 1; ++k) {
+        out[k] = read_bits(&bit_it, 8, &res);
+        if(res != LV_FS_RES_OK) {
+            return false;
         }
+    }
+    out[bmp_size - 1] = read_bits(&bit_it, 8 - nbits % 8, &res);
+    if(res != LV_FS_RES_OK) {
+        return false;
+    }
 
-        cur_bmp_size += bmp_size;
+    /*The last fragment should be on the MSB but read_bits() will place it to the LSB*/
+    out[bmp_size - 1] = out[bmp_size - 1] << (nbits % 8);
+
+    return true;
+}
+
+/**
+ * Used as `read_glyph_bitmap_cb` of the lazy loaded fonts to read a bitmap from the file
+ * @param dsc       pointer to the font's descriptor
+ * @param glyph_id  ID of the glyph
+ * @return          the bitmap in an `lv_malloc`ed buffer or NULL on error
+ */
+static uint8_t * read_glyph_bitmap_lazy(const lv_font_fmt_txt_dsc_t * dsc, uint32_t glyph_id)
+{
+    font_loader_dsc_t * loader_dsc = (font_loader_dsc_t *)dsc;
+    int nbits = loader_dsc->glyph_header_bits;
+    uint32_t ofs = loader_dsc->glyph_offset[glyph_id];
+    int bmp_size = loader_dsc->glyph_offset[glyph_id + 1] - ofs - nbits / 8;
+    if(bmp_size <= 0) return NULL;
+
+    uint8_t * buf = lv_malloc(bmp_size);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return NULL;
+
+#if LV_USE_OS
+    lv_mutex_lock(&loader_dsc->lock);
+#endif
+    bool res = read_glyph_bitmap(&loader_dsc->file, loader_dsc->glyph_start + ofs, nbits, bmp_size, buf);
+#if LV_USE_OS
+    lv_mutex_unlock(&loader_dsc->lock);
+#endif
+
+    if(!res) {
+        LV_LOG_WARN("Couldn't read the bitmap of glyph %d", (int)glyph_id);
+        lv_free(buf);
+        return NULL;
     }
-    return glyph_length;
+
+    return buf;
 }
 
 /*
@@ -480,13 +641,17 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * `lv_font_free` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, const uint8_t * map, uint32_t map_size, bool lazy)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    font_loader_dsc_t * loader_dsc = lv_malloc(sizeof(font_loader_dsc_t));
+    if(loader_dsc == NULL) {
+        return false;
+    }
 
-    memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    memset(loader_dsc, 0, sizeof(font_loader_dsc_t));
 
+    lv_font_fmt_txt_dsc_t * font_dsc = &loader_dsc->dsc;
+    font_dsc->cache = &loader_dsc->cache;
     font->dsc = font_dsc;
 
     /*header*/
@@ -561,8 +726,8 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
-    int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+    int32_t glyph_length = load_glyph(fp, loader_dsc, map, map_size, lazy, glyph_start, &glyph_offset, loca_count,
+                                      &font_header);
 
     lv_free(glyph_offset);
 
@@ -0,0 +1,225 @@
+/**
+ * @file lv_font_sdf.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_sdf.h"
+#if LV_USE_FONT_SDF
+
+#include "../misc/lv_assert.h"
+#include "../misc/lv_utils.h"
+#include "../misc/lv_math.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Bounding box of a glyph at the size of the font*/
+typedef struct {
+    int32_t x1;     /*Left, measured from the origin*/
+    int32_t y1;     /*Bottom, measured upwards from the base line*/
+    int32_t w;
+    int32_t h;
+} glyph_box_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const lv_font_sdf_glyph_dsc_t * find_glyph(const lv_font_sdf_dsc_t * dsc, uint32_t letter);
+static int32_t unicode_list_compare(const void * ref, const void * element);
+static void get_glyph_box(const lv_font_t * font, const lv_font_sdf_glyph_dsc_t * gdsc, glyph_box_t * box);
+static int32_t div_floor(int32_t a, int32_t b);
+static int32_t div_ceil(int32_t a, int32_t b);
+static inline uint32_t sample(const uint8_t * sdf, int32_t w, int32_t h, int32_t x, int32_t y);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_font_sdf_init(lv_font_t * font, const lv_font_sdf_dsc_t * dsc, lv_coord_t line_height)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(dsc);
+
+    lv_memzero(font, sizeof(lv_font_t));
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_sdf;
+    font->get_glyph_bitmap = lv_font_get_bitmap_sdf;
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->kerning = LV_FONT_KERNING_NONE;
+    font->dsc = dsc;
+
+    lv_font_sdf_set_size(font, line_height);
+}
+
+void lv_font_sdf_set_size(lv_font_t * font, lv_coord_t line_height)
+{
+    LV_ASSERT_NULL(font);
+    if(line_height <= 0) return;
+
+    const lv_font_sdf_dsc_t * dsc = font->dsc;
+    font->line_height = line_height;
+    font->base_line = (dsc->base_line * line_height + dsc->line_height / 2) / dsc->line_height;
+    font->underline_thickness = (int8_t)LV_CLAMP(1, line_height / 16, INT8_MAX);
+    font->underline_position = -font->underline_thickness;
+}
+
+bool lv_font_get_glyph_dsc_sdf(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                               uint32_t unicode_letter_next)
+{
+    LV_UNUSED(unicode_letter_next);
+
+    const lv_font_sdf_dsc_t * dsc = font->dsc;
+    const lv_font_sdf_glyph_dsc_t * gdsc = find_glyph(dsc, unicode_letter);
+    if(gdsc == NULL) return false;
+
+    glyph_box_t box;
+    get_glyph_box(font, gdsc, &box);
+
+    dsc_out->adv_w = (uint16_t)(((int32_t)gdsc->adv_w * font->line_height / dsc->line_height + 8) >> 4);
+    dsc_out->box_w = (uint16_t)box.w;
+    dsc_out->box_h = (uint16_t)box.h;
+    dsc_out->ofs_x = (int16_t)box.x1;
+    dsc_out->ofs_y = (int16_t)box.y1;
+    dsc_out->bpp = 8;
+    dsc_out->is_placeholder = false;
+
+    return true;
+}
+
+const uint8_t * lv_font_get_bitmap_sdf(const lv_font_t * font, uint32_t unicode_letter, uint8_t * bitmap_out)
+{
+    const lv_font_sdf_dsc_t * dsc = font->dsc;
+    const lv_font_sdf_glyph_dsc_t * gdsc = find_glyph(dsc, unicode_letter);
+    if(gdsc == NULL || bitmap_out == NULL) return NULL;
+
+    glyph_box_t box;
+    get_glyph_box(font, gdsc, &box);
+    if(box.w <= 0 || box.h <= 0) return bitmap_out;
+
+    const uint8_t * sdf = &dsc->glyph_sdf[gdsc->sdf_index];
+    int32_t sdf_w = gdsc->box_w;
+    int32_t sdf_h = gdsc->box_h;
+    int32_t base_h = dsc->line_height;
+    int32_t line_h = font->line_height;
+
+    /*Step in the distance field between two pixels in 16.16 format*/
+    int32_t step = (int32_t)(((int64_t)base_h << 16) / line_h);
+
+    /*Map the center of the first pixel to the distance field where the center of a sample is at .5*/
+    int32_t x_start = (int32_t)((((int64_t)2 * box.x1 + 1) * base_h << 15) / line_h) -
+                      ((int32_t)gdsc->ofs_x << 16) - 0x8000;
+    int32_t y = ((int32_t)(gdsc->ofs_y + sdf_h) << 16) - 0x8000 -
+                (int32_t)((((int64_t)2 * (box.y1 + box.h) - 1) * base_h << 15) / line_h);
+
+    /*Convert the distance to opacity with 1 px wide anti-aliasing at the size of the font:
+     *the field changes with 127 / spread per pixel of the field*/
+    int32_t gain = (int32_t)((int64_t)dsc->spread * 255 * 256 * line_h / (127 * base_h));
+
+    uint8_t * dest = bitmap_out;
+    int32_t row;
+    for(row = 0; row < box.h; row++) {
+        int32_t sy = y >> 16;
+        uint32_t fy = (y >> 8) & 0xFF;
+        int32_t x = x_start;
+        int32_t col;
+        for(col = 0; col < box.w; col++) {
+            int32_t sx = x >> 16;
+            uint32_t fx = (x >> 8) & 0xFF;
+
+            uint32_t top = sample(sdf, sdf_w, sdf_h, sx, sy) * (256 - fx) + sample(sdf, sdf_w, sdf_h, sx + 1, sy) * fx;
+            uint32_t bottom = sample(sdf, sdf_w, sdf_h, sx, sy + 1) * (256 - fx) +
+                              sample(sdf, sdf_w, sdf_h, sx + 1, sy + 1) * fx;
+            int32_t v = (int32_t)((top * (256 - fy) + bottom * fy) >> 16);
+
+            int32_t a = 128 + (((v - 128) * gain) >> 8);
+            dest[col] = (uint8_t)LV_CLAMP(0, a, 255);
+            x += step;
+        }
+        dest += box.w;
+        y += step;
+    }
+
+    return bitmap_out;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const lv_font_sdf_glyph_dsc_t * find_glyph(const lv_font_sdf_dsc_t * dsc, uint32_t letter)
+{
+    const uint32_t * p = _lv_utils_bsearch(&letter, dsc->unicode_list, dsc->glyph_cnt, sizeof(uint32_t),
+                                           unicode_list_compare);
+    if(p == NULL) return NULL;
+
+    return &dsc->glyph_dsc[p - dsc->unicode_list];
+}
+
+static int32_t unicode_list_compare(const void * ref, const void * element)
+{
+    uint32_t a = *(const uint32_t *)ref;
+    uint32_t b = *(const uint32_t *)element;
+    if(a < b) return -1;
+    if(a > b) return 1;
+    return 0;
+}
+
+/**
+ * Get the box of a glyph at the size of the font. The margin of the distance field
+ * is transparent apart from the 1 px next to the outline, so it's left out.
+ */
+static void get_glyph_box(const lv_font_t * font, const lv_font_sdf_glyph_dsc_t * gdsc, glyph_box_t * box)
+{
+    const lv_font_sdf_dsc_t * dsc = font->dsc;
+
+    if(gdsc->box_w == 0 || gdsc->box_h == 0) {
+        lv_memzero(box, sizeof(glyph_box_t));
+        return;
+    }
+
+    int32_t margin = dsc->spread - 1;
+    int32_t x1 = gdsc->ofs_x + margin;
+    int32_t x2 = gdsc->ofs_x + gdsc->box_w - margin;
+    int32_t y1 = gdsc->ofs_y + margin;
+    int32_t y2 = gdsc->ofs_y + gdsc->box_h - margin;
+
+    box->x1 = div_floor(x1 * font->line_height, dsc->line_height);
+    box->y1 = div_floor(y1 * font->line_height, dsc->line_height);
+    box->w = div_ceil(x2 * font->line_height, dsc->line_height) - box->x1;
+    box->h = div_ceil(y2 * font->line_height, dsc->line_height) - box->y1;
+}
+
+static int32_t div_floor(int32_t a, int32_t b)
+{
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static int32_t div_ceil(int32_t a, int32_t b)
+{
+    return a >= 0 ? (a + b - 1) / b : -(-a / b);
+}
+
+static inline uint32_t sample(const uint8_t * sdf, int32_t w, int32_t h, int32_t x, int32_t y)
+{
+    /*Out of the field is far from the glyph*/
+    if(x < 0 || y < 0 || x >= w || y >= h) return 0;
+    return sdf[y * w + x];
+}
+
+#endif /*LV_USE_FONT_SDF*/
@@ -0,0 +1,118 @@
+/**
+ * @file lv_font_sdf.h
+ *
+ */
+
+#ifndef LV_FONT_SDF_H
+#define LV_FONT_SDF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font.h"
+
+#if LV_USE_FONT_SDF
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Describes the signed distance field of a glyph. The sizes are measured at the line height of the font.*/
+typedef struct {
+    uint32_t sdf_index;             /**< Start index of the distance field in `glyph_sdf`*/
+    uint16_t adv_w;                 /**< Draw the next glyph after this width. 12.4 format (real_value * 16 is stored).*/
+    uint8_t box_w;                  /**< Width of the distance field*/
+    uint8_t box_h;                  /**< Height of the distance field*/
+    int8_t ofs_x;                   /**< x offset of the distance field*/
+    int8_t ofs_y;                   /**< y offset of the distance field measured from the base line*/
+} lv_font_sdf_glyph_dsc_t;
+
+/**
+ * Describes a font whose glyphs are stored as signed distance fields, so that it can be rendered at any size.
+ * Can be generated from TTF files with `scripts/font_sdf_conv.py`.
+ */
+typedef struct {
+    /** 8 bit distance fields of the glyphs, rows from top to bottom.
+     * 128 is the outline and the value changes with 127 / `spread` per pixel, increasing inwards.*/
+    const uint8_t * glyph_sdf;
+
+    /** Describes the glyphs*/
+    const lv_font_sdf_glyph_dsc_t * glyph_dsc;
+
+    /** The letters in increasing order. The glyph of `unicode_list[i]` is `glyph_dsc[i]`*/
+    const uint32_t * unicode_list;
+
+    /** Number of glyphs*/
+    uint32_t glyph_cnt;
+
+    /** Line height the distance fields were rendered at*/
+    uint16_t line_height;
+
+    /** Base line measured from the bottom of the line at `line_height`*/
+    int16_t base_line;
+
+    /** Distance from the outline in pixels where the fields saturate*/
+    uint8_t spread;
+} lv_font_sdf_dsc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a font to render the glyphs of an SDF font descriptor at a given size.
+ * Nothing is allocated, so the same descriptor can be used by any number of fonts.
+ * @param font          pointer to a font to initialize
+ * @param dsc           pointer to an SDF font descriptor. Only its pointer is saved.
+ * @param line_height   the line height of the font in pixels
+ */
+void lv_font_sdf_init(lv_font_t * font, const lv_font_sdf_dsc_t * dsc, lv_coord_t line_height);
+
+/**
+ * Change the size of an SDF font. The objects using the font need to be refreshed
+ * (e.g. with `lv_obj_report_style_change()`) to update their layout.
+ * @param font          pointer to a font initialized with `lv_font_sdf_init()`
+ * @param line_height   the new line height of the font in pixels
+ */
+void lv_font_sdf_set_size(lv_font_t * font, lv_coord_t line_height);
+
+/**
+ * Used as `get_glyph_dsc` callback in SDF fonts.
+ * @param font pointer to font
+ * @param dsc_out store the result descriptor here
+ * @param unicode_letter a UNICODE letter code
+ * @param unicode_letter_next the next letter (not used as the SDF fonts have no kerning)
+ * @return true: descriptor is successfully loaded into `dsc_out`.
+ *         false: the letter was not found, no data is loaded to `dsc_out`
+ */
+bool lv_font_get_glyph_dsc_sdf(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                               uint32_t unicode_letter_next);
+
+/**
+ * Used as `get_glyph_bitmap` callback in SDF fonts. Renders the A8 bitmap of a glyph at the size of the font.
+ * @param font pointer to font
+ * @param unicode_letter a unicode letter which bitmap should be get
+ * @param bitmap_out buffer for the A8 bitmap. Its size should be `box_w * box_h` of the glyph's descriptor.
+ * @return `bitmap_out` or NULL if the letter was not found
+ */
+const uint8_t * lv_font_get_bitmap_sdf(const lv_font_t * font, uint32_t unicode_letter, uint8_t * bitmap_out);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FONT_SDF*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_SDF_H*/
@@ -14,6 +14,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*Number of pixels to read at once when the pixels are converted while reading*/
+#define BMP_CONVERT_CHUNK_PX    64
 
 /**********************
  *      TYPEDEFS
@@ -40,6 +42,10 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
 
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 
+#if LV_COLOR_DEPTH == 16
+static void read_rgb888_as_rgb565(lv_fs_file_t * f, lv_coord_t len, uint8_t * buf);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -103,7 +109,12 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
                     header->cf = LV_COLOR_FORMAT_RGB565;
                     break;
                 case 24:
+#if LV_COLOR_DEPTH == 16
+                    /*Converted to RGB565 while reading to skip the conversion during drawing*/
+                    header->cf = LV_COLOR_FORMAT_RGB565;
+#else
                     header->cf = LV_COLOR_FORMAT_RGB888;
+#endif
                     break;
                 case 32:
                     header->cf = LV_COLOR_FORMAT_ARGB8888;
@@ -147,7 +158,7 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
         memset(&b, 0x00, sizeof(b));
 
         lv_fs_res_t res = lv_fs_open(&b.f, dsc->src, LV_FS_MODE_RD);
-        if(res == LV_RES_OK) return LV_RES_INV;
+        if(res != LV_FS_RES_OK) return LV_RES_INV;
 
         uint8_t header[54];
         lv_fs_read(&b.f, header, 54, NULL);
@@ -191,6 +202,14 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
     uint32_t p = b->px_offset + b->row_size_bytes * y;
     p += x * (b->bpp / 8);
     lv_fs_seek(&b->f, p, LV_FS_SEEK_SET);
+
+#if LV_COLOR_DEPTH == 16
+    if(b->bpp == 24) {
+        read_rgb888_as_rgb565(&b->f, len, buf);
+        return LV_RES_OK;
+    }
+#endif
+
     lv_fs_read(&b->f, buf, len * (b->bpp / 8), NULL);
 
     return LV_RES_OK;
@@ -209,4 +228,34 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
 
 }
 
+#if LV_COLOR_DEPTH == 16
+/**
+ * Read 24 bit pixels from the current position of a file and store them as RGB565
+ * @param f     pointer to an opened BMP file
+ * @param len   number of pixels to read
+ * @param buf   store the RGB565 pixels here
+ */
+static void read_rgb888_as_rgb565(lv_fs_file_t * f, lv_coord_t len, uint8_t * buf)
+{
+    uint8_t chunk[BMP_CONVERT_CHUNK_PX * 3];
+    uint16_t * dest = (uint16_t *)buf;
+
+    while(len > 0) {
+        lv_coord_t px_cnt = LV_MIN(len, BMP_CONVERT_CHUNK_PX);
+        lv_fs_read(f, chunk, px_cnt * 3, NULL);
+
+        /*The pixels are stored as B, G, R*/
+        const uint8_t * src = chunk;
+        lv_coord_t i;
+        for(i = 0; i < px_cnt; i++) {
+            *dest = ((src[2] & 0xF8) << 8) | ((src[1] & 0xFC) << 3) | (src[0] >> 3);
+            dest++;
+            src += 3;
+        }
+
+        len -= px_cnt;
+    }
+}
+#endif
+
 #endif /*LV_USE_BMP*/
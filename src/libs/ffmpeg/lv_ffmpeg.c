@@ -16,6 +16,10 @@
 #include <libavutil/timestamp.h>
 #include <libswscale/swscale.h>
 
+#if LV_FFMPEG_USE_THREAD
+    #include "../../osal/lv_os.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -33,23 +37,57 @@
 
 #define FRAME_DEF_REFR_PERIOD   33  /*[ms]*/
 
+#if LV_FFMPEG_USE_THREAD
+    #if LV_USE_OS == LV_OS_NONE
+        #error "LV_FFMPEG_USE_THREAD requires LV_USE_OS"
+    #endif
+
+    /*The decoded frames waiting in the queue and the shown frame*/
+    #define FRAME_BUF_CNT   (LV_FFMPEG_FRAME_QUEUE_CNT + 1)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_FFMPEG_USE_THREAD
+typedef struct {
+    uint8_t * data;
+    int64_t pts;    /*Presentation time relative to the start of the video [ms]*/
+} ffmpeg_frame_t;
+#endif
+
 struct ffmpeg_context_s {
     AVFormatContext * fmt_ctx;
     AVCodecContext * video_dec_ctx;
     AVStream * video_stream;
-    uint8_t * video_src_data[4];
     uint8_t * video_dst_data[4];
     struct SwsContext * sws_ctx;
     AVFrame * frame;
     AVPacket * pkt;
     int video_stream_idx;
-    int video_src_linesize[4];
     int video_dst_linesize[4];
+    int video_dst_width;            /*Size of the image buffers. Frames of other size are scaled to it*/
+    int video_dst_height;
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
+#if LV_FFMPEG_USE_THREAD
+    lv_thread_t thread;
+    lv_thread_sync_t sync;          /*Wakes up the decoder thread*/
+    lv_thread_sync_t exit_sync;     /*Signaled when the decoder thread has exited*/
+    lv_mutex_t mutex;               /*Protects the fields below*/
+    ffmpeg_frame_t frames[FRAME_BUF_CNT];
+    uint32_t queue_rd;              /*Index of the oldest decoded frame. The frame before it is shown*/
+    uint32_t queue_cnt;             /*Number of decoded frames waiting to be shown*/
+    uint32_t clock_start;           /*Tick when the first frame was (or would have been) shown*/
+    uint32_t pause_tick;            /*Tick when the playback was paused*/
+    int frame_period;               /*[ms]*/
+    bool paused;
+    bool seek_req;                  /*The decoder thread should restart from the beginning*/
+    bool eof;                       /*All frames are decoded*/
+    bool quit;                      /*The decoder thread should exit*/
+    bool at_start;                  /*No frame was shown since the last seek. Used only by the UI thread*/
+    bool drop_allowed;              /*A frame was queued since the last seek. Used only by the decoder thread*/
+#endif
 };
 
 #pragma pack(1)
@@ -81,6 +119,19 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
+static int ffmpeg_convert_frame(struct ffmpeg_context_s * ffmpeg_ctx, const AVFrame * frame, uint8_t * dst);
+static bool ffmpeg_yuv_fast_path(struct ffmpeg_context_s * ffmpeg_ctx, const AVFrame * frame);
+static void ffmpeg_yuv420_to_native(const AVFrame * frame, uint8_t * dst, int dst_linesize);
+
+#if LV_FFMPEG_USE_THREAD
+    static lv_res_t ffmpeg_thread_start(struct ffmpeg_context_s * ffmpeg_ctx);
+    static void ffmpeg_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx);
+    static void ffmpeg_thread_cb(void * user_data);
+    static int ffmpeg_thread_decode_packet(struct ffmpeg_context_s * ffmpeg_ctx);
+    static int ffmpeg_thread_queue_frame(struct ffmpeg_context_s * ffmpeg_ctx);
+    static void ffmpeg_thread_seek_start(struct ffmpeg_context_s * ffmpeg_ctx);
+    static uint32_t ffmpeg_thread_get_clock(struct ffmpeg_context_s * ffmpeg_ctx);
+#endif
 
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
@@ -95,6 +146,20 @@ const lv_obj_class_t lv_ffmpeg_player_class = {
     .base_class = &lv_img_class
 };
 
+/*Fixed point (8 bit fraction) YUV to RGB coefficients.
+ *Indexed by [BT.709 color space][full range]*/
+static const struct {
+    int16_t y;
+    int16_t rv;
+    int16_t gu;
+    int16_t gv;
+    int16_t bu;
+    uint8_t y_ofs;
+} yuv_coefs[2][2] = {
+    {{298, 409, 100, 208, 516, 16}, {256, 359, 88, 183, 454, 0}},   /*BT.601*/
+    {{298, 459, 55, 136, 541, 16}, {256, 403, 48, 120, 475, 0}},    /*BT.709*/
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -143,6 +208,10 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
 
     if(player->ffmpeg_ctx) {
+#if LV_FFMPEG_USE_THREAD
+        ffmpeg_thread_stop(player->ffmpeg_ctx);
+#endif
+        lv_img_cache_invalidate_src(&player->imgdsc);
         ffmpeg_close(player->ffmpeg_ctx);
         player->ffmpeg_ctx = NULL;
     }
@@ -159,37 +228,50 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     if(ffmpeg_image_allocate(player->ffmpeg_ctx) < 0) {
         LV_LOG_ERROR("ffmpeg image allocate failed");
         ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
         goto failed;
     }
 
     bool has_alpha = player->ffmpeg_ctx->has_alpha;
     int width = player->ffmpeg_ctx->video_dec_ctx->width;
     int height = player->ffmpeg_ctx->video_dec_ctx->height;
-    uint32_t data_size = 0;
-
-    data_size = width * height * 4;
-
+    lv_color_format_t cf = has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
 
     player->imgdsc.header.always_zero = 0;
     player->imgdsc.header.w = width;
     player->imgdsc.header.h = height;
-    player->imgdsc.data_size = data_size;
-    player->imgdsc.header.cf = has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+    player->imgdsc.data_size = width * height * lv_color_format_get_size(cf);
+    player->imgdsc.header.cf = cf;
     player->imgdsc.data = ffmpeg_get_img_data(player->ffmpeg_ctx);
 
-    lv_img_set_src(&player->img.obj, &(player->imgdsc));
-
     int period = ffmpeg_get_frame_refr_period(player->ffmpeg_ctx);
 
     if(period > 0) {
         LV_LOG_INFO("frame refresh period = %d ms, rate = %d fps",
                     period, 1000 / period);
-        lv_timer_set_period(player->timer, period);
     }
     else {
         LV_LOG_WARN("unable to get frame refresh period");
+        period = FRAME_DEF_REFR_PERIOD;
+    }
+
+#if LV_FFMPEG_USE_THREAD
+    player->ffmpeg_ctx->frame_period = period;
+    if(ffmpeg_thread_start(player->ffmpeg_ctx) != LV_RES_OK) {
+        LV_LOG_ERROR("ffmpeg decoder thread start failed");
+        ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
+        goto failed;
     }
 
+    /*Check the queue more often to show the frames close to their presentation time*/
+    lv_timer_set_period(player->timer, LV_MAX(period / 2, 1));
+#else
+    lv_timer_set_period(player->timer, period);
+#endif
+
+    lv_img_set_src(&player->img.obj, &(player->imgdsc));
+
     res = LV_RES_OK;
 
 failed:
@@ -208,6 +290,51 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
 
     lv_timer_t * timer = player->timer;
 
+#if LV_FFMPEG_USE_THREAD
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+    uint32_t now = lv_tick_get();
+
+    /*The decoder thread owns the FFmpeg contexts so just tell it what to do*/
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    switch(cmd) {
+        case LV_FFMPEG_PLAYER_CMD_START:
+            ffmpeg_thread_seek_start(ffmpeg_ctx);
+            ffmpeg_ctx->paused = false;
+            ffmpeg_ctx->clock_start = now;
+            lv_timer_resume(timer);
+            LV_LOG_INFO("ffmpeg player start");
+            break;
+        case LV_FFMPEG_PLAYER_CMD_STOP:
+            ffmpeg_thread_seek_start(ffmpeg_ctx);
+            ffmpeg_ctx->paused = true;
+            ffmpeg_ctx->clock_start = now;
+            ffmpeg_ctx->pause_tick = now;
+            lv_timer_pause(timer);
+            LV_LOG_INFO("ffmpeg player stop");
+            break;
+        case LV_FFMPEG_PLAYER_CMD_PAUSE:
+            if(!ffmpeg_ctx->paused) {
+                ffmpeg_ctx->paused = true;
+                ffmpeg_ctx->pause_tick = now;
+            }
+            lv_timer_pause(timer);
+            LV_LOG_INFO("ffmpeg player pause");
+            break;
+        case LV_FFMPEG_PLAYER_CMD_RESUME:
+            if(ffmpeg_ctx->paused) {
+                ffmpeg_ctx->paused = false;
+                ffmpeg_ctx->clock_start += now - ffmpeg_ctx->pause_tick;
+            }
+            lv_timer_resume(timer);
+            LV_LOG_INFO("ffmpeg player resume");
+            break;
+        default:
+            LV_LOG_ERROR("Error cmd: %d", cmd);
+            break;
+    }
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+#else
     switch(cmd) {
         case LV_FFMPEG_PLAYER_CMD_START:
             av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
@@ -233,6 +360,7 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
             LV_LOG_ERROR("Error cmd: %d", cmd);
             break;
     }
+#endif
 }
 
 void lv_ffmpeg_player_set_auto_restart(lv_obj_t * obj, bool en)
@@ -351,6 +479,174 @@ static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt)
     return !(desc->flags & AV_PIX_FMT_FLAG_RGB) && desc->nb_components >= 2;
 }
 
+/**
+ * Convert a decoded frame to the color format of the image
+ * @param ffmpeg_ctx    pointer to an FFmpeg context
+ * @param frame         the decoded frame
+ * @param dst           buffer for `width x height` pixels without padding
+ * @return              >= 0: success; < 0: error
+ */
+static int ffmpeg_convert_frame(struct ffmpeg_context_s * ffmpeg_ctx, const AVFrame * frame, uint8_t * dst)
+{
+    int width = ffmpeg_ctx->video_dst_width;
+    int height = ffmpeg_ctx->video_dst_height;
+    lv_color_format_t cf = ffmpeg_ctx->has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+    int dst_linesize = width * lv_color_format_get_size(cf);
+
+    /*The fast path converts `frame->width x frame->height` pixels so it can be used only if
+     *the resolution and the pixel format haven't changed mid-stream. Else swscale scales the frame.*/
+    bool frame_changed = frame->width != width || frame->height != height ||
+                         frame->width != ffmpeg_ctx->video_dec_ctx->width ||
+                         frame->height != ffmpeg_ctx->video_dec_ctx->height ||
+                         frame->format != ffmpeg_ctx->video_dec_ctx->pix_fmt;
+
+    if(!frame_changed && ffmpeg_yuv_fast_path(ffmpeg_ctx, frame)) {
+        ffmpeg_yuv420_to_native(frame, dst, dst_linesize);
+        return 0;
+    }
+
+    int swsFlags = SWS_BILINEAR;
+    if(ffmpeg_pix_fmt_is_yuv(frame->format)) {
+
+        /* When the video width and height are not multiples of 8,
+         * and there is no size change in the conversion,
+         * a blurry screen will appear on the right side
+         * This problem was discovered in 2012 and
+         * continues to exist in version 4.1.3 in 2019
+         * This problem can be avoided by increasing SWS_ACCURATE_RND
+         */
+        if((frame->width & 0x7) || (frame->height & 0x7)) {
+            if(ffmpeg_ctx->sws_ctx == NULL) {
+                LV_LOG_WARN("The width(%d) and height(%d) the image "
+                            "is not a multiple of 8, "
+                            "the decoding speed may be reduced",
+                            frame->width, frame->height);
+            }
+            swsFlags |= SWS_ACCURATE_RND;
+        }
+    }
+
+    /*The context is reused if the parameters haven't changed since the last frame*/
+    ffmpeg_ctx->sws_ctx = sws_getCachedContext(
+                              ffmpeg_ctx->sws_ctx,
+                              frame->width, frame->height, frame->format,
+                              width, height, ffmpeg_ctx->video_dst_pix_fmt,
+                              swsFlags,
+                              NULL, NULL, NULL);
+
+    if(ffmpeg_ctx->sws_ctx == NULL) {
+        LV_LOG_ERROR("sws_getCachedContext failed");
+        return -1;
+    }
+
+    /*swscale can read the planes of the frame directly, no need to copy them*/
+    uint8_t * dst_data[4] = {dst, NULL, NULL, NULL};
+    int dst_linesizes[4] = {dst_linesize, 0, 0, 0};
+
+    return sws_scale(
+               ffmpeg_ctx->sws_ctx,
+               (const uint8_t * const *)(frame->data),
+               frame->linesize,
+               0,
+               frame->height,
+               dst_data,
+               dst_linesizes);
+}
+
+/**
+ * Check if a frame can be converted by `ffmpeg_yuv420_to_native` instead of swscale
+ * @param ffmpeg_ctx    pointer to an FFmpeg context
+ * @param frame         the decoded frame
+ * @return              true: the fast conversion can be used
+ */
+static bool ffmpeg_yuv_fast_path(struct ffmpeg_context_s * ffmpeg_ctx, const AVFrame * frame)
+{
+#if LV_COLOR_DEPTH == 16 || LV_COLOR_DEPTH == 32
+    if(ffmpeg_ctx->has_alpha) return false;
+    return frame->format == AV_PIX_FMT_YUV420P || frame->format == AV_PIX_FMT_YUVJ420P;
+#else
+    LV_UNUSED(ffmpeg_ctx);
+    LV_UNUSED(frame);
+    return false;
+#endif
+}
+
+#if LV_COLOR_DEPTH == 16 || LV_COLOR_DEPTH == 32
+/**
+ * Create a pixel from fixed point (8 bit fraction) color components
+ */
+#if LV_COLOR_DEPTH == 16
+static inline uint16_t yuv_to_px(int32_t r, int32_t g, int32_t b)
+#else
+static inline uint32_t yuv_to_px(int32_t r, int32_t g, int32_t b)
+#endif
+{
+    r = LV_CLAMP(0, r >> 8, 255);
+    g = LV_CLAMP(0, g >> 8, 255);
+    b = LV_CLAMP(0, b >> 8, 255);
+#if LV_COLOR_DEPTH == 16
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+#else
+    return 0xFF000000 | (r << 16) | (g << 8) | b;
+#endif
+}
+#endif
+
+/**
+ * Convert a YUV420P frame to RGB565 or XRGB8888 with integer math.
+ * The chroma terms are calculated once for every 2 pixels.
+ * @param frame         a YUV420P or YUVJ420P frame
+ * @param dst           the destination buffer
+ * @param dst_linesize  the length of a line in `dst` in bytes
+ */
+static void ffmpeg_yuv420_to_native(const AVFrame * frame, uint8_t * dst, int dst_linesize)
+{
+#if LV_COLOR_DEPTH == 16 || LV_COLOR_DEPTH == 32
+    bool bt709 = frame->colorspace == AVCOL_SPC_BT709;
+    bool full_range = frame->color_range == AVCOL_RANGE_JPEG || frame->format == AV_PIX_FMT_YUVJ420P;
+    int32_t c_y = yuv_coefs[bt709][full_range].y;
+    int32_t c_rv = yuv_coefs[bt709][full_range].rv;
+    int32_t c_gu = yuv_coefs[bt709][full_range].gu;
+    int32_t c_gv = yuv_coefs[bt709][full_range].gv;
+    int32_t c_bu = yuv_coefs[bt709][full_range].bu;
+    int32_t y_ofs = yuv_coefs[bt709][full_range].y_ofs;
+
+    int32_t w = frame->width;
+    int32_t h = frame->height;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * y_row = frame->data[0] + y * frame->linesize[0];
+        const uint8_t * u_row = frame->data[1] + (y >> 1) * frame->linesize[1];
+        const uint8_t * v_row = frame->data[2] + (y >> 1) * frame->linesize[2];
+#if LV_COLOR_DEPTH == 16
+        uint16_t * dst_row = (uint16_t *)(dst + y * dst_linesize);
+#else
+        uint32_t * dst_row = (uint32_t *)(dst + y * dst_linesize);
+#endif
+
+        for(x = 0; x < w; x += 2) {
+            int32_t u = u_row[x >> 1] - 128;
+            int32_t v = v_row[x >> 1] - 128;
+            int32_t r_add = c_rv * v + 128;
+            int32_t g_add = -c_gu * u - c_gv * v + 128;
+            int32_t b_add = c_bu * u + 128;
+
+            int32_t luma = (y_row[x] - y_ofs) * c_y;
+            dst_row[x] = yuv_to_px(luma + r_add, luma + g_add, luma + b_add);
+            if(x + 1 < w) {
+                luma = (y_row[x + 1] - y_ofs) * c_y;
+                dst_row[x + 1] = yuv_to_px(luma + r_add, luma + g_add, luma + b_add);
+            }
+        }
+    }
+#else
+    LV_UNUSED(frame);
+    LV_UNUSED(dst);
+    LV_UNUSED(dst_linesize);
+#endif
+}
+
 static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 {
     int ret = -1;
@@ -381,60 +677,7 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 
     LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
 
-    /* copy decoded frame to destination buffer:
-     * this is required since rawvideo expects non aligned data
-     */
-    av_image_copy(ffmpeg_ctx->video_src_data, ffmpeg_ctx->video_src_linesize,
-                  (const uint8_t **)(frame->data), frame->linesize,
-                  ffmpeg_ctx->video_dec_ctx->pix_fmt, width, height);
-
-    if(ffmpeg_ctx->sws_ctx == NULL) {
-        int swsFlags = SWS_BILINEAR;
-
-        if(ffmpeg_pix_fmt_is_yuv(ffmpeg_ctx->video_dec_ctx->pix_fmt)) {
-
-            /* When the video width and height are not multiples of 8,
-             * and there is no size change in the conversion,
-             * a blurry screen will appear on the right side
-             * This problem was discovered in 2012 and
-             * continues to exist in version 4.1.3 in 2019
-             * This problem can be avoided by increasing SWS_ACCURATE_RND
-             */
-            if((width & 0x7) || (height & 0x7)) {
-                LV_LOG_WARN("The width(%d) and height(%d) the image "
-                            "is not a multiple of 8, "
-                            "the decoding speed may be reduced",
-                            width, height);
-                swsFlags |= SWS_ACCURATE_RND;
-            }
-        }
-
-        ffmpeg_ctx->sws_ctx = sws_getContext(
-                                  width, height, ffmpeg_ctx->video_dec_ctx->pix_fmt,
-                                  width, height, ffmpeg_ctx->video_dst_pix_fmt,
-                                  swsFlags,
-                                  NULL, NULL, NULL);
-    }
-
-    if(!ffmpeg_ctx->has_alpha) {
-        int lv_linesize = sizeof(lv_color_t) * width;
-        int dst_linesize = ffmpeg_ctx->video_dst_linesize[0];
-        if(dst_linesize != lv_linesize) {
-            LV_LOG_WARN("ffmpeg linesize = %d, but lvgl image require %d",
-                        dst_linesize,
-                        lv_linesize);
-            ffmpeg_ctx->video_dst_linesize[0] = lv_linesize;
-        }
-    }
-
-    ret = sws_scale(
-              ffmpeg_ctx->sws_ctx,
-              (const uint8_t * const *)(ffmpeg_ctx->video_src_data),
-              ffmpeg_ctx->video_src_linesize,
-              0,
-              height,
-              ffmpeg_ctx->video_dst_data,
-              ffmpeg_ctx->video_dst_linesize);
+    ret = ffmpeg_convert_frame(ffmpeg_ctx, frame, ffmpeg_ctx->video_dst_data[0]);
 
 failed:
     return ret;
@@ -697,22 +940,7 @@ static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx)
 {
     int ret;
 
-    /* allocate image where the decoded image will be put */
-    ret = av_image_alloc(
-              ffmpeg_ctx->video_src_data,
-              ffmpeg_ctx->video_src_linesize,
-              ffmpeg_ctx->video_dec_ctx->width,
-              ffmpeg_ctx->video_dec_ctx->height,
-              ffmpeg_ctx->video_dec_ctx->pix_fmt,
-              4);
-
-    if(ret < 0) {
-        LV_LOG_ERROR("Could not allocate src raw video buffer");
-        return ret;
-    }
-
-    LV_LOG_INFO("alloc video_src_bufsize = %d", ret);
-
+    /* allocate image where the converted image will be put */
     ret = av_image_alloc(
               ffmpeg_ctx->video_dst_data,
               ffmpeg_ctx->video_dst_linesize,
@@ -726,6 +954,9 @@ static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx)
         return ret;
     }
 
+    ffmpeg_ctx->video_dst_width = ffmpeg_ctx->video_dec_ctx->width;
+    ffmpeg_ctx->video_dst_height = ffmpeg_ctx->video_dec_ctx->height;
+
     LV_LOG_INFO("allocate video_dst_bufsize = %d", ret);
 
     ffmpeg_ctx->frame = av_frame_alloc();
@@ -753,10 +984,7 @@ static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
     avcodec_free_context(&(ffmpeg_ctx->video_dec_ctx));
     avformat_close_input(&(ffmpeg_ctx->fmt_ctx));
     av_frame_free(&(ffmpeg_ctx->frame));
-    if(ffmpeg_ctx->video_src_data[0] != NULL) {
-        av_free(ffmpeg_ctx->video_src_data[0]);
-        ffmpeg_ctx->video_src_data[0] = NULL;
-    }
+    av_packet_free(&(ffmpeg_ctx->pkt));
 }
 
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
@@ -782,6 +1010,247 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
     LV_LOG_INFO("ffmpeg_ctx closed");
 }
 
+#if LV_FFMPEG_USE_THREAD
+
+/**
+ * Allocate the frame buffers and start the decoder thread of a player
+ * @param ffmpeg_ctx    pointer to an FFmpeg context with allocated image
+ * @return              LV_RES_OK: the thread is started; LV_RES_INV: out of memory
+ */
+static lv_res_t ffmpeg_thread_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    lv_color_format_t cf = ffmpeg_ctx->has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+    size_t buf_size = ffmpeg_ctx->video_dst_width * ffmpeg_ctx->video_dst_height * lv_color_format_get_size(cf);
+
+    /*The already allocated image is the frame shown first*/
+    ffmpeg_ctx->frames[FRAME_BUF_CNT - 1].data = ffmpeg_ctx->video_dst_data[0];
+
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT - 1; i++) {
+        ffmpeg_ctx->frames[i].data = av_malloc(buf_size);
+        if(ffmpeg_ctx->frames[i].data == NULL) {
+            LV_LOG_ERROR("Could not allocate the frame queue");
+            for(; i > 0; i--) av_freep(&ffmpeg_ctx->frames[i - 1].data);
+            ffmpeg_ctx->frames[FRAME_BUF_CNT - 1].data = NULL;
+            return LV_RES_INV;
+        }
+    }
+
+    ffmpeg_ctx->queue_rd = 0;
+    ffmpeg_ctx->queue_cnt = 0;
+    ffmpeg_ctx->paused = true;
+    ffmpeg_ctx->clock_start = lv_tick_get();
+    ffmpeg_ctx->pause_tick = ffmpeg_ctx->clock_start;
+    ffmpeg_ctx->at_start = true;
+
+    lv_mutex_init(&ffmpeg_ctx->mutex);
+    lv_thread_sync_init(&ffmpeg_ctx->sync);
+    lv_thread_sync_init(&ffmpeg_ctx->exit_sync);
+    lv_thread_init(&ffmpeg_ctx->thread, LV_THREAD_PRIO_MID, ffmpeg_thread_cb, 64 * 1024, ffmpeg_ctx);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Stop the decoder thread of a player and free the frame buffers.
+ * @param ffmpeg_ctx    pointer to an FFmpeg context with a running thread
+ */
+static void ffmpeg_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    ffmpeg_ctx->quit = true;
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+    lv_thread_sync_wait(&ffmpeg_ctx->exit_sync);
+    lv_thread_delete(&ffmpeg_ctx->thread);
+
+    lv_mutex_delete(&ffmpeg_ctx->mutex);
+    lv_thread_sync_delete(&ffmpeg_ctx->sync);
+    lv_thread_sync_delete(&ffmpeg_ctx->exit_sync);
+
+    /*The last buffer is the image of the context and it's freed with it*/
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT - 1; i++) {
+        av_freep(&ffmpeg_ctx->frames[i].data);
+    }
+    ffmpeg_ctx->frames[FRAME_BUF_CNT - 1].data = NULL;
+}
+
+static void ffmpeg_thread_cb(void * user_data)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = user_data;
+
+    while(1) {
+        lv_mutex_lock(&ffmpeg_ctx->mutex);
+        bool quit = ffmpeg_ctx->quit;
+        bool seek = ffmpeg_ctx->seek_req;
+        bool eof = ffmpeg_ctx->eof;
+        ffmpeg_ctx->seek_req = false;
+        lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+        if(quit) break;
+
+        if(seek) {
+            av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+            avcodec_flush_buffers(ffmpeg_ctx->video_dec_ctx);
+            ffmpeg_ctx->drop_allowed = false;
+            continue;
+        }
+
+        /*Nothing to do until the next command*/
+        if(eof) {
+            lv_thread_sync_wait(&ffmpeg_ctx->sync);
+            continue;
+        }
+
+        if(ffmpeg_thread_decode_packet(ffmpeg_ctx) < 0) {
+            lv_mutex_lock(&ffmpeg_ctx->mutex);
+            /*Reaching the end of the old position doesn't matter after a seek*/
+            if(!ffmpeg_ctx->seek_req) ffmpeg_ctx->eof = true;
+            lv_mutex_unlock(&ffmpeg_ctx->mutex);
+        }
+    }
+
+    lv_thread_sync_signal(&ffmpeg_ctx->exit_sync);
+}
+
+/**
+ * Read the next packet and queue the video frames decoded from it.
+ * Called on the decoder thread.
+ * @param ffmpeg_ctx    pointer to an FFmpeg context
+ * @return              >= 0: success; < 0: end of file or error
+ */
+static int ffmpeg_thread_decode_packet(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    int ret = av_read_frame(ffmpeg_ctx->fmt_ctx, ffmpeg_ctx->pkt);
+    if(ret < 0) {
+        return ret;
+    }
+
+    /*Skip the packets of the other streams*/
+    if(ffmpeg_ctx->pkt->stream_index != ffmpeg_ctx->video_stream_idx) {
+        av_packet_unref(ffmpeg_ctx->pkt);
+        return 0;
+    }
+
+    ret = avcodec_send_packet(ffmpeg_ctx->video_dec_ctx, ffmpeg_ctx->pkt);
+    av_packet_unref(ffmpeg_ctx->pkt);
+    if(ret < 0) {
+        LV_LOG_ERROR("Error submitting a packet for decoding (%s)",
+                     av_err2str(ret));
+        return ret;
+    }
+
+    while(1) {
+        ret = avcodec_receive_frame(ffmpeg_ctx->video_dec_ctx, ffmpeg_ctx->frame);
+        if(ret == AVERROR_EOF || ret == AVERROR(EAGAIN)) {
+            return 0;
+        }
+        else if(ret < 0) {
+            LV_LOG_ERROR("Error during decoding (%s)", av_err2str(ret));
+            return ret;
+        }
+
+        ret = ffmpeg_thread_queue_frame(ffmpeg_ctx);
+        av_frame_unref(ffmpeg_ctx->frame);
+        if(ret < 0) {
+            return ret;
+        }
+    }
+}
+
+/**
+ * Convert the decoded frame into a free buffer and add it to the queue.
+ * Wait if the queue is full and drop the frame if it's already late.
+ * Called on the decoder thread.
+ * @param ffmpeg_ctx    pointer to an FFmpeg context with a decoded frame
+ * @return              >= 0: success; < 0: error
+ */
+static int ffmpeg_thread_queue_frame(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    AVFrame * frame = ffmpeg_ctx->frame;
+    AVStream * stream = ffmpeg_ctx->video_stream;
+
+    int64_t ts = frame->best_effort_timestamp;
+    if(ts == AV_NOPTS_VALUE) ts = frame->pts;
+    if(ts == AV_NOPTS_VALUE) ts = 0;
+    if(stream->start_time != AV_NOPTS_VALUE) ts -= stream->start_time;
+    AVRational ms_time_base = {1, 1000};
+    int64_t pts = av_rescale_q(ts, stream->time_base, ms_time_base);
+
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    while(ffmpeg_ctx->queue_cnt >= LV_FFMPEG_FRAME_QUEUE_CNT && !ffmpeg_ctx->seek_req && !ffmpeg_ctx->quit) {
+        lv_mutex_unlock(&ffmpeg_ctx->mutex);
+        lv_thread_sync_wait(&ffmpeg_ctx->sync);
+        lv_mutex_lock(&ffmpeg_ctx->mutex);
+    }
+
+    if(ffmpeg_ctx->seek_req || ffmpeg_ctx->quit) {
+        lv_mutex_unlock(&ffmpeg_ctx->mutex);
+        return 0;
+    }
+
+    /*Don't waste time on converting a frame which would be skipped anyway.
+     *Always show the first frame after a seek to have something on the screen.*/
+    bool late = ffmpeg_ctx->drop_allowed &&
+                pts + ffmpeg_ctx->frame_period < (int64_t)ffmpeg_thread_get_clock(ffmpeg_ctx);
+
+    /*Neither the queued frames nor the shown frame use this buffer*/
+    uint32_t wr = (ffmpeg_ctx->queue_rd + ffmpeg_ctx->queue_cnt) % FRAME_BUF_CNT;
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+    if(late) {
+        LV_LOG_TRACE("drop late frame, pts = %d ms", (int)pts);
+        return 0;
+    }
+
+    int ret = ffmpeg_convert_frame(ffmpeg_ctx, frame, ffmpeg_ctx->frames[wr].data);
+    if(ret < 0) {
+        return ret;
+    }
+
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    if(!ffmpeg_ctx->seek_req) {
+        ffmpeg_ctx->frames[wr].pts = pts;
+        ffmpeg_ctx->queue_cnt++;
+        ffmpeg_ctx->drop_allowed = true;
+    }
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+    return 0;
+}
+
+/**
+ * Drop the queued frames and ask the decoder thread to continue from the beginning.
+ * The mutex needs to be locked.
+ * @param ffmpeg_ctx    pointer to an FFmpeg context
+ */
+static void ffmpeg_thread_seek_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    /*The decoded frames are still valid if nothing was shown since the last seek.
+     *But if the end was reached without queuing any frame, start decoding again.*/
+    if(ffmpeg_ctx->at_start && !(ffmpeg_ctx->eof && ffmpeg_ctx->queue_cnt == 0)) return;
+
+    ffmpeg_ctx->seek_req = true;
+    ffmpeg_ctx->eof = false;
+    ffmpeg_ctx->queue_cnt = 0;
+    ffmpeg_ctx->at_start = true;
+}
+
+/**
+ * Get the time elapsed since the start of the video without the paused periods.
+ * The mutex needs to be locked.
+ * @param ffmpeg_ctx    pointer to an FFmpeg context
+ * @return              the playback clock [ms]
+ */
+static uint32_t ffmpeg_thread_get_clock(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    uint32_t now = ffmpeg_ctx->paused ? ffmpeg_ctx->pause_tick : lv_tick_get();
+    return now - ffmpeg_ctx->clock_start;
+}
+
+#endif /*LV_FFMPEG_USE_THREAD*/
+
 static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
 {
     lv_obj_t * obj = (lv_obj_t *)timer->user_data;
@@ -791,12 +1260,44 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
         return;
     }
 
+#if LV_FFMPEG_USE_THREAD
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+
+    /*Take the latest frame which is due and recycle the older ones*/
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    int64_t clock = ffmpeg_thread_get_clock(ffmpeg_ctx);
+    uint8_t * data = NULL;
+    while(ffmpeg_ctx->queue_cnt > 0 && ffmpeg_ctx->frames[ffmpeg_ctx->queue_rd].pts <= clock) {
+        data = ffmpeg_ctx->frames[ffmpeg_ctx->queue_rd].data;
+        ffmpeg_ctx->queue_rd = (ffmpeg_ctx->queue_rd + 1) % FRAME_BUF_CNT;
+        ffmpeg_ctx->queue_cnt--;
+        ffmpeg_ctx->at_start = false;
+    }
+    bool finished = ffmpeg_ctx->eof && ffmpeg_ctx->queue_cnt == 0;
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+    if(finished) {
+        lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
+        return;
+    }
+
+    if(data == NULL) {
+        return;
+    }
+
+    /*There is space in the queue again*/
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+
+    /*Just show the other buffer, the frame is not copied*/
+    player->imgdsc.data = data;
+#else
     int has_next = ffmpeg_update_next_frame(player->ffmpeg_ctx);
 
     if(has_next < 0) {
         lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
         return;
     }
+#endif
 
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
     lv_obj_invalidate(obj);
@@ -836,6 +1337,12 @@ static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p,
 
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
 
+#if LV_FFMPEG_USE_THREAD
+    if(player->ffmpeg_ctx) {
+        ffmpeg_thread_stop(player->ffmpeg_ctx);
+    }
+#endif
+
     ffmpeg_close(player->ffmpeg_ctx);
     player->ffmpeg_ctx = NULL;
 
@@ -17,6 +17,10 @@
 #include FT_IMAGE_H
 #include FT_OUTLINE_H
 
+#if LV_USE_OS
+    #include "../../osal/lv_os.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -32,6 +36,26 @@
     #error "LV_FREETYPE_CACHE_SIZE must > 0"
 #endif
 
+/*The glyph cache is split into shards with separate locks to let the draw units use it in parallel*/
+#if LV_USE_OS
+    #define GLYPH_CACHE_SHARDS      8
+#else
+    #define GLYPH_CACHE_SHARDS      1
+#endif
+#define GLYPH_CACHE_BUCKETS     32
+
+#if LV_USE_OS
+    #define FT_LOCK()               lv_mutex_lock(&ft_ctx.lock)
+    #define FT_UNLOCK()             lv_mutex_unlock(&ft_ctx.lock)
+    #define SHARD_LOCK(shard)       lv_mutex_lock(&(shard)->lock)
+    #define SHARD_UNLOCK(shard)     lv_mutex_unlock(&(shard)->lock)
+#else
+    #define FT_LOCK()
+    #define FT_UNLOCK()
+    #define SHARD_LOCK(shard)
+    #define SHARD_UNLOCK(shard)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,16 +70,44 @@ typedef struct _lv_freetype_context_t {
     FT_Library library;
     FTC_Manager cache_manager;
     FTC_CMapCache cmap_cache;
-    FT_Face current_face;
 #if LV_FREETYPE_SBIT_CACHE
     FTC_SBitCache sbit_cache;
-    FTC_SBit sbit;
 #else
     FTC_ImageCache image_cache;
-    FT_Glyph image_glyph;
+#endif
+#if LV_USE_OS
+    lv_mutex_t lock;    /*Protects the FreeType objects above*/
 #endif
 } lv_freetype_context_t;
 
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+/*A rendered glyph. Its A8 bitmap is stored right after the entry.*/
+typedef struct _lv_freetype_glyph_entry_t {
+    struct _lv_freetype_glyph_entry_t * hash_next;
+    struct _lv_freetype_glyph_entry_t * lru_prev;   /*More recently used*/
+    struct _lv_freetype_glyph_entry_t * lru_next;   /*Less recently used*/
+    const lv_freetype_font_dsc_t * font_dsc;
+    uint32_t letter;
+    uint32_t size;
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t is_placeholder : 1;
+} lv_freetype_glyph_entry_t;
+
+typedef struct {
+    lv_freetype_glyph_entry_t * buckets[GLYPH_CACHE_BUCKETS];
+    lv_freetype_glyph_entry_t * lru_head;
+    lv_freetype_glyph_entry_t * lru_tail;
+    uint32_t size;
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} lv_freetype_glyph_shard_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -68,6 +120,24 @@ static FT_Error freetype_get_bold_glyph(const lv_font_t * font,
                                         FT_Face face,
                                         FT_UInt glyph_index,
                                         lv_font_glyph_dsc_t * dsc_out);
+static bool freetype_load_glyph(const lv_font_t * font,
+                                uint32_t unicode_letter,
+                                lv_font_glyph_dsc_t * dsc_out,
+                                uint8_t * buf_out);
+static void copy_bitmap(uint8_t * buf_out, const uint8_t * src, int32_t pitch, uint32_t w, uint32_t h);
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+static lv_freetype_glyph_shard_t * glyph_cache_get_shard(const lv_freetype_font_dsc_t * font_dsc, uint32_t letter);
+static bool glyph_cache_get(const lv_freetype_font_dsc_t * font_dsc, uint32_t letter,
+                            lv_font_glyph_dsc_t * dsc_out, uint8_t * buf_out);
+static void glyph_cache_add(const lv_freetype_font_dsc_t * font_dsc, uint32_t letter,
+                            const lv_font_glyph_dsc_t * dsc, const uint8_t * bitmap, int32_t pitch);
+static void glyph_cache_drop(const lv_freetype_font_dsc_t * font_dsc);
+static void glyph_cache_remove(lv_freetype_glyph_shard_t * shard, lv_freetype_glyph_entry_t * entry);
+static lv_freetype_glyph_entry_t ** glyph_cache_get_bucket(lv_freetype_glyph_shard_t * shard,
+                                                           const lv_freetype_font_dsc_t * font_dsc, uint32_t letter);
+static void glyph_cache_lru_unlink(lv_freetype_glyph_shard_t * shard, lv_freetype_glyph_entry_t * entry);
+static void glyph_cache_lru_push(lv_freetype_glyph_shard_t * shard, lv_freetype_glyph_entry_t * entry);
+#endif
 static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
                                       lv_font_glyph_dsc_t * dsc_out,
                                       uint32_t unicode_letter,
@@ -81,6 +151,9 @@ static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font,
 **********************/
 
 static lv_freetype_context_t ft_ctx;
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+static lv_freetype_glyph_shard_t glyph_shards[GLYPH_CACHE_SHARDS];
+#endif
 
 /**********************
  *      MACROS
@@ -133,6 +206,19 @@ lv_res_t lv_freetype_init(uint16_t max_faces, uint16_t max_sizes, uint32_t max_b
     }
 #endif
 
+#if LV_USE_OS
+    lv_mutex_init(&ft_ctx.lock);
+#endif
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+    lv_memzero(glyph_shards, sizeof(glyph_shards));
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < GLYPH_CACHE_SHARDS; i++) {
+        lv_mutex_init(&glyph_shards[i].lock);
+    }
+#endif
+#endif
+
     return LV_RES_OK;
 failed:
     FTC_Manager_Done(ft_ctx.cache_manager);
@@ -142,8 +228,21 @@ failed:
 
 void lv_freetype_uninit(void)
 {
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+    glyph_cache_drop(NULL);
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < GLYPH_CACHE_SHARDS; i++) {
+        lv_mutex_delete(&glyph_shards[i].lock);
+    }
+#endif
+#endif
+
     FTC_Manager_Done(ft_ctx.cache_manager);
     FT_Done_FreeType(ft_ctx.library);
+#if LV_USE_OS
+    lv_mutex_delete(&ft_ctx.lock);
+#endif
 }
 
 lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16_t style)
@@ -187,10 +286,12 @@ lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16
     scaler.width = size;
     scaler.height = size;
     scaler.pixel = 1;
+    FT_LOCK();
     FT_Error error = FTC_Manager_LookupSize(ft_ctx.cache_manager,
                                             &scaler,
                                             &face_size);
     if(error) {
+        FT_UNLOCK();
         FT_ERROR_MSG("FTC_Manager_LookupSize", error);
         lv_free(dsc->pathname);
         lv_free(dsc);
@@ -209,6 +310,7 @@ lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16
     int8_t thickness = FT_MulFix(scale, face_size->face->underline_thickness) >> 6;
     font->underline_position = FT_MulFix(scale, face_size->face->underline_position) >> 6;
     font->underline_thickness = thickness < 1 ? 1 : thickness;
+    FT_UNLOCK();
 
     return font;
 }
@@ -218,7 +320,12 @@ void lv_freetype_font_del(lv_font_t * font)
     LV_ASSERT_NULL(font);
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
     LV_ASSERT_NULL(dsc);
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+    glyph_cache_drop(dsc);
+#endif
+    FT_LOCK();
     FTC_Manager_RemoveFaceID(ft_ctx.cache_manager, (FTC_FaceID)dsc);
+    FT_UNLOCK();
     lv_free(dsc->pathname);
     lv_free(dsc);
 }
@@ -290,7 +397,6 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
                                       uint32_t unicode_letter,
                                       uint32_t unicode_letter_next)
 {
-    LV_UNUSED(unicode_letter_next);
     if(unicode_letter < 0x20) {
         dsc_out->adv_w = 0;
         dsc_out->box_h = 0;
@@ -303,6 +409,60 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
 
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
 
+    bool found = false;
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+    found = glyph_cache_get(dsc, unicode_letter, dsc_out, NULL);
+#endif
+    if(!found) {
+        FT_LOCK();
+        found = freetype_load_glyph(font, unicode_letter, dsc_out, NULL);
+        FT_UNLOCK();
+        if(!found) return false;
+    }
+
+    if((dsc->style & LV_FREETYPE_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
+        dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
+    }
+
+    return true;
+}
+
+static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter, uint8_t * buf_out)
+{
+    LV_ASSERT_NULL(buf_out);
+
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
+    if(glyph_cache_get(dsc, unicode_letter, NULL, buf_out)) {
+        return buf_out;
+    }
+#endif
+
+    /*The glyph is looked up again as another thread might have used FreeType since its descriptor was read*/
+    lv_font_glyph_dsc_t g;
+    FT_LOCK();
+    bool found = freetype_load_glyph(font, unicode_letter, &g, buf_out);
+    FT_UNLOCK();
+
+    return found ? buf_out : NULL;
+}
+
+/**
+ * Get the descriptor of a glyph from FreeType and add it to the glyph cache.
+ * FreeType needs to be locked.
+ * @param font          a FreeType font
+ * @param unicode_letter the letter
+ * @param dsc_out       store the descriptor of the glyph here
+ * @param buf_out       copy the A8 bitmap of the glyph here if not NULL
+ * @return              true: the glyph was loaded
+ */
+static bool freetype_load_glyph(const lv_font_t * font,
+                                uint32_t unicode_letter,
+                                lv_font_glyph_dsc_t * dsc_out,
+                                uint8_t * buf_out)
+{
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
+
     FTC_FaceID face_id = (FTC_FaceID)dsc;
     FT_Size face_size;
     FT_Error error;
@@ -331,93 +491,261 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
         FT_Set_Transform(face, &italic_matrix, NULL);
     }
 
+    const uint8_t * bitmap;
+    int32_t pitch;
     if(dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) {
-        ft_ctx.current_face = face;
         error = freetype_get_bold_glyph(font, face, glyph_index, dsc_out);
         if(error) {
-            ft_ctx.current_face = NULL;
             return false;
         }
-        goto end;
+        if(face->glyph->format != FT_GLYPH_FORMAT_BITMAP) {
+            LV_LOG_ERROR("glyph->format != FT_GLYPH_FORMAT_BITMAP");
+            return false;
+        }
+        bitmap = face->glyph->bitmap.buffer;
+        pitch = face->glyph->bitmap.pitch;
     }
-
-    FTC_ImageTypeRec desc_type;
-    desc_type.face_id = face_id;
-    desc_type.flags = FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL;
-    desc_type.height = dsc->size;
-    desc_type.width = dsc->size;
+    else {
+        FTC_ImageTypeRec desc_type;
+        desc_type.face_id = face_id;
+        desc_type.flags = FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL;
+        desc_type.height = dsc->size;
+        desc_type.width = dsc->size;
 
 #if LV_FREETYPE_SBIT_CACHE
-    error = FTC_SBitCache_Lookup(ft_ctx.sbit_cache,
-                                 &desc_type,
-                                 glyph_index,
-                                 &ft_ctx.sbit,
-                                 NULL);
-    if(error) {
-        FT_ERROR_MSG("FTC_SBitCache_Lookup", error);
-        return false;
-    }
+        FTC_SBit sbit;
+        error = FTC_SBitCache_Lookup(ft_ctx.sbit_cache,
+                                     &desc_type,
+                                     glyph_index,
+                                     &sbit,
+                                     NULL);
+        if(error) {
+            FT_ERROR_MSG("FTC_SBitCache_Lookup", error);
+            return false;
+        }
 
-    FTC_SBit sbit = ft_ctx.sbit;
-    dsc_out->adv_w = sbit->xadvance;
-    dsc_out->box_h = sbit->height;  /*Height of the bitmap in [px]*/
-    dsc_out->box_w = sbit->width;   /*Width of the bitmap in [px]*/
-    dsc_out->ofs_x = sbit->left;    /*X offset of the bitmap in [pf]*/
-    dsc_out->ofs_y = sbit->top - sbit->height; /*Y offset of the bitmap measured from the as line*/
-    dsc_out->bpp = 8;               /*Bit per pixel: 1/2/4/8*/
+        dsc_out->adv_w = sbit->xadvance;
+        dsc_out->box_h = sbit->height;  /*Height of the bitmap in [px]*/
+        dsc_out->box_w = sbit->width;   /*Width of the bitmap in [px]*/
+        dsc_out->ofs_x = sbit->left;    /*X offset of the bitmap in [pf]*/
+        dsc_out->ofs_y = sbit->top - sbit->height; /*Y offset of the bitmap measured from the as line*/
+        dsc_out->bpp = 8;               /*Bit per pixel: 1/2/4/8*/
+        bitmap = sbit->buffer;
+        pitch = sbit->pitch;
 #else
-    error = FTC_ImageCache_Lookup(ft_ctx.image_cache,
-                                  &desc_type,
-                                  glyph_index,
-                                  &ft_ctx.image_glyph,
-                                  NULL);
-    if(error) {
-        FT_ERROR_MSG("ImageCache_Lookup", error);
-        return false;
+        FT_Glyph image_glyph;
+        error = FTC_ImageCache_Lookup(ft_ctx.image_cache,
+                                      &desc_type,
+                                      glyph_index,
+                                      &image_glyph,
+                                      NULL);
+        if(error) {
+            FT_ERROR_MSG("ImageCache_Lookup", error);
+            return false;
+        }
+        if(image_glyph->format != FT_GLYPH_FORMAT_BITMAP) {
+            LV_LOG_ERROR("image_glyph->format != FT_GLYPH_FORMAT_BITMAP");
+            return false;
+        }
+
+        FT_BitmapGlyph glyph_bitmap = (FT_BitmapGlyph)image_glyph;
+        dsc_out->adv_w = (glyph_bitmap->root.advance.x >> 16);
+        dsc_out->box_h = glyph_bitmap->bitmap.rows;         /*Height of the bitmap in [px]*/
+        dsc_out->box_w = glyph_bitmap->bitmap.width;        /*Width of the bitmap in [px]*/
+        dsc_out->ofs_x = glyph_bitmap->left;                /*X offset of the bitmap in [pf]*/
+        dsc_out->ofs_y = glyph_bitmap->top -
+                         glyph_bitmap->bitmap.rows;         /*Y offset of the bitmap measured from the as line*/
+        dsc_out->bpp = 8;         /*Bit per pixel: 1/2/4/8*/
+        bitmap = glyph_bitmap->bitmap.buffer;
+        pitch = glyph_bitmap->bitmap.pitch;
+#endif
     }
-    if(ft_ctx.image_glyph->format != FT_GLYPH_FORMAT_BITMAP) {
-        LV_LOG_ERROR("image_glyph->format != FT_GLYPH_FORMAT_BITMAP");
-        return false;
+
+    if(buf_out) {
+        copy_bitmap(buf_out, bitmap, pitch, dsc_out->box_w, dsc_out->box_h);
     }
 
-    FT_BitmapGlyph glyph_bitmap = (FT_BitmapGlyph)ft_ctx.image_glyph;
-    dsc_out->adv_w = (glyph_bitmap->root.advance.x >> 16);
-    dsc_out->box_h = glyph_bitmap->bitmap.rows;         /*Height of the bitmap in [px]*/
-    dsc_out->box_w = glyph_bitmap->bitmap.width;        /*Width of the bitmap in [px]*/
-    dsc_out->ofs_x = glyph_bitmap->left;                /*X offset of the bitmap in [pf]*/
-    dsc_out->ofs_y = glyph_bitmap->top -
-                     glyph_bitmap->bitmap.rows;         /*Y offset of the bitmap measured from the as line*/
-    dsc_out->bpp = 8;         /*Bit per pixel: 1/2/4/8*/
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+    glyph_cache_add(dsc, unicode_letter, dsc_out, bitmap, pitch);
 #endif
 
-end:
-    if((dsc->style & LV_FREETYPE_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
-        dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
+    return true;
+}
+
+/**
+ * Copy the rows of a FreeType bitmap to a continuous A8 buffer
+ */
+static void copy_bitmap(uint8_t * buf_out, const uint8_t * src, int32_t pitch, uint32_t w, uint32_t h)
+{
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        lv_memcpy(buf_out, src, w);
+        buf_out += w;
+        src += pitch;
     }
+}
+
+#if LV_FREETYPE_GLYPH_CACHE_SIZE
+
+static lv_freetype_glyph_shard_t * glyph_cache_get_shard(const lv_freetype_font_dsc_t * font_dsc, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font_dsc >> 4) ^ (letter * 2654435761U);
+    return &glyph_shards[(h >> 16) % GLYPH_CACHE_SHARDS];
+}
+
+static lv_freetype_glyph_entry_t ** glyph_cache_get_bucket(lv_freetype_glyph_shard_t * shard,
+                                                           const lv_freetype_font_dsc_t * font_dsc, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font_dsc >> 4) ^ (letter * 2654435761U);
+    return &shard->buckets[h % GLYPH_CACHE_BUCKETS];
+}
+
+static void glyph_cache_lru_unlink(lv_freetype_glyph_shard_t * shard, lv_freetype_glyph_entry_t * entry)
+{
+    if(entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else shard->lru_head = entry->lru_next;
+    if(entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else shard->lru_tail = entry->lru_prev;
+}
+
+static void glyph_cache_lru_push(lv_freetype_glyph_shard_t * shard, lv_freetype_glyph_entry_t * entry)
+{
+    entry->lru_prev = NULL;
+    entry->lru_next = shard->lru_head;
+    if(shard->lru_head) shard->lru_head->lru_prev = entry;
+    else shard->lru_tail = entry;
+    shard->lru_head = entry;
+}
+
+/**
+ * Find a glyph in the glyph cache. Doesn't need FreeType to be locked.
+ * @param font_dsc      descriptor of the font
+ * @param letter        the letter
+ * @param dsc_out       store the descriptor of the glyph here if not NULL
+ * @param buf_out       copy the A8 bitmap of the glyph here if not NULL
+ * @return              true: the glyph was found in the cache
+ */
+static bool glyph_cache_get(const lv_freetype_font_dsc_t * font_dsc, uint32_t letter,
+                            lv_font_glyph_dsc_t * dsc_out, uint8_t * buf_out)
+{
+    lv_freetype_glyph_shard_t * shard = glyph_cache_get_shard(font_dsc, letter);
+    SHARD_LOCK(shard);
 
+    lv_freetype_glyph_entry_t * entry = *glyph_cache_get_bucket(shard, font_dsc, letter);
+    while(entry) {
+        if(entry->font_dsc == font_dsc && entry->letter == letter) break;
+        entry = entry->hash_next;
+    }
+
+    if(entry == NULL) {
+        SHARD_UNLOCK(shard);
+        return false;
+    }
+
+    if(dsc_out) {
+        dsc_out->adv_w = entry->adv_w;
+        dsc_out->box_w = entry->box_w;
+        dsc_out->box_h = entry->box_h;
+        dsc_out->ofs_x = entry->ofs_x;
+        dsc_out->ofs_y = entry->ofs_y;
+        dsc_out->bpp = 8;
+        dsc_out->is_placeholder = entry->is_placeholder;
+    }
+    if(buf_out) {
+        lv_memcpy(buf_out, entry + 1, (uint32_t)entry->box_w * entry->box_h);
+    }
+
+    if(shard->lru_head != entry) {
+        glyph_cache_lru_unlink(shard, entry);
+        glyph_cache_lru_push(shard, entry);
+    }
+
+    SHARD_UNLOCK(shard);
     return true;
 }
 
-static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter, uint8_t * buf_out)
+static void glyph_cache_add(const lv_freetype_font_dsc_t * font_dsc, uint32_t letter,
+                            const lv_font_glyph_dsc_t * dsc, const uint8_t * bitmap, int32_t pitch)
 {
-    LV_UNUSED(unicode_letter);
-    LV_UNUSED(buf_out);
+    uint32_t bitmap_size = (uint32_t)dsc->box_w * dsc->box_h;
+    uint32_t size = sizeof(lv_freetype_glyph_entry_t) + bitmap_size;
+    const uint32_t max_size = LV_FREETYPE_GLYPH_CACHE_SIZE / GLYPH_CACHE_SHARDS;
+    if(size > max_size) return;
+
+    lv_freetype_glyph_shard_t * shard = glyph_cache_get_shard(font_dsc, letter);
+    lv_freetype_glyph_entry_t ** bucket = glyph_cache_get_bucket(shard, font_dsc, letter);
+    SHARD_LOCK(shard);
+
+    /*Another thread might have added it since it wasn't found*/
+    lv_freetype_glyph_entry_t * entry = *bucket;
+    while(entry) {
+        if(entry->font_dsc == font_dsc && entry->letter == letter) {
+            SHARD_UNLOCK(shard);
+            return;
+        }
+        entry = entry->hash_next;
+    }
 
-    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
-    if(dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) {
-        if(ft_ctx.current_face && ft_ctx.current_face->glyph->format == FT_GLYPH_FORMAT_BITMAP) {
-            return (const uint8_t *)(ft_ctx.current_face->glyph->bitmap.buffer);
+    while(shard->lru_tail && shard->size + size > max_size) {
+        glyph_cache_remove(shard, shard->lru_tail);
+    }
+
+    entry = lv_malloc(size);
+    if(entry == NULL) {
+        SHARD_UNLOCK(shard);
+        return;
+    }
+
+    entry->font_dsc = font_dsc;
+    entry->letter = letter;
+    entry->size = size;
+    entry->adv_w = dsc->adv_w;
+    entry->box_w = dsc->box_w;
+    entry->box_h = dsc->box_h;
+    entry->ofs_x = dsc->ofs_x;
+    entry->ofs_y = dsc->ofs_y;
+    entry->is_placeholder = dsc->is_placeholder;
+    copy_bitmap((uint8_t *)(entry + 1), bitmap, pitch, dsc->box_w, dsc->box_h);
+
+    entry->hash_next = *bucket;
+    *bucket = entry;
+    glyph_cache_lru_push(shard, entry);
+    shard->size += size;
+
+    SHARD_UNLOCK(shard);
+}
+
+/**
+ * Remove the glyphs of a font from the glyph cache
+ * @param font_dsc      descriptor of the font or NULL to remove all glyphs
+ */
+static void glyph_cache_drop(const lv_freetype_font_dsc_t * font_dsc)
+{
+    uint32_t i;
+    for(i = 0; i < GLYPH_CACHE_SHARDS; i++) {
+        lv_freetype_glyph_shard_t * shard = &glyph_shards[i];
+        SHARD_LOCK(shard);
+        lv_freetype_glyph_entry_t * entry = shard->lru_head;
+        while(entry) {
+            lv_freetype_glyph_entry_t * next = entry->lru_next;
+            if(font_dsc == NULL || entry->font_dsc == font_dsc) glyph_cache_remove(shard, entry);
+            entry = next;
         }
-        return NULL;
+        SHARD_UNLOCK(shard);
     }
+}
 
-#if LV_FREETYPE_SBIT_CACHE
-    return (const uint8_t *)ft_ctx.sbit->buffer;
-#else
-    FT_BitmapGlyph glyph_bitmap = (FT_BitmapGlyph)ft_ctx.image_glyph;
-    return (const uint8_t *)glyph_bitmap->bitmap.buffer;
-#endif
+static void glyph_cache_remove(lv_freetype_glyph_shard_t * shard, lv_freetype_glyph_entry_t * entry)
+{
+    lv_freetype_glyph_entry_t ** p = glyph_cache_get_bucket(shard, entry->font_dsc, entry->letter);
+    while(*p != entry) p = &(*p)->hash_next;
+    *p = entry->hash_next;
+    glyph_cache_lru_unlink(shard, entry);
+    shard->size -= entry->size;
+    lv_free(entry);
 }
 
+#endif /*LV_FREETYPE_GLYPH_CACHE_SIZE*/
+
 #endif /*LV_USE_FREETYPE*/
 
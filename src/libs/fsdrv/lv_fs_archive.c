@@ -0,0 +1,657 @@
+/**
+ * @file lv_fs_archive.c
+ * Read-only driver for asset archives created by `scripts/fs_archive_pack.py`.
+ *
+ * Layout of the archive (little endian):
+ * - header: "LVAR" magic, version (u16), alignment of the data (u16), number of entries (u32),
+ *           size of the name table (u32)
+ * - entries sorted by name: name offset, data offset, stored size, original size (u32 each),
+ *           compression (u8), 3 reserved bytes
+ * - name table: '\0' terminated paths relative to the root of the archive, e.g. "img/logo.bin"
+ * - data of the entries, each aligned to the alignment in the header
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+
+#if LV_USE_FS_ARCHIVE
+
+#include "../../osal/lv_os.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_FS_ARCHIVE_LETTER == '\0'
+    #error "LV_FS_ARCHIVE_LETTER must be an upper case ASCII letter"
+#endif
+
+#define ARCHIVE_MAGIC       0x5241564C  /*"LVAR"*/
+#define ARCHIVE_VERSION     1
+
+#define COMPRESSION_NONE    0
+#define COMPRESSION_LZ4     1
+
+#if LV_USE_OS
+    #define ARCHIVE_LOCK()      lv_mutex_lock(&archive.lock)
+    #define ARCHIVE_UNLOCK()    lv_mutex_unlock(&archive.lock)
+#else
+    #define ARCHIVE_LOCK()
+    #define ARCHIVE_UNLOCK()
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t align;
+    uint32_t entry_cnt;
+    uint32_t names_size;
+} archive_header_t;
+
+typedef struct {
+    uint32_t name_ofs;
+    uint32_t data_ofs;
+    uint32_t size;          /*Size of the stored data*/
+    uint32_t orig_size;     /*Size of the file after decompression*/
+    uint8_t compression;
+    uint8_t reserved[3];
+} archive_entry_t;
+
+typedef struct {
+    lv_fs_file_t file;
+    const uint8_t * map;            /*The whole archive if the driver could map it*/
+    uint32_t map_size;
+    uint8_t * index_buf;            /*Header, entries and names if the archive is not mapped*/
+    const archive_entry_t * entries;
+    const char * names;
+    uint32_t entry_cnt;
+    bool mounted;
+#if LV_USE_OS
+    lv_mutex_t lock;                /*Protects the position of `file`*/
+#endif
+} archive_t;
+
+typedef struct {
+    const archive_entry_t * entry;
+    uint32_t pos;
+    uint8_t * data;                 /*Decompressed content of compressed entries*/
+} archive_file_t;
+
+typedef struct {
+    uint32_t idx;
+    uint32_t prefix_len;
+    char prefix[LV_FS_MAX_PATH_LENGTH];
+    char last_dir[LV_FS_MAX_PATH_LENGTH];
+} archive_dir_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
+static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p);
+static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
+static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** data_p, uint32_t * size_p);
+static lv_fs_res_t fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * data, uint32_t size);
+static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
+static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn);
+static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
+
+static lv_fs_res_t load_index(uint32_t file_size);
+static uint32_t lower_bound(const char * name);
+static lv_fs_res_t read_stored(const archive_entry_t * entry, uint32_t pos, void * buf, uint32_t btr);
+static bool lz4_decompress(const uint8_t * src, uint32_t src_size, uint8_t * dst, uint32_t dst_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static archive_t archive;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Register a driver for the File system interface
+ */
+void lv_fs_archive_init(void)
+{
+    /*---------------------------------------------------
+     * Register the file system interface in LVGL
+     *--------------------------------------------------*/
+
+    /*Add a simple drive to open images*/
+    static lv_fs_drv_t fs_drv; /*A driver descriptor*/
+    lv_fs_drv_init(&fs_drv);
+
+    /*Set up fields...*/
+    fs_drv.letter = LV_FS_ARCHIVE_LETTER;
+    fs_drv.cache_size = 0;
+    fs_drv.no_block_cache = true;   /*The archive file itself can be cached*/
+
+    fs_drv.open_cb = fs_open;
+    fs_drv.close_cb = fs_close;
+    fs_drv.read_cb = fs_read;
+    fs_drv.seek_cb = fs_seek;
+    fs_drv.tell_cb = fs_tell;
+    fs_drv.map_cb = fs_map;
+    fs_drv.unmap_cb = fs_unmap;
+
+    fs_drv.dir_close_cb = fs_dir_close;
+    fs_drv.dir_open_cb = fs_dir_open;
+    fs_drv.dir_read_cb = fs_dir_read;
+
+    lv_fs_drv_register(&fs_drv);
+}
+
+lv_fs_res_t lv_fs_archive_mount(const char * path)
+{
+    if(archive.mounted) lv_fs_archive_unmount();
+
+    lv_fs_res_t res = lv_fs_open(&archive.file, path, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("couldn't open %s", path);
+        return res;
+    }
+
+    uint32_t file_size = 0;
+    const void * map;
+    if(lv_fs_map(&archive.file, &map, &archive.map_size) == LV_FS_RES_OK) {
+        archive.map = map;
+        file_size = archive.map_size;
+    }
+    else {
+        res = lv_fs_seek(&archive.file, 0, LV_FS_SEEK_END);
+        if(res == LV_FS_RES_OK) res = lv_fs_tell(&archive.file, &file_size);
+    }
+
+    if(res == LV_FS_RES_OK) res = load_index(file_size);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("%s is not a valid archive", path);
+        if(archive.map) lv_fs_unmap(&archive.file, archive.map, archive.map_size);
+        lv_fs_close(&archive.file);
+        lv_free(archive.index_buf);
+        lv_memzero(&archive, sizeof(archive));
+        return res;
+    }
+
+#if LV_USE_OS
+    lv_mutex_init(&archive.lock);
+#endif
+    archive.mounted = true;
+    return LV_FS_RES_OK;
+}
+
+void lv_fs_archive_unmount(void)
+{
+    if(!archive.mounted) return;
+
+    if(archive.map) lv_fs_unmap(&archive.file, archive.map, archive.map_size);
+    lv_fs_close(&archive.file);
+    lv_free(archive.index_buf);
+#if LV_USE_OS
+    lv_mutex_delete(&archive.lock);
+#endif
+    lv_memzero(&archive, sizeof(archive));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Open a file
+ * @param drv pointer to a driver where this function belongs
+ * @param path path of the file in the archive (e.g. folder/file.txt)
+ * @param mode only FS_MODE_RD is supported
+ * @return a file handle or NULL in case of fail
+ */
+static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+
+    if(!archive.mounted || mode != LV_FS_MODE_RD) return NULL;
+
+    while(*path == '/') path++;
+    uint32_t idx = lower_bound(path);
+    if(idx >= archive.entry_cnt || strcmp(archive.names + archive.entries[idx].name_ofs, path) != 0) return NULL;
+
+    archive_file_t * f = lv_malloc(sizeof(archive_file_t));
+    LV_ASSERT_MALLOC(f);
+    if(f == NULL) return NULL;
+
+    f->entry = &archive.entries[idx];
+    f->pos = 0;
+    f->data = NULL;
+
+    if(f->entry->compression == COMPRESSION_LZ4) {
+        /*Decompress the whole file as LZ4 blocks can't be decompressed from the middle*/
+        f->data = lv_malloc(f->entry->orig_size ? f->entry->orig_size : 1);
+        const uint8_t * src = NULL;
+        uint8_t * src_buf = NULL;
+        if(f->data) {
+            if(archive.map) {
+                src = archive.map + f->entry->data_ofs;
+            }
+            else {
+                src_buf = lv_malloc(f->entry->size);
+                if(src_buf && read_stored(f->entry, 0, src_buf, f->entry->size) == LV_FS_RES_OK) src = src_buf;
+            }
+        }
+
+        bool ok = src && lz4_decompress(src, f->entry->size, f->data, f->entry->orig_size);
+        lv_free(src_buf);
+        if(!ok) {
+            LV_LOG_WARN("couldn't decompress %s", path);
+            lv_free(f->data);
+            lv_free(f);
+            return NULL;
+        }
+    }
+
+    return f;
+}
+
+/**
+ * Close an opened file
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle. (opened with fs_open)
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    archive_file_t * f = file_p;
+    lv_free(f->data);
+    lv_free(f);
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Read data from an opened file
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable.
+ * @param buf pointer to a memory block where to store the read data
+ * @param btr number of Bytes To Read
+ * @param br the real number of read bytes (Byte Read)
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    archive_file_t * f = file_p;
+
+    uint32_t remaining = f->entry->orig_size - f->pos;
+    if(btr > remaining) btr = remaining;
+
+    lv_fs_res_t res = LV_FS_RES_OK;
+    if(f->data) lv_memcpy(buf, f->data + f->pos, btr);
+    else if(archive.map) lv_memcpy(buf, archive.map + f->entry->data_ofs + f->pos, btr);
+    else if(btr) res = read_stored(f->entry, f->pos, buf, btr);
+
+    if(res != LV_FS_RES_OK) btr = 0;
+    f->pos += btr;
+    *br = btr;
+    return res;
+}
+
+/**
+ * Set the read pointer.
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable. (opened with fs_open )
+ * @param pos the new position of read pointer
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    archive_file_t * f = file_p;
+    uint32_t new_pos;
+    switch(whence) {
+        case LV_FS_SEEK_SET:
+            new_pos = pos;
+            break;
+        case LV_FS_SEEK_CUR:
+            new_pos = f->pos + pos;
+            break;
+        case LV_FS_SEEK_END:
+            new_pos = f->entry->orig_size + pos;
+            break;
+        default:
+            return LV_FS_RES_INV_PARAM;
+    }
+
+    if(new_pos > f->entry->orig_size) new_pos = f->entry->orig_size;
+    f->pos = new_pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Give the position of the read pointer
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable.
+ * @param pos_p pointer to to store the result
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+    archive_file_t * f = file_p;
+    *pos_p = f->pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Give the content of a file without copying it. It works if the archive is mapped
+ * or if the file is compressed (it was decompressed when it was opened).
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable.
+ * @param data_p pointer to store the address of the content
+ * @param size_p pointer to store the size of the file
+ * @return LV_FS_RES_OK: no error, LV_FS_RES_NOT_IMP: the file can't be mapped
+ */
+static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** data_p, uint32_t * size_p)
+{
+    LV_UNUSED(drv);
+    archive_file_t * f = file_p;
+
+    if(f->data) *data_p = f->data;
+    else if(archive.map) *data_p = archive.map + f->entry->data_ofs;
+    else return LV_FS_RES_NOT_IMP;
+
+    *size_p = f->entry->orig_size;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Release the content returned by `fs_map`. Nothing to do as it belongs to the archive or to the file.
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable.
+ * @param data address of the content
+ * @param size size of the file
+ * @return LV_FS_RES_OK
+ */
+static lv_fs_res_t fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * data, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    LV_UNUSED(data);
+    LV_UNUSED(size);
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Initialize a 'archive_dir_t' variable for directory reading
+ * @param drv pointer to a driver where this function belongs
+ * @param path path to a directory in the archive. "" or "/" for the root.
+ * @return pointer to an initialized 'archive_dir_t' variable or NULL if the directory doesn't exist
+ */
+static void * fs_dir_open(lv_fs_drv_t * drv, const char * path)
+{
+    LV_UNUSED(drv);
+
+    if(!archive.mounted) return NULL;
+
+    while(*path == '/') path++;
+    uint32_t len = lv_strlen(path);
+    while(len > 0 && path[len - 1] == '/') len--;
+    if(len + 2 > LV_FS_MAX_PATH_LENGTH) return NULL;
+
+    archive_dir_t * dir = lv_malloc(sizeof(archive_dir_t));
+    LV_ASSERT_MALLOC(dir);
+    if(dir == NULL) return NULL;
+
+    /*The entries of the directory start with "path/"*/
+    lv_memcpy(dir->prefix, path, len);
+    if(len) dir->prefix[len++] = '/';
+    dir->prefix[len] = '\0';
+    dir->prefix_len = len;
+    dir->last_dir[0] = '\0';
+    dir->idx = lower_bound(dir->prefix);
+
+    if(len && (dir->idx >= archive.entry_cnt ||
+               strncmp(archive.names + archive.entries[dir->idx].name_ofs, dir->prefix, len) != 0)) {
+        lv_free(dir);
+        return NULL;
+    }
+
+    return dir;
+}
+
+/**
+ * Read the next filename from a directory.
+ * The name of the directories will begin with '/'
+ * @param drv pointer to a driver where this function belongs
+ * @param dir_p pointer to an initialized 'archive_dir_t' variable
+ * @param fn pointer to a buffer to store the filename
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn)
+{
+    LV_UNUSED(drv);
+    archive_dir_t * dir = dir_p;
+
+    fn[0] = '\0';
+
+    /*The entries are sorted by name so the content of a directory is contiguous*/
+    while(dir->idx < archive.entry_cnt) {
+        const char * name = archive.names + archive.entries[dir->idx].name_ofs;
+        if(strncmp(name, dir->prefix, dir->prefix_len) != 0) break;
+        dir->idx++;
+
+        name += dir->prefix_len;
+        const char * slash = strchr(name, '/');
+        if(slash == NULL) {
+            lv_snprintf(fn, LV_FS_MAX_PATH_LENGTH, "%s", name);
+            return LV_FS_RES_OK;
+        }
+
+        /*The file is in a sub directory. Report the sub directory once.*/
+        uint32_t dir_len = slash - name;
+        if(dir_len + 1 >= LV_FS_MAX_PATH_LENGTH) continue;
+        if(strncmp(dir->last_dir, name, dir_len) == 0 && dir->last_dir[dir_len] == '\0') continue;
+
+        lv_memcpy(dir->last_dir, name, dir_len);
+        dir->last_dir[dir_len] = '\0';
+        lv_snprintf(fn, LV_FS_MAX_PATH_LENGTH, "/%s", dir->last_dir);
+        return LV_FS_RES_OK;
+    }
+
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Close the directory reading
+ * @param drv pointer to a driver where this function belongs
+ * @param dir_p pointer to an initialized 'archive_dir_t' variable
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p)
+{
+    LV_UNUSED(drv);
+    lv_free(dir_p);
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Set the entries and the names from the map or read them from the file and check them.
+ * @param file_size size of the archive
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t load_index(uint32_t file_size)
+{
+    archive_header_t header;
+    if(file_size < sizeof(header)) return LV_FS_RES_INV_PARAM;
+
+    uint32_t br;
+    if(archive.map) {
+        lv_memcpy(&header, archive.map, sizeof(header));
+    }
+    else {
+        lv_fs_res_t res = lv_fs_seek(&archive.file, 0, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(&archive.file, &header, sizeof(header), &br);
+        if(res != LV_FS_RES_OK) return res;
+        if(br != sizeof(header)) return LV_FS_RES_INV_PARAM;
+    }
+
+    if(header.magic != ARCHIVE_MAGIC || header.version != ARCHIVE_VERSION) return LV_FS_RES_INV_PARAM;
+
+    uint64_t index_size = sizeof(header) + (uint64_t)header.entry_cnt * sizeof(archive_entry_t) + header.names_size;
+    if(index_size > file_size || header.names_size == 0) return LV_FS_RES_INV_PARAM;
+
+    const uint8_t * index;
+    if(archive.map) {
+        index = archive.map;
+    }
+    else {
+        archive.index_buf = lv_malloc((uint32_t)index_size);
+        LV_ASSERT_MALLOC(archive.index_buf);
+        if(archive.index_buf == NULL) return LV_FS_RES_OUT_OF_MEM;
+
+        lv_fs_res_t res = lv_fs_seek(&archive.file, 0, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(&archive.file, archive.index_buf, (uint32_t)index_size, &br);
+        if(res != LV_FS_RES_OK) return res;
+        if(br != index_size) return LV_FS_RES_INV_PARAM;
+        index = archive.index_buf;
+    }
+
+    archive.entries = (const archive_entry_t *)(index + sizeof(header));
+    archive.names = (const char *)(archive.entries + header.entry_cnt);
+    archive.entry_cnt = header.entry_cnt;
+
+    /*Check the entries to not read out of the archive later*/
+    if(archive.names[header.names_size - 1] != '\0') return LV_FS_RES_INV_PARAM;
+    uint32_t i;
+    for(i = 0; i < archive.entry_cnt; i++) {
+        const archive_entry_t * e = &archive.entries[i];
+        if(e->name_ofs >= header.names_size) return LV_FS_RES_INV_PARAM;
+        if((uint64_t)e->data_ofs + e->size > file_size) return LV_FS_RES_INV_PARAM;
+        if(e->compression == COMPRESSION_NONE && e->size != e->orig_size) return LV_FS_RES_INV_PARAM;
+        if(e->compression > COMPRESSION_LZ4) return LV_FS_RES_INV_PARAM;
+    }
+
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Find the first entry whose name is not less than `name`
+ * @param name a path in the archive
+ * @return index of the entry or `entry_cnt` if all names are less
+ */
+static uint32_t lower_bound(const char * name)
+{
+    uint32_t lo = 0;
+    uint32_t hi = archive.entry_cnt;
+    while(lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if(strcmp(archive.names + archive.entries[mid].name_ofs, name) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * Read the stored data of an entry from the archive file. Used if the archive is not mapped.
+ * @param entry pointer to an entry
+ * @param pos read from this position of the stored data
+ * @param buf store the data here
+ * @param btr number of bytes to read
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t read_stored(const archive_entry_t * entry, uint32_t pos, void * buf, uint32_t btr)
+{
+    /*The archive file is shared by all opened files so seek and read together*/
+    ARCHIVE_LOCK();
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_seek(&archive.file, entry->data_ofs + pos, LV_FS_SEEK_SET);
+    if(res == LV_FS_RES_OK) res = lv_fs_read(&archive.file, buf, btr, &br);
+    ARCHIVE_UNLOCK();
+
+    if(res == LV_FS_RES_OK && br != btr) res = LV_FS_RES_FS_ERR;
+    return res;
+}
+
+/**
+ * Decompress an LZ4 block (without the frame format)
+ * @param src the compressed data
+ * @param src_size size of the compressed data
+ * @param dst store the decompressed data here
+ * @param dst_size size of the decompressed data
+ * @return true: the block was decompressed to exactly `dst_size` bytes
+ */
+static bool lz4_decompress(const uint8_t * src, uint32_t src_size, uint8_t * dst, uint32_t dst_size)
+{
+    const uint8_t * src_end = src + src_size;
+    uint8_t * d = dst;
+    uint8_t * dst_end = dst + dst_size;
+
+    while(src < src_end) {
+        uint8_t token = *src++;
+
+        /*Literals*/
+        uint32_t len = token >> 4;
+        if(len == 15) {
+            uint8_t b;
+            do {
+                if(src >= src_end) return false;
+                b = *src++;
+                len += b;
+            } while(b == 255);
+        }
+        if((uint32_t)(src_end - src) < len || (uint32_t)(dst_end - d) < len) return false;
+        lv_memcpy(d, src, len);
+        d += len;
+        src += len;
+
+        /*The last sequence has only literals*/
+        if(src == src_end) break;
+
+        /*Match*/
+        if(src_end - src < 2) return false;
+        uint32_t offset = src[0] | (src[1] << 8);
+        src += 2;
+        if(offset == 0 || offset > (uint32_t)(d - dst)) return false;
+
+        len = token & 0xF;
+        if(len == 15) {
+            uint8_t b;
+            do {
+                if(src >= src_end) return false;
+                b = *src++;
+                len += b;
+            } while(b == 255);
+        }
+        len += 4;
+        if((uint32_t)(dst_end - d) < len) return false;
+
+        /*Copy byte by byte as the match can overlap with the output*/
+        const uint8_t * m = d - offset;
+        while(len--) *d++ = *m++;
+    }
+
+    return d == dst_end;
+}
+
+#else /*LV_USE_FS_ARCHIVE == 0*/
+
+#if defined(LV_FS_ARCHIVE_LETTER) && LV_FS_ARCHIVE_LETTER != '\0'
+    #warning "LV_USE_FS_ARCHIVE is not enabled but LV_FS_ARCHIVE_LETTER is set"
+#endif
+
+#endif /*LV_USE_FS_ARCHIVE*/
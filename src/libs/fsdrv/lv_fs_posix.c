@@ -17,6 +17,8 @@
 #ifndef WIN32
     #include <dirent.h>
     #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
 #else
     #include <windows.h>
 #endif
@@ -42,6 +44,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#ifndef WIN32
+    static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** data_p, uint32_t * size_p);
+    static lv_fs_res_t fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * data, uint32_t size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -81,6 +87,10 @@ void lv_fs_posix_init(void)
     fs_drv.write_cb = fs_write;
     fs_drv.seek_cb = fs_seek;
     fs_drv.tell_cb = fs_tell;
+#ifndef WIN32
+    fs_drv.map_cb = fs_map;
+    fs_drv.unmap_cb = fs_unmap;
+#endif
 
     fs_drv.dir_close_cb = fs_dir_close;
     fs_drv.dir_open_cb = fs_dir_open;
@@ -212,6 +222,47 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return offset < 0 ? LV_FS_RES_FS_ERR : LV_FS_RES_OK;
 }
 
+#ifndef WIN32
+/**
+ * Map the whole file into the memory read-only
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable.
+ * @param data_p pointer to store the address of the mapped file
+ * @param size_p pointer to store the size of the file
+ * @return LV_FS_RES_OK: no error, the file is mapped
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** data_p, uint32_t * size_p)
+{
+    LV_UNUSED(drv);
+    struct stat st;
+    if(fstat((lv_uintptr_t)file_p, &st) != 0) return LV_FS_RES_FS_ERR;
+    if(st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) return LV_FS_RES_NOT_IMP;
+
+    void * data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, (lv_uintptr_t)file_p, 0);
+    if(data == MAP_FAILED) return LV_FS_RES_FS_ERR;
+
+    *data_p = data;
+    *size_p = st.st_size;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Release a mapping created by `fs_map`
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable.
+ * @param data address of the mapped file
+ * @param size size of the mapped file
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * data, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    return munmap((void *)data, size) == 0 ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+#endif
+
 #ifdef WIN32
     static char next_fn[256];
 #endif
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "../../lv_conf_internal.h"
+#include "../../misc/lv_fs.h"
 
 /*********************
  *      DEFINES
@@ -43,6 +44,24 @@ void lv_fs_posix_init(void);
 void lv_fs_win32_init(void);
 #endif
 
+#if LV_USE_FS_ARCHIVE != '\0'
+void lv_fs_archive_init(void);
+
+/**
+ * Mount an archive created by `scripts/fs_archive_pack.py`. Its files can be opened with the
+ * `LV_FS_ARCHIVE_LETTER` drive. A previously mounted archive is unmounted.
+ * The archive is mapped if its driver supports it, else only its index is loaded.
+ * @param path  path to the archive with the letter of an other driver (e.g. "S:assets.pak")
+ * @return      LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_archive_mount(const char * path);
+
+/**
+ * Unmount the archive. The files of the archive should be closed before calling it.
+ */
+void lv_fs_archive_unmount(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
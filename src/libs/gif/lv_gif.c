@@ -10,16 +10,39 @@
 #if LV_USE_GIF
 
 #include "gifdec.h"
+#include "../../osal/lv_os.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS    &lv_gif_class
 
+#if LV_GIF_USE_THREAD
+#if LV_USE_OS == LV_OS_NONE
+#error "LV_GIF_USE_THREAD requires LV_USE_OS"
+#endif
+
+/*Size of a pixel on the canvas of gifdec*/
+#if LV_COLOR_DEPTH == 32 || LV_COLOR_DEPTH == 24
+#define CANVAS_PX_SIZE  4
+#elif LV_COLOR_DEPTH == 16
+#define CANVAS_PX_SIZE  3
+#elif LV_COLOR_DEPTH == 8
+#define CANVAS_PX_SIZE  2
+#endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
-
+#if LV_GIF_USE_THREAD
+typedef enum {
+    DECODE_STATE_IDLE,
+    DECODE_STATE_REQUESTED,     /*Waiting for the decoder thread*/
+    DECODE_STATE_DECODING,
+    DECODE_STATE_READY,         /*The next frame is in `back_buf`*/
+} decode_state_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -27,6 +50,17 @@
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void get_frame_area(gd_GIF * gif, lv_area_t * area);
+static void area_add(lv_area_t * area, const lv_area_t * add);
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area);
+#if LV_GIF_USE_THREAD
+static void thread_gif_add(lv_gif_t * gifobj);
+static void thread_gif_remove(lv_gif_t * gifobj);
+static void thread_request_frame(lv_gif_t * gifobj);
+static void thread_wait_idle(lv_gif_t * gifobj);
+static void decoder_thread_cb(void * user_data);
+static void decode_next_frame(lv_gif_t * gifobj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -38,6 +72,15 @@ const lv_obj_class_t lv_gif_class = {
     .base_class = &lv_img_class
 };
 
+#if LV_GIF_USE_THREAD
+static bool thread_inited;
+static lv_thread_t decoder_thread;
+static lv_thread_sync_t decoder_sync;   /*Wakes up the decoder thread*/
+static lv_thread_sync_t idle_sync;      /*Signaled when the decoder thread finished a frame*/
+static lv_mutex_t decoder_mutex;        /*Protects the list of GIFs and their `decode_state`*/
+static lv_gif_t * gif_head;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -61,6 +104,9 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
 
     /*Close previous gif if any*/
     if(gifobj->gif) {
+#if LV_GIF_USE_THREAD
+        thread_gif_remove(gifobj);
+#endif
         lv_img_cache_invalidate_src(&gifobj->imgdsc);
         gd_close_gif(gifobj->gif);
         gifobj->gif = NULL;
@@ -81,7 +127,11 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
 
     gifobj->imgdsc.data = gifobj->gif->canvas;
     gifobj->imgdsc.header.always_zero = 0;
+#if LV_COLOR_DEPTH == 32 || LV_COLOR_DEPTH == 24
+    gifobj->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+#else
     //    gifobj->imgdsc.header.cf = LV_COLOR_FORMAT_NATIVE_ALPHA; TODO
+#endif
     gifobj->imgdsc.header.h = gifobj->gif->height;
     gifobj->imgdsc.header.w = gifobj->gif->width;
     gifobj->last_call = lv_tick_get();
@@ -91,14 +141,40 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     lv_timer_resume(gifobj->timer);
     lv_timer_reset(gifobj->timer);
 
+    /*The first frame is decoded right away*/
     next_frame_task_cb(gifobj->timer);
 
+#if LV_GIF_USE_THREAD
+    thread_gif_add(gifobj);
+#endif
 }
 
 void lv_gif_restart(lv_obj_t * obj)
 {
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+#if LV_GIF_USE_THREAD
+    /*Drop the frame decoded ahead and start again from the first frame*/
+    if(gifobj->back_buf) {
+        thread_wait_idle(gifobj);
+        if(gifobj->decode_state == DECODE_STATE_READY) {
+            /*The dropped frame is already on the canvas. Restore the shown frame and
+             *copy the whole canvas into the other buffer with the next frame.*/
+            gd_GIF * gif = gifobj->gif;
+            lv_memcpy(gif->canvas, gifobj->imgdsc.data, gif->width * gif->height * CANVAS_PX_SIZE);
+            gifobj->back_dirty_area.x1 = 0;
+            gifobj->back_dirty_area.y1 = 0;
+            gifobj->back_dirty_area.x2 = gif->width - 1;
+            gifobj->back_dirty_area.y2 = gif->height - 1;
+        }
+        gd_rewind(gifobj->gif);
+        thread_request_frame(gifobj);
+    }
+    else {
+        gd_rewind(gifobj->gif);
+    }
+#else
     gd_rewind(gifobj->gif);
+#endif
     lv_timer_resume(gifobj->timer);
     lv_timer_reset(gifobj->timer);
 }
@@ -122,6 +198,9 @@ static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+#if LV_GIF_USE_THREAD
+    thread_gif_remove(gifobj);
+#endif
     lv_img_cache_invalidate_src(&gifobj->imgdsc);
     if(gifobj->gif)
         gd_close_gif(gifobj->gif);
@@ -133,10 +212,48 @@ static void next_frame_task_cb(lv_timer_t * t)
     lv_obj_t * obj = t->user_data;
     lv_gif_t * gifobj = (lv_gif_t *) obj;
     uint32_t elaps = lv_tick_elaps(gifobj->last_call);
+
+#if LV_GIF_USE_THREAD
+    if(gifobj->back_buf) {
+        if(elaps < gifobj->delay * 10) return;
+
+        /*Keep showing the current frame until the next one is decoded*/
+        lv_mutex_lock(&decoder_mutex);
+        bool ready = gifobj->decode_state == DECODE_STATE_READY;
+        lv_mutex_unlock(&decoder_mutex);
+        if(!ready) return;
+
+        gifobj->last_call = lv_tick_get();
+
+        if(gifobj->ready_res == 0) {
+            /*It was the last repeat*/
+            lv_timer_pause(t);
+            lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+            return;
+        }
+
+        /*Show the decoded frame and decode the next one into the other buffer*/
+        uint8_t * shown_buf = (uint8_t *)gifobj->imgdsc.data;
+        gifobj->imgdsc.data = gifobj->back_buf;
+        gifobj->back_buf = shown_buf;
+        gifobj->delay = gifobj->ready_delay;
+        lv_area_t area = gifobj->ready_area;
+        thread_request_frame(gifobj);
+
+        lv_img_cache_invalidate_src(lv_img_get_src(obj));
+        if(area.x2 >= area.x1) invalidate_frame_area(obj, &area);
+        return;
+    }
+#endif
+
     if(elaps < gifobj->gif->gce.delay * 10) return;
 
     gifobj->last_call = lv_tick_get();
 
+    /*The pixels of the previous frame might be restored and the new frame is drawn*/
+    lv_area_t area;
+    get_frame_area(gifobj->gif, &area);
+
     int has_next = gd_get_frame(gifobj->gif);
     if(has_next == 0) {
         /*It was the last repeat*/
@@ -147,8 +264,232 @@ static void next_frame_task_cb(lv_timer_t * t)
 
     gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
 
+    lv_area_t frame_area;
+    get_frame_area(gifobj->gif, &frame_area);
+    area_add(&area, &frame_area);
+
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
-    lv_obj_invalidate(obj);
+    invalidate_frame_area(obj, &area);
+}
+
+/**
+ * Get the area of the current frame on the canvas
+ * @param gif   pointer to a GIF decoder
+ * @param area  store the area here
+ */
+static void get_frame_area(gd_GIF * gif, lv_area_t * area)
+{
+    area->x1 = gif->fx;
+    area->y1 = gif->fy;
+    area->x2 = gif->fx + gif->fw - 1;
+    area->y2 = gif->fy + gif->fh - 1;
+}
+
+/**
+ * Extend an area to contain an other one. Empty areas have `x2 < x1`.
+ * @param area  pointer to an area to extend
+ * @param add   pointer to an area to add
+ */
+static void area_add(lv_area_t * area, const lv_area_t * add)
+{
+    if(add->x2 < add->x1) return;
+    if(area->x2 < area->x1) *area = *add;
+    else _lv_area_join(area, area, add);
 }
 
+/**
+ * Invalidate the part of a GIF object which was changed by a new frame
+ * @param obj   pointer to a GIF object
+ * @param area  the changed area on the canvas
+ */
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_img_t * img = (lv_img_t *)obj;
+
+    /*The area can be mapped simply only if the image is drawn once, without transformations*/
+    if(img->zoom != LV_ZOOM_NONE || img->angle != 0 || img->offset.x != 0 || img->offset.y != 0 ||
+       lv_obj_get_content_width(obj) != img->w || lv_obj_get_content_height(obj) != img->h) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t obj_area = *area;
+    lv_area_move(&obj_area, obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN),
+                 obj->coords.y1 + lv_obj_get_style_pad_top(obj, LV_PART_MAIN));
+    lv_obj_invalidate_area(obj, &obj_area);
+}
+
+#if LV_GIF_USE_THREAD
+
+/**
+ * Start decoding the frames of a GIF on the decoder thread.
+ * The first frame needs to be on the canvas already.
+ * @param gifobj    pointer to a GIF object with an opened GIF
+ */
+static void thread_gif_add(lv_gif_t * gifobj)
+{
+    /*Without the buffers the frames are decoded in the timer*/
+    uint32_t buf_size = gifobj->gif->width * gifobj->gif->height * CANVAS_PX_SIZE;
+    uint8_t * shown_buf = lv_malloc(buf_size);
+    gifobj->back_buf = lv_malloc(buf_size);
+    if(shown_buf == NULL || gifobj->back_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the frame buffers. Decoding in the timer.");
+        lv_free(shown_buf);
+        lv_free(gifobj->back_buf);
+        gifobj->back_buf = NULL;
+        return;
+    }
+
+    /*The decoder thread can't be deleted so it's created only once*/
+    if(!thread_inited) {
+        thread_inited = true;
+        lv_mutex_init(&decoder_mutex);
+        lv_thread_sync_init(&decoder_sync);
+        lv_thread_sync_init(&idle_sync);
+        lv_thread_init(&decoder_thread, LV_THREAD_PRIO_MID, decoder_thread_cb, 8 * 1024, NULL);
+    }
+
+    lv_memcpy(shown_buf, gifobj->gif->canvas, buf_size);
+    lv_memcpy(gifobj->back_buf, gifobj->gif->canvas, buf_size);
+    gifobj->imgdsc.data = shown_buf;
+    lv_img_set_src((lv_obj_t *)gifobj, &gifobj->imgdsc);
+
+    gifobj->back_dirty_area.x1 = 0;
+    gifobj->back_dirty_area.x2 = -1;
+    gifobj->delay = gifobj->gif->gce.delay;
+    gifobj->decode_state = DECODE_STATE_IDLE;
+
+    lv_mutex_lock(&decoder_mutex);
+    gifobj->next = gif_head;
+    gif_head = gifobj;
+    lv_mutex_unlock(&decoder_mutex);
+
+    thread_request_frame(gifobj);
+}
+
+/**
+ * Stop decoding the frames of a GIF on the decoder thread and free the frame buffers
+ * @param gifobj    pointer to a GIF object
+ */
+static void thread_gif_remove(lv_gif_t * gifobj)
+{
+    if(gifobj->back_buf == NULL) return;
+
+    thread_wait_idle(gifobj);
+
+    lv_mutex_lock(&decoder_mutex);
+    lv_gif_t ** prev_next = &gif_head;
+    while(*prev_next != gifobj) prev_next = &(*prev_next)->next;
+    *prev_next = gifobj->next;
+    lv_mutex_unlock(&decoder_mutex);
+
+    lv_img_cache_invalidate_src(&gifobj->imgdsc);
+    lv_free((void *)gifobj->imgdsc.data);
+    lv_free(gifobj->back_buf);
+    gifobj->imgdsc.data = NULL;
+    gifobj->back_buf = NULL;
+}
+
+static void thread_request_frame(lv_gif_t * gifobj)
+{
+    lv_mutex_lock(&decoder_mutex);
+    gifobj->decode_state = DECODE_STATE_REQUESTED;
+    lv_mutex_unlock(&decoder_mutex);
+    lv_thread_sync_signal(&decoder_sync);
+}
+
+/**
+ * Cancel the requested frame of a GIF or wait until the decoder thread finishes it
+ * @param gifobj    pointer to a GIF object
+ */
+static void thread_wait_idle(lv_gif_t * gifobj)
+{
+    lv_mutex_lock(&decoder_mutex);
+    if(gifobj->decode_state == DECODE_STATE_REQUESTED) gifobj->decode_state = DECODE_STATE_IDLE;
+    while(gifobj->decode_state == DECODE_STATE_DECODING) {
+        lv_mutex_unlock(&decoder_mutex);
+        lv_thread_sync_wait(&idle_sync);
+        lv_mutex_lock(&decoder_mutex);
+    }
+    lv_mutex_unlock(&decoder_mutex);
+}
+
+static void decoder_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    while(1) {
+        lv_mutex_lock(&decoder_mutex);
+        lv_gif_t * gifobj;
+        for(gifobj = gif_head; gifobj; gifobj = gifobj->next) {
+            if(gifobj->decode_state == DECODE_STATE_REQUESTED) break;
+        }
+
+        if(gifobj == NULL) {
+            lv_mutex_unlock(&decoder_mutex);
+            lv_thread_sync_wait(&decoder_sync);
+            continue;
+        }
+
+        gifobj->decode_state = DECODE_STATE_DECODING;
+        lv_mutex_unlock(&decoder_mutex);
+
+        decode_next_frame(gifobj);
+
+        lv_mutex_lock(&decoder_mutex);
+        gifobj->decode_state = DECODE_STATE_READY;
+        lv_mutex_unlock(&decoder_mutex);
+        lv_thread_sync_signal(&idle_sync);
+    }
+}
+
+/**
+ * Decode the next frame of a GIF on the canvas and update `back_buf` to show it.
+ * Called on the decoder thread.
+ * @param gifobj    pointer to a GIF object
+ */
+static void decode_next_frame(lv_gif_t * gifobj)
+{
+    gd_GIF * gif = gifobj->gif;
+
+    lv_area_t area;
+    get_frame_area(gif, &area);
+
+    int res = gd_get_frame(gif);
+    if(res == 1) {
+        gd_render_frame(gif, gif->canvas);
+
+        lv_area_t frame_area;
+        get_frame_area(gif, &frame_area);
+        area_add(&area, &frame_area);
+    }
+    else {
+        /*No new frame so nothing has changed*/
+        area.x1 = 0;
+        area.x2 = -1;
+    }
+
+    /*`back_buf` has the frame before the shown one so copy the changes of both frames*/
+    lv_area_t copy_area = gifobj->back_dirty_area;
+    area_add(&copy_area, &area);
+    if(copy_area.x2 >= copy_area.x1) {
+        uint32_t stride = gif->width * CANVAS_PX_SIZE;
+        uint32_t offset = copy_area.y1 * stride + copy_area.x1 * CANVAS_PX_SIZE;
+        uint32_t line_size = lv_area_get_width(&copy_area) * CANVAS_PX_SIZE;
+        lv_coord_t y;
+        for(y = copy_area.y1; y <= copy_area.y2; y++) {
+            lv_memcpy(gifobj->back_buf + offset, gif->canvas + offset, line_size);
+            offset += stride;
+        }
+    }
+
+    /*If the frame will be shown the other buffer misses its changes*/
+    gifobj->back_dirty_area = area;
+    gifobj->ready_area = area;
+    gifobj->ready_delay = gif->gce.delay;
+    gifobj->ready_res = res;
+}
+
+#endif /*LV_GIF_USE_THREAD*/
+
 #endif /*LV_USE_GIF*/
@@ -27,12 +27,22 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
-typedef struct {
+typedef struct _lv_gif_t {
     lv_img_t img;
     gd_GIF * gif;
     lv_timer_t * timer;
     lv_img_dsc_t imgdsc;
     uint32_t last_call;
+#if LV_GIF_USE_THREAD
+    struct _lv_gif_t * next;    /*Next GIF in the list of the decoder thread*/
+    uint8_t * back_buf;         /*The next frame is decoded here while `imgdsc.data` is shown*/
+    lv_area_t back_dirty_area;  /*Area where `back_buf` differs from the canvas of the decoder*/
+    lv_area_t ready_area;       /*Area changed by the frame in `back_buf`*/
+    uint16_t delay;             /*Delay of the shown frame*/
+    uint16_t ready_delay;       /*Delay of the frame in `back_buf`*/
+    int8_t ready_res;           /*Return value of `gd_get_frame()` for the frame in `back_buf`*/
+    uint8_t decode_state;
+#endif
 } lv_gif_t;
 
 extern const lv_obj_class_t lv_gif_class;
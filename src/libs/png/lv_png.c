@@ -16,10 +16,75 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_PNG_USE_STREAM
+#define STREAM_IN_BUF_SIZE      256
+#define STREAM_WINDOW_SIZE      32768   /*The max. distance of a back reference in a deflate stream*/
+#define STREAM_HUFF_FAST_BITS   9       /*Codes not longer than this are decoded with a single table lookup*/
+#define STREAM_MAX_SIZE         2047    /*The max. width and height which fits into `lv_img_header_t`*/
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_PNG_USE_STREAM
+typedef struct {
+    uint16_t count[16];     /*Number of codes with a given length*/
+    uint16_t symbol[288];   /*Symbols ordered by their codes*/
+    uint16_t fast[1 << STREAM_HUFF_FAST_BITS];  /*`length << 9 | symbol` indexed by the next bits. 0: longer code*/
+} png_huff_t;
+
+typedef enum {
+    PNG_INFLATE_BLOCK_HEADER,
+    PNG_INFLATE_STORED,
+    PNG_INFLATE_HUFFMAN,
+    PNG_INFLATE_DONE,
+} png_inflate_state_t;
+
+typedef struct {
+    /*Source*/
+    lv_fs_file_t f;
+    const uint8_t * src_data;       /*The PNG data if it's a variable, NULL if it's a file*/
+    uint32_t src_size;
+    uint32_t src_pos;               /*Read position in the file or `src_data`*/
+    uint32_t idat_start;            /*Position of the first IDAT chunk's data*/
+    uint32_t idat_start_len;        /*Length of the first IDAT chunk*/
+    uint32_t idat_remain;           /*Not yet read bytes of the current IDAT chunk*/
+    const uint8_t * in_p;           /*Next compressed byte*/
+    uint32_t in_len;                /*Available bytes from `in_p`*/
+    uint8_t in_buf[STREAM_IN_BUF_SIZE];
+
+    /*Image info*/
+    uint32_t w;
+    uint32_t h;
+    uint8_t bit_depth;
+    uint8_t color_type;
+    uint32_t row_bytes;
+    uint32_t filter_bpp;            /*Distance of the corresponding byte of the previous pixel*/
+    lv_color32_t palette[256];
+    uint16_t trns_key[3];           /*Transparent gray or RGB value*/
+    uint8_t has_trns_key : 1;
+
+    /*Inflate*/
+    png_inflate_state_t state;
+    uint8_t last_block : 1;
+    uint8_t failed : 1;
+    uint32_t bit_buf;
+    uint32_t bit_cnt;
+    uint32_t stored_remain;
+    uint32_t copy_len;
+    uint32_t copy_dist;
+    uint32_t out_cnt;               /*Number of inflated bytes. `window` is indexed with it*/
+    uint8_t * window;
+    png_huff_t lit;
+    png_huff_t dist;
+
+    /*Rows*/
+    uint8_t * row_cur;
+    uint8_t * row_prev;
+    uint32_t next_row;              /*The next row to decode*/
+    lv_color32_t * row_cache;       /*`LV_PNG_STREAM_ROW_CACHE_CNT` converted rows. Row `y` is at `y % cnt`*/
+} png_stream_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -29,6 +94,25 @@ static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 static void convert_color_depth(uint8_t * img_p, uint32_t px_cnt);
 
+#if LV_PNG_USE_STREAM
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+static png_stream_t * stream_create(lv_img_decoder_dsc_t * dsc);
+static void stream_delete(png_stream_t * s);
+static lv_res_t stream_parse_header(png_stream_t * s);
+static lv_res_t stream_rewind(png_stream_t * s);
+static lv_res_t stream_decode_row(png_stream_t * s, lv_color32_t * out);
+static lv_res_t stream_src_read(png_stream_t * s, void * buf, uint32_t len);
+static lv_res_t stream_src_seek(png_stream_t * s, uint32_t pos);
+static int32_t stream_get_bits(png_stream_t * s, uint32_t n);
+static lv_res_t inflate_read(png_stream_t * s, uint8_t * out, uint32_t len);
+static lv_res_t inflate_dynamic_tables(png_stream_t * s);
+static int32_t huff_build(png_huff_t * h, const uint8_t * lengths, uint32_t n);
+static int32_t huff_decode(png_stream_t * s, const png_huff_t * h);
+static lv_res_t unfilter_row(png_stream_t * s, uint8_t filter);
+static void convert_row(const png_stream_t * s, const uint8_t * in, lv_color32_t * out);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -49,6 +133,9 @@ void lv_png_init(void)
     lv_img_decoder_t * dec = lv_img_decoder_create();
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
+#if LV_PNG_USE_STREAM
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+#endif
     lv_img_decoder_set_close_cb(dec, decoder_close);
 }
 
@@ -151,6 +238,19 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
 
     uint8_t * img_data = NULL;
 
+#if LV_PNG_USE_STREAM
+    /*Decode the image later row by row in `decoder_read_line` if it's possible.
+     *If the whole image is required (e.g. to transform it) decode it with lodepng.*/
+    if(!dsc->need_img_data && (dsc->src_type == LV_IMG_SRC_FILE || dsc->src_type == LV_IMG_SRC_VARIABLE)) {
+        png_stream_t * s = stream_create(dsc);
+        if(s) {
+            dsc->user_data = s;
+            dsc->img_data = NULL;
+            return LV_RES_OK;
+        }
+    }
+#endif
+
     /*If it's a PNG file...*/
     if(dsc->src_type == LV_IMG_SRC_FILE) {
         const char * fn = dsc->src;
@@ -222,6 +322,12 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
 static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
 {
     LV_UNUSED(decoder); /*Unused*/
+#if LV_PNG_USE_STREAM
+    if(dsc->user_data) {
+        stream_delete(dsc->user_data);
+        dsc->user_data = NULL;
+    }
+#endif
     if(dsc->img_data) {
         lv_free((uint8_t *)dsc->img_data);
         dsc->img_data = NULL;
@@ -244,6 +350,834 @@ static void convert_color_depth(uint8_t * img_p, uint32_t px_cnt)
     }
 }
 
-#endif /*LV_USE_PNG*/
+#if LV_PNG_USE_STREAM
+
+/**
+ * Decode a part of a row of a PNG image opened in stream mode.
+ * Rows are decoded sequentially so reading the rows from top to bottom is the fastest.
+ */
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    png_stream_t * s = dsc->user_data;
+    if(s == NULL || s->failed) return LV_RES_INV;
+    if(x < 0 || y < 0 || len < 0 || (uint32_t)(x + len) > s->w || (uint32_t)y >= s->h) return LV_RES_INV;
+
+    const uint32_t cache_cnt = LV_PNG_STREAM_ROW_CACHE_CNT;
+
+    /*The row was already dropped from the cache, start again from the first row*/
+    if((uint32_t)y + cache_cnt < s->next_row) {
+        if(stream_rewind(s) != LV_RES_OK) {
+            s->failed = 1;
+            return LV_RES_INV;
+        }
+    }
+
+    while(s->next_row <= (uint32_t)y) {
+        lv_color32_t * row = s->row_cache + (s->next_row % cache_cnt) * s->w;
+        if(stream_decode_row(s, row) != LV_RES_OK) {
+            LV_LOG_WARN("Couldn't decode row %" LV_PRIu32, s->next_row);
+            s->failed = 1;
+            return LV_RES_INV;
+        }
+        s->next_row++;
+    }
+
+    const lv_color32_t * row = s->row_cache + ((uint32_t)y % cache_cnt) * s->w;
+    lv_memcpy(buf, row + x, len * sizeof(lv_color32_t));
+
+    return LV_RES_OK;
+}
+
+/**
+ * Prepare the stream decoding of a PNG image
+ * @param dsc   decoder descriptor with a file or variable source
+ * @return      the stream descriptor or NULL if the image can't be decoded as a stream (e.g. it's interlaced)
+ */
+static png_stream_t * stream_create(lv_img_decoder_dsc_t * dsc)
+{
+    png_stream_t * s = lv_malloc(sizeof(png_stream_t));
+    LV_ASSERT_MALLOC(s);
+    if(s == NULL) return NULL;
+    lv_memzero(s, sizeof(png_stream_t));
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        if(strcmp(lv_fs_get_ext(dsc->src), "png") != 0) {
+            lv_free(s);
+            return NULL;
+        }
+        lv_fs_res_t res = lv_fs_open(&s->f, dsc->src, LV_FS_MODE_RD);
+        if(res != LV_FS_RES_OK) {
+            lv_free(s);
+            return NULL;
+        }
+    }
+    else {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        s->src_data = img_dsc->data;
+        s->src_size = img_dsc->data_size;
+    }
+
+    if(stream_parse_header(s) != LV_RES_OK) {
+        stream_delete(s);
+        return NULL;
+    }
+
+    /*The size was read by `decoder_info` too. The rows are written according to `s->w` so they need to match.*/
+    if(s->w != dsc->header.w || s->h != dsc->header.h) {
+        LV_LOG_WARN("Invalid image size");
+        stream_delete(s);
+        return NULL;
+    }
+
+    uint32_t cache_cnt = LV_PNG_STREAM_ROW_CACHE_CNT;
+    uint64_t cache_size = (uint64_t)s->w * cache_cnt * sizeof(lv_color32_t);
+    if(cache_size > UINT32_MAX) {
+        stream_delete(s);
+        return NULL;
+    }
+
+    s->window = lv_malloc(STREAM_WINDOW_SIZE);
+    s->row_cur = lv_malloc(s->row_bytes);
+    s->row_prev = lv_malloc(s->row_bytes);
+    s->row_cache = lv_malloc((size_t)cache_size);
+    if(s->window == NULL || s->row_cur == NULL || s->row_prev == NULL || s->row_cache == NULL) {
+        LV_LOG_WARN("Out of memory");
+        stream_delete(s);
+        return NULL;
+    }
+
+    if(stream_rewind(s) != LV_RES_OK) {
+        stream_delete(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+static void stream_delete(png_stream_t * s)
+{
+    if(s->src_data == NULL) lv_fs_close(&s->f);
+    lv_free(s->window);
+    lv_free(s->row_cur);
+    lv_free(s->row_prev);
+    lv_free(s->row_cache);
+    lv_free(s);
+}
+
+static uint32_t read_u32_be(const uint8_t * p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/**
+ * Read the chunks before the image data and find the first IDAT chunk.
+ * @param s     pointer to a stream descriptor with an opened source
+ * @return      LV_RES_OK: the image can be decoded as a stream; LV_RES_INV: invalid or unsupported image
+ */
+static lv_res_t stream_parse_header(png_stream_t * s)
+{
+    static const uint8_t magic[] = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    uint8_t buf[768];       /*Large enough for a full palette*/
+
+    if(stream_src_read(s, buf, sizeof(magic)) != LV_RES_OK) return LV_RES_INV;
+    if(memcmp(buf, magic, sizeof(magic)) != 0) return LV_RES_INV;
 
+    bool has_ihdr = false;
+    uint32_t i;
+    while(1) {
+        if(stream_src_read(s, buf, 8) != LV_RES_OK) return LV_RES_INV;
+        uint32_t len = read_u32_be(buf);
+        char type[4];
+        lv_memcpy(type, buf + 4, 4);
+
+        if(memcmp(type, "IDAT", 4) == 0) {
+            if(!has_ihdr) return LV_RES_INV;
+            s->idat_start = s->src_pos;
+            s->idat_start_len = len;
+            return LV_RES_OK;
+        }
+
+        if(memcmp(type, "IHDR", 4) == 0) {
+            if(len != 13 || stream_src_read(s, buf, 13) != LV_RES_OK) return LV_RES_INV;
+            s->w = read_u32_be(buf);
+            s->h = read_u32_be(buf + 4);
+            s->bit_depth = buf[8];
+            s->color_type = buf[9];
+            uint8_t interlace = buf[12];
+
+            /*Adam7 interlaced images can't be decoded row by row*/
+            if(interlace != 0) return LV_RES_INV;
+            if(s->w == 0 || s->h == 0 || buf[10] != 0 || buf[11] != 0) return LV_RES_INV;
+            if(s->w > STREAM_MAX_SIZE || s->h > STREAM_MAX_SIZE) return LV_RES_INV;
+
+            uint32_t channels;
+            switch(s->color_type) {
+                case 0:
+                    channels = 1;
+                    if(s->bit_depth != 1 && s->bit_depth != 2 && s->bit_depth != 4 && s->bit_depth != 8 &&
+                       s->bit_depth != 16) return LV_RES_INV;
+                    break;
+                case 3:
+                    channels = 1;
+                    if(s->bit_depth != 1 && s->bit_depth != 2 && s->bit_depth != 4 && s->bit_depth != 8) return LV_RES_INV;
+                    break;
+                case 2:
+                    channels = 3;
+                    if(s->bit_depth != 8 && s->bit_depth != 16) return LV_RES_INV;
+                    break;
+                case 4:
+                    channels = 2;
+                    if(s->bit_depth != 8 && s->bit_depth != 16) return LV_RES_INV;
+                    break;
+                case 6:
+                    channels = 4;
+                    if(s->bit_depth != 8 && s->bit_depth != 16) return LV_RES_INV;
+                    break;
+                default:
+                    return LV_RES_INV;
+            }
+
+            uint32_t px_bits = channels * s->bit_depth;
+            uint64_t row_bytes = ((uint64_t)s->w * px_bits + 7) / 8;
+            if(row_bytes > UINT32_MAX) return LV_RES_INV;
+            s->row_bytes = (uint32_t)row_bytes;
+            s->filter_bpp = (px_bits + 7) / 8;
+
+            for(i = 0; i < 256; i++) {
+                s->palette[i].red = 0;
+                s->palette[i].green = 0;
+                s->palette[i].blue = 0;
+                s->palette[i].alpha = 0xff;
+            }
+            has_ihdr = true;
+        }
+        else if(memcmp(type, "PLTE", 4) == 0) {
+            if(len > 768 || len % 3 || stream_src_read(s, buf, len) != LV_RES_OK) return LV_RES_INV;
+            for(i = 0; i < len / 3; i++) {
+                s->palette[i].red = buf[i * 3 + 0];
+                s->palette[i].green = buf[i * 3 + 1];
+                s->palette[i].blue = buf[i * 3 + 2];
+            }
+        }
+        else if(memcmp(type, "tRNS", 4) == 0) {
+            if(len > 256 || stream_src_read(s, buf, len) != LV_RES_OK) return LV_RES_INV;
+            if(s->color_type == 3) {
+                for(i = 0; i < len; i++) s->palette[i].alpha = buf[i];
+            }
+            else if(s->color_type == 0 && len == 2) {
+                s->trns_key[0] = (buf[0] << 8) | buf[1];
+                s->has_trns_key = 1;
+            }
+            else if(s->color_type == 2 && len == 6) {
+                for(i = 0; i < 3; i++) s->trns_key[i] = (buf[i * 2] << 8) | buf[i * 2 + 1];
+                s->has_trns_key = 1;
+            }
+        }
+        else if(memcmp(type, "IEND", 4) == 0) {
+            return LV_RES_INV;
+        }
+        else {
+            if(stream_src_seek(s, s->src_pos + len) != LV_RES_OK) return LV_RES_INV;
+        }
+
+        /*Skip the CRC*/
+        if(stream_src_seek(s, s->src_pos + 4) != LV_RES_OK) return LV_RES_INV;
+    }
+}
+
+/**
+ * Go back to the beginning of the image data and reset the decoder
+ */
+static lv_res_t stream_rewind(png_stream_t * s)
+{
+    if(stream_src_seek(s, s->idat_start) != LV_RES_OK) return LV_RES_INV;
+
+    s->idat_remain = s->idat_start_len;
+    s->in_len = 0;
+    s->bit_buf = 0;
+    s->bit_cnt = 0;
+    s->state = PNG_INFLATE_BLOCK_HEADER;
+    s->last_block = 0;
+    s->copy_len = 0;
+    s->out_cnt = 0;
+    s->next_row = 0;
+    lv_memzero(s->row_prev, s->row_bytes);
+
+    /*zlib header: deflate compression, no preset dictionary*/
+    int32_t cmf = stream_get_bits(s, 8);
+    int32_t flg = stream_get_bits(s, 8);
+    if(cmf < 0 || flg < 0) return LV_RES_INV;
+    if((cmf & 0x0f) != 8 || (cmf >> 4) > 7 || (flg & 0x20) || ((cmf << 8) | flg) % 31) {
+        LV_LOG_WARN("Invalid zlib header");
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Inflate, unfilter and convert the next row
+ * @param s     pointer to a stream descriptor
+ * @param out   store `s->w` ARGB8888 pixels here
+ */
+static lv_res_t stream_decode_row(png_stream_t * s, lv_color32_t * out)
+{
+    uint8_t filter;
+    if(inflate_read(s, &filter, 1) != LV_RES_OK) return LV_RES_INV;
+    if(inflate_read(s, s->row_cur, s->row_bytes) != LV_RES_OK) return LV_RES_INV;
+    if(unfilter_row(s, filter) != LV_RES_OK) return LV_RES_INV;
+
+    convert_row(s, s->row_cur, out);
+
+    uint8_t * tmp = s->row_prev;
+    s->row_prev = s->row_cur;
+    s->row_cur = tmp;
+
+    return LV_RES_OK;
+}
+
+static lv_res_t stream_src_read(png_stream_t * s, void * buf, uint32_t len)
+{
+    if(s->src_data) {
+        if(s->src_size < len || s->src_pos > s->src_size - len) return LV_RES_INV;
+        lv_memcpy(buf, s->src_data + s->src_pos, len);
+    }
+    else {
+        uint32_t br;
+        lv_fs_res_t res = lv_fs_read(&s->f, buf, len, &br);
+        if(res != LV_FS_RES_OK || br != len) return LV_RES_INV;
+    }
+
+    s->src_pos += len;
+    return LV_RES_OK;
+}
+
+static lv_res_t stream_src_seek(png_stream_t * s, uint32_t pos)
+{
+    if(s->src_data) {
+        if(pos > s->src_size) return LV_RES_INV;
+    }
+    else {
+        if(lv_fs_seek(&s->f, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+    }
+
+    s->src_pos = pos;
+    return LV_RES_OK;
+}
+
+/**
+ * Make the next bytes of the IDAT chunks available in `in_p`.
+ * The compressed data can be split into any number of consecutive IDAT chunks.
+ */
+static bool stream_refill(png_stream_t * s)
+{
+    while(s->idat_remain == 0) {
+        /*Skip the CRC of the current chunk and read the header of the next one*/
+        uint8_t buf[12];
+        if(stream_src_read(s, buf, 12) != LV_RES_OK) return false;
+        if(memcmp(buf + 8, "IDAT", 4) != 0) return false;
+        s->idat_remain = read_u32_be(buf + 4);
+    }
+
+    if(s->src_data) {
+        /*No need to copy the data, just point to it*/
+        uint32_t n = s->idat_remain;
+        if(s->src_size < n || s->src_pos > s->src_size - n) return false;
+        s->in_p = s->src_data + s->src_pos;
+        s->in_len = n;
+        s->src_pos += n;
+        s->idat_remain = 0;
+    }
+    else {
+        uint32_t n = LV_MIN(s->idat_remain, STREAM_IN_BUF_SIZE);
+        if(stream_src_read(s, s->in_buf, n) != LV_RES_OK) return false;
+        s->in_p = s->in_buf;
+        s->in_len = n;
+        s->idat_remain -= n;
+    }
 
+    return true;
+}
+
+/**
+ * Make sure there are at least `n` bits in the bit buffer
+ * @return      false: the end of the data is reached (less than `n` bits might be available)
+ */
+static bool stream_need_bits(png_stream_t * s, uint32_t n)
+{
+    while(s->bit_cnt < n) {
+        if(s->in_len == 0 && !stream_refill(s)) return false;
+        s->bit_buf |= (uint32_t)(*s->in_p) << s->bit_cnt;
+        s->in_p++;
+        s->in_len--;
+        s->bit_cnt += 8;
+    }
+    return true;
+}
+
+/**
+ * Read `n` (max. 16) bits from the deflate stream
+ * @return      the read value or -1 on error
+ */
+static int32_t stream_get_bits(png_stream_t * s, uint32_t n)
+{
+    if(!stream_need_bits(s, n)) return -1;
+
+    int32_t v = s->bit_buf & ((1UL << n) - 1);
+    s->bit_buf >>= n;
+    s->bit_cnt -= n;
+    return v;
+}
+
+static inline void inflate_put(png_stream_t * s, uint8_t * out, uint8_t b)
+{
+    *out = b;
+    s->window[s->out_cnt & (STREAM_WINDOW_SIZE - 1)] = b;
+    s->out_cnt++;
+}
+
+/**
+ * Inflate exactly `len` bytes. Decoding stops in the middle of a block if required
+ * and continues from there on the next call.
+ * @param s     pointer to a stream descriptor
+ * @param out   store the inflated data here
+ * @param len   number of bytes to inflate
+ * @return      LV_RES_OK: `len` bytes were inflated; LV_RES_INV: invalid or too short data
+ */
+static lv_res_t inflate_read(png_stream_t * s, uint8_t * out, uint32_t len)
+{
+    static const uint16_t len_base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                          35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+                                         };
+    static const uint8_t len_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                          3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+                                         };
+    static const uint16_t dist_base[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                           257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+                                          };
+    static const uint8_t dist_extra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                           7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+                                          };
+
+    uint32_t i = 0;
+    while(i < len) {
+        /*Finish the pending back reference first*/
+        if(s->copy_len) {
+            uint8_t b = s->window[(s->out_cnt - s->copy_dist) & (STREAM_WINDOW_SIZE - 1)];
+            inflate_put(s, &out[i], b);
+            i++;
+            s->copy_len--;
+            continue;
+        }
+
+        switch(s->state) {
+            case PNG_INFLATE_BLOCK_HEADER: {
+                    if(s->last_block) {
+                        s->state = PNG_INFLATE_DONE;
+                        break;
+                    }
+
+                    int32_t hdr = stream_get_bits(s, 3);
+                    if(hdr < 0) return LV_RES_INV;
+                    s->last_block = hdr & 0x1;
+                    int32_t type = hdr >> 1;
+                    if(type == 0) {
+                        /*Stored blocks start on byte boundary*/
+                        s->bit_buf >>= s->bit_cnt & 0x7;
+                        s->bit_cnt -= s->bit_cnt & 0x7;
+                        int32_t stored_len = stream_get_bits(s, 16);
+                        int32_t stored_nlen = stream_get_bits(s, 16);
+                        if(stored_len < 0 || stored_nlen < 0 || (stored_len ^ 0xffff) != stored_nlen) return LV_RES_INV;
+                        s->stored_remain = stored_len;
+                        s->state = PNG_INFLATE_STORED;
+                    }
+                    else if(type == 1) {
+                        uint8_t lengths[288];
+                        uint32_t j;
+                        for(j = 0; j < 144; j++) lengths[j] = 8;
+                        for(; j < 256; j++) lengths[j] = 9;
+                        for(; j < 280; j++) lengths[j] = 7;
+                        for(; j < 288; j++) lengths[j] = 8;
+                        huff_build(&s->lit, lengths, 288);
+                        for(j = 0; j < 30; j++) lengths[j] = 5;
+                        huff_build(&s->dist, lengths, 30);
+                        s->state = PNG_INFLATE_HUFFMAN;
+                    }
+                    else if(type == 2) {
+                        if(inflate_dynamic_tables(s) != LV_RES_OK) return LV_RES_INV;
+                        s->state = PNG_INFLATE_HUFFMAN;
+                    }
+                    else {
+                        return LV_RES_INV;
+                    }
+                    break;
+                }
+            case PNG_INFLATE_STORED: {
+                    if(s->stored_remain == 0) {
+                        s->state = PNG_INFLATE_BLOCK_HEADER;
+                        break;
+                    }
+                    int32_t b = stream_get_bits(s, 8);
+                    if(b < 0) return LV_RES_INV;
+                    inflate_put(s, &out[i], (uint8_t)b);
+                    i++;
+                    s->stored_remain--;
+                    break;
+                }
+            case PNG_INFLATE_HUFFMAN: {
+                    int32_t sym = huff_decode(s, &s->lit);
+                    if(sym < 0) return LV_RES_INV;
+                    if(sym < 256) {
+                        inflate_put(s, &out[i], (uint8_t)sym);
+                        i++;
+                    }
+                    else if(sym == 256) {
+                        s->state = PNG_INFLATE_BLOCK_HEADER;
+                    }
+                    else {
+                        sym -= 257;
+                        if(sym >= 29) return LV_RES_INV;
+                        int32_t extra = stream_get_bits(s, len_extra[sym]);
+                        if(extra < 0) return LV_RES_INV;
+                        s->copy_len = len_base[sym] + extra;
+
+                        sym = huff_decode(s, &s->dist);
+                        if(sym < 0 || sym >= 30) return LV_RES_INV;
+                        extra = stream_get_bits(s, dist_extra[sym]);
+                        if(extra < 0) return LV_RES_INV;
+                        s->copy_dist = dist_base[sym] + extra;
+                        if(s->copy_dist > s->out_cnt) return LV_RES_INV;
+                    }
+                    break;
+                }
+            case PNG_INFLATE_DONE:
+            default:
+                return LV_RES_INV;
+        }
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Read the code lengths of a dynamic block and build the Huffman tables from them
+ */
+static lv_res_t inflate_dynamic_tables(png_stream_t * s)
+{
+    static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    uint8_t lengths[286 + 30];
+
+    int32_t nlen = stream_get_bits(s, 5);
+    int32_t ndist = stream_get_bits(s, 5);
+    int32_t ncode = stream_get_bits(s, 4);
+    if(nlen < 0 || ndist < 0 || ncode < 0) return LV_RES_INV;
+    nlen += 257;
+    ndist += 1;
+    ncode += 4;
+    if(nlen > 286 || ndist > 30) return LV_RES_INV;
+
+    int32_t i;
+    for(i = 0; i < ncode; i++) {
+        int32_t v = stream_get_bits(s, 3);
+        if(v < 0) return LV_RES_INV;
+        lengths[order[i]] = (uint8_t)v;
+    }
+    for(; i < 19; i++) lengths[order[i]] = 0;
+
+    /*Use the literal table temporarily for the code length codes*/
+    if(huff_build(&s->lit, lengths, 19) != 0) return LV_RES_INV;
+
+    i = 0;
+    while(i < nlen + ndist) {
+        int32_t sym = huff_decode(s, &s->lit);
+        if(sym < 0) return LV_RES_INV;
+        if(sym < 16) {
+            lengths[i++] = (uint8_t)sym;
+        }
+        else {
+            uint8_t len = 0;
+            int32_t rep;
+            if(sym == 16) {
+                if(i == 0) return LV_RES_INV;
+                len = lengths[i - 1];
+                rep = stream_get_bits(s, 2);
+                if(rep < 0) return LV_RES_INV;
+                rep += 3;
+            }
+            else if(sym == 17) {
+                rep = stream_get_bits(s, 3);
+                if(rep < 0) return LV_RES_INV;
+                rep += 3;
+            }
+            else {
+                rep = stream_get_bits(s, 7);
+                if(rep < 0) return LV_RES_INV;
+                rep += 11;
+            }
+            if(i + rep > nlen + ndist) return LV_RES_INV;
+            while(rep--) lengths[i++] = len;
+        }
+    }
+
+    /*The end-of-block code is required*/
+    if(lengths[256] == 0) return LV_RES_INV;
+
+    if(huff_build(&s->lit, lengths, nlen) < 0) return LV_RES_INV;
+    if(huff_build(&s->dist, lengths + nlen, ndist) < 0) return LV_RES_INV;
+
+    return LV_RES_OK;
+}
+
+/**
+ * Build canonical Huffman decoding tables from code lengths
+ * @param h         the table to build
+ * @param lengths   code length of each symbol
+ * @param n         number of symbols
+ * @return          0: complete code; >0: incomplete code; <0: over-subscribed (invalid) code
+ */
+static int32_t huff_build(png_huff_t * h, const uint8_t * lengths, uint32_t n)
+{
+    uint32_t sym;
+    uint32_t len;
+
+    lv_memzero(h->count, sizeof(h->count));
+    lv_memzero(h->fast, sizeof(h->fast));
+    for(sym = 0; sym < n; sym++) h->count[lengths[sym]]++;
+    if(h->count[0] == n) return 0;
+
+    int32_t left = 1;
+    for(len = 1; len < 16; len++) {
+        left <<= 1;
+        left -= h->count[len];
+        if(left < 0) return left;
+    }
+
+    uint16_t offs[16];
+    offs[1] = 0;
+    for(len = 1; len < 15; len++) offs[len + 1] = offs[len] + h->count[len];
+    for(sym = 0; sym < n; sym++) {
+        if(lengths[sym] != 0) h->symbol[offs[lengths[sym]]++] = sym;
+    }
+
+    /*Deflate stores Huffman codes starting from the MSB so the reversed short codes index the fast table*/
+    uint32_t code = 0;
+    uint32_t idx = 0;
+    for(len = 1; len <= STREAM_HUFF_FAST_BITS; len++) {
+        uint32_t i;
+        for(i = 0; i < h->count[len]; i++) {
+            uint32_t rev = 0;
+            uint32_t b;
+            for(b = 0; b < len; b++) rev |= ((code >> b) & 0x1) << (len - 1 - b);
+
+            uint16_t entry = (uint16_t)((len << 9) | h->symbol[idx]);
+            for(b = rev; b < (1 << STREAM_HUFF_FAST_BITS); b += 1 << len) h->fast[b] = entry;
+            code++;
+            idx++;
+        }
+        code <<= 1;
+    }
+
+    return left;
+}
+
+/**
+ * Decode the next symbol
+ * @return      the symbol or -1 on error
+ */
+static int32_t huff_decode(png_stream_t * s, const png_huff_t * h)
+{
+    /*Near the end of the stream there might be less bits but it's handled below*/
+    stream_need_bits(s, STREAM_HUFF_FAST_BITS);
+
+    uint16_t entry = h->fast[s->bit_buf & ((1 << STREAM_HUFF_FAST_BITS) - 1)];
+    if(entry && (uint32_t)(entry >> 9) <= s->bit_cnt) {
+        s->bit_buf >>= entry >> 9;
+        s->bit_cnt -= entry >> 9;
+        return entry & 0x1ff;
+    }
+
+    /*Long code: decode it bit by bit*/
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    uint32_t len;
+    for(len = 1; len < 16; len++) {
+        int32_t b = stream_get_bits(s, 1);
+        if(b < 0) return -1;
+        code |= b;
+        int32_t count = h->count[len];
+        if(code - count < first) return h->symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+static inline uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int32_t p = (int32_t)a + b - c;
+    int32_t pa = LV_ABS(p - a);
+    int32_t pb = LV_ABS(p - b);
+    int32_t pc = LV_ABS(p - c);
+    if(pa <= pb && pa <= pc) return a;
+    else if(pb <= pc) return b;
+    else return c;
+}
+
+/**
+ * Undo the filtering of `row_cur` using `row_prev`
+ */
+static lv_res_t unfilter_row(png_stream_t * s, uint8_t filter)
+{
+    uint8_t * cur = s->row_cur;
+    const uint8_t * prev = s->row_prev;
+    uint32_t bpp = s->filter_bpp;
+    uint32_t n = s->row_bytes;
+    uint32_t i;
+
+    switch(filter) {
+        case 0:     /*None*/
+            break;
+        case 1:     /*Sub*/
+            for(i = bpp; i < n; i++) cur[i] += cur[i - bpp];
+            break;
+        case 2:     /*Up*/
+            for(i = 0; i < n; i++) cur[i] += prev[i];
+            break;
+        case 3:     /*Average*/
+            for(i = 0; i < bpp; i++) cur[i] += prev[i] >> 1;
+            for(; i < n; i++) cur[i] += (cur[i - bpp] + prev[i]) >> 1;
+            break;
+        case 4:     /*Paeth*/
+            for(i = 0; i < bpp; i++) cur[i] += prev[i];
+            for(; i < n; i++) cur[i] += paeth(cur[i - bpp], prev[i], prev[i - bpp]);
+            break;
+        default:
+            return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Get a 1, 2, 4 or 8 bit sample from a packed row
+ */
+static inline uint8_t get_packed_sample(const uint8_t * in, uint32_t x, uint8_t bit_depth)
+{
+    uint32_t bit = x * bit_depth;
+    uint8_t shift = 8 - bit_depth - (bit & 0x7);
+    return (in[bit >> 3] >> shift) & ((1 << bit_depth) - 1);
+}
+
+/**
+ * Convert an unfiltered row to ARGB8888
+ */
+static void convert_row(const png_stream_t * s, const uint8_t * in, lv_color32_t * out)
+{
+    uint32_t x;
+    uint32_t w = s->w;
+
+    switch(s->color_type) {
+        case 0:     /*Grayscale*/
+            if(s->bit_depth == 16) {
+                for(x = 0; x < w; x++) {
+                    uint16_t v = (in[x * 2] << 8) | in[x * 2 + 1];
+                    out[x].red = out[x].green = out[x].blue = in[x * 2];
+                    out[x].alpha = s->has_trns_key && v == s->trns_key[0] ? 0x00 : 0xff;
+                }
+            }
+            else {
+                /*Scale the value to 0..255*/
+                uint8_t mult = s->bit_depth == 1 ? 255 : s->bit_depth == 2 ? 85 : s->bit_depth == 4 ? 17 : 1;
+                for(x = 0; x < w; x++) {
+                    uint8_t v = get_packed_sample(in, x, s->bit_depth);
+                    out[x].red = out[x].green = out[x].blue = v * mult;
+                    out[x].alpha = s->has_trns_key && v == s->trns_key[0] ? 0x00 : 0xff;
+                }
+            }
+            break;
+        case 2:     /*RGB*/
+            if(s->bit_depth == 16) {
+                for(x = 0; x < w; x++) {
+                    const uint8_t * p = &in[x * 6];
+                    out[x].red = p[0];
+                    out[x].green = p[2];
+                    out[x].blue = p[4];
+                    out[x].alpha = 0xff;
+                    if(s->has_trns_key &&
+                       ((p[0] << 8) | p[1]) == s->trns_key[0] &&
+                       ((p[2] << 8) | p[3]) == s->trns_key[1] &&
+                       ((p[4] << 8) | p[5]) == s->trns_key[2]) {
+                        out[x].alpha = 0x00;
+                    }
+                }
+            }
+            else {
+                for(x = 0; x < w; x++) {
+                    const uint8_t * p = &in[x * 3];
+                    out[x].red = p[0];
+                    out[x].green = p[1];
+                    out[x].blue = p[2];
+                    out[x].alpha = 0xff;
+                    if(s->has_trns_key && p[0] == s->trns_key[0] && p[1] == s->trns_key[1] && p[2] == s->trns_key[2]) {
+                        out[x].alpha = 0x00;
+                    }
+                }
+            }
+            break;
+        case 3:     /*Indexed*/
+            if(s->bit_depth == 8) {
+                for(x = 0; x < w; x++) out[x] = s->palette[in[x]];
+            }
+            else {
+                for(x = 0; x < w; x++) out[x] = s->palette[get_packed_sample(in, x, s->bit_depth)];
+            }
+            break;
+        case 4:     /*Grayscale with alpha*/
+            if(s->bit_depth == 16) {
+                for(x = 0; x < w; x++) {
+                    out[x].red = out[x].green = out[x].blue = in[x * 4];
+                    out[x].alpha = in[x * 4 + 2];
+                }
+            }
+            else {
+                for(x = 0; x < w; x++) {
+                    out[x].red = out[x].green = out[x].blue = in[x * 2];
+                    out[x].alpha = in[x * 2 + 1];
+                }
+            }
+            break;
+        case 6:     /*RGBA*/
+            if(s->bit_depth == 16) {
+                for(x = 0; x < w; x++) {
+                    const uint8_t * p = &in[x * 8];
+                    out[x].red = p[0];
+                    out[x].green = p[2];
+                    out[x].blue = p[4];
+                    out[x].alpha = p[6];
+                }
+            }
+            else {
+                for(x = 0; x < w; x++) {
+                    const uint8_t * p = &in[x * 4];
+                    out[x].red = p[0];
+                    out[x].green = p[1];
+                    out[x].blue = p[2];
+                    out[x].alpha = p[3];
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+#endif /*LV_PNG_USE_STREAM*/
+
+#endif /*LV_USE_PNG*/
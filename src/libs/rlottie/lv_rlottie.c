@@ -10,6 +10,7 @@
 #if LV_USE_RLOTTIE
 
 #include <rlottie_capi.h>
+#include "../../osal/lv_os.h"
 
 /*********************
 *      DEFINES
@@ -17,10 +18,37 @@
 #define MY_CLASS &lv_rlottie_class
 #define LV_ARGB32   32
 
+/*The frames are stored in the format which is the fastest to draw*/
+#if LV_COLOR_DEPTH == 16
+    #define FRAME_CF        LV_COLOR_FORMAT_RGB565A8
+    #define FRAME_PX_SIZE   3
+#else
+    #define FRAME_CF        LV_COLOR_FORMAT_ARGB8888
+    #define FRAME_PX_SIZE   4
+#endif
+
+#if LV_RLOTTIE_USE_THREAD
+    #if LV_USE_OS == LV_OS_NONE
+        #error "LV_RLOTTIE_USE_THREAD requires LV_USE_OS"
+    #endif
+    #define RENDER_LOCK()   lv_mutex_lock(&render_mutex)
+    #define RENDER_UNLOCK() lv_mutex_unlock(&render_mutex)
+#else
+    #define RENDER_LOCK()
+    #define RENDER_UNLOCK()
+#endif
+
 /**********************
 *      TYPEDEFS
 **********************/
-#define LV_ARGB32   32
+#if LV_RLOTTIE_USE_THREAD
+typedef enum {
+    RENDER_STATE_IDLE,
+    RENDER_STATE_REQUESTED,     /*Waiting for the render thread*/
+    RENDER_STATE_RENDERING,
+    RENDER_STATE_READY,         /*`ready_frame` is rendered*/
+} render_state_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -28,6 +56,22 @@
 static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static bool show_frame(lv_obj_t * obj, size_t frame);
+static void render_frame(lv_rlottie_t * rlottie, size_t frame, uint8_t * dst);
+static uint8_t * render_frame_cached(lv_rlottie_t * rlottie, size_t frame, uint8_t * fallback_buf);
+#if LV_COLOR_DEPTH == 16
+    static void argb8888_to_rgb565a8(const uint32_t * src, uint8_t * dst, uint32_t px_cnt);
+#endif
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    static void cache_free(lv_rlottie_t * rlottie);
+#endif
+#if LV_RLOTTIE_USE_THREAD
+    static void thread_rlottie_add(lv_rlottie_t * rlottie);
+    static void thread_rlottie_remove(lv_rlottie_t * rlottie);
+    static void thread_request_frame(lv_rlottie_t * rlottie, size_t frame);
+    static void thread_request_next_frame(lv_rlottie_t * rlottie, size_t frame);
+    static void render_thread_cb(void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -44,6 +88,19 @@ static lv_coord_t create_height;
 static const char * rlottie_desc_create;
 static const char * path_create;
 
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    static size_t cache_used;           /*Total size of the cached frames of all animations*/
+#endif
+
+#if LV_RLOTTIE_USE_THREAD
+    static bool thread_inited;
+    static lv_thread_t render_thread;
+    static lv_thread_sync_t render_sync;    /*Wakes up the render thread*/
+    static lv_thread_sync_t idle_sync;      /*Signaled when the render thread finished a frame*/
+    static lv_mutex_t render_mutex;         /*Protects the list of animations, their render state and cache*/
+    static lv_rlottie_t * rlottie_head;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -126,15 +183,25 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
 
     rlottie->scanline_width = create_width * LV_ARGB32 / 8;
 
-    size_t allocaled_buf_size = (create_width * create_height * LV_ARGB32 / 8);
+    size_t allocaled_buf_size = (create_width * create_height * FRAME_PX_SIZE);
     rlottie->allocated_buf = lv_malloc(allocaled_buf_size);
     if(rlottie->allocated_buf != NULL) {
         rlottie->allocated_buffer_size = allocaled_buf_size;
         memset(rlottie->allocated_buf, 0, allocaled_buf_size);
     }
 
+#if LV_COLOR_DEPTH == 16
+    rlottie->render_buf = lv_malloc(create_width * create_height * LV_ARGB32 / 8);
+    LV_ASSERT_MALLOC(rlottie->render_buf);
+#endif
+
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    rlottie->frame_cache = lv_malloc(rlottie->total_frames * sizeof(uint8_t *));
+    if(rlottie->frame_cache) lv_memzero(rlottie->frame_cache, rlottie->total_frames * sizeof(uint8_t *));
+#endif
+
     rlottie->imgdsc.header.always_zero = 0;
-    rlottie->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+    rlottie->imgdsc.header.cf = FRAME_CF;
     rlottie->imgdsc.header.h = create_height;
     rlottie->imgdsc.header.w = create_width;
     rlottie->imgdsc.data = (void *)rlottie->allocated_buf;
@@ -145,8 +212,14 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     rlottie->play_ctrl = LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY | LV_RLOTTIE_CTRL_LOOP;
     rlottie->dest_frame = rlottie->total_frames; /* invalid destination frame so it's possible to pause on frame 0 */
 
+    rlottie->shown_frame = SIZE_MAX;   /*Nothing is rendered yet*/
+
     rlottie->task = lv_timer_create(next_frame_task_cb, 1000 / rlottie->framerate, obj);
 
+#if LV_RLOTTIE_USE_THREAD
+    thread_rlottie_add(rlottie);
+#endif
+
     lv_obj_update_layout(obj);
 }
 
@@ -156,6 +229,14 @@ static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     LV_UNUSED(class_p);
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
 
+#if LV_RLOTTIE_USE_THREAD
+    thread_rlottie_remove(rlottie);
+#endif
+
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    cache_free(rlottie);
+#endif
+
     if(rlottie->animation) {
         lottie_animation_destroy(rlottie->animation);
         rlottie->animation = 0;
@@ -179,12 +260,18 @@ static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
         rlottie->allocated_buffer_size = 0;
     }
 
+#if LV_COLOR_DEPTH == 16
+    lv_free(rlottie->render_buf);
+    rlottie->render_buf = NULL;
+#endif
 }
 
 static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    size_t prev_frame = rlottie->current_frame;
+    size_t prev_dest_frame = rlottie->dest_frame;
 
     if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_PAUSE) == LV_RLOTTIE_CTRL_PAUSE) {
         if(rlottie->current_frame == rlottie->dest_frame) {
@@ -223,16 +310,330 @@ static void next_frame_task_cb(lv_timer_t * t)
         }
     }
 
-    lottie_animation_render(
-        rlottie->animation,
-        rlottie->current_frame,
-        rlottie->allocated_buf,
-        rlottie->imgdsc.header.w,
-        rlottie->imgdsc.header.h,
-        rlottie->scanline_width
-    );
+    if(!show_frame(obj, rlottie->current_frame)) {
+        /*The frame is not rendered yet, try again later*/
+        rlottie->current_frame = prev_frame;
+        rlottie->dest_frame = prev_dest_frame;
+    }
+}
+
+/**
+ * Show a frame of the animation
+ * @param obj       pointer to an rlottie object
+ * @param frame     index of the frame
+ * @return          true: the frame is shown; false: the frame is being rendered on the render thread
+ */
+static bool show_frame(lv_obj_t * obj, size_t frame)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    if(rlottie->allocated_buf == NULL) return true;
+
+    if(frame >= rlottie->total_frames) frame = rlottie->total_frames - 1;
+    if(frame == rlottie->shown_frame) return true;
+
+    const uint8_t * data = NULL;
+#if LV_RLOTTIE_USE_THREAD
+    if(rlottie->back_buf) {
+        RENDER_LOCK();
+#if LV_RLOTTIE_CACHE_SIZE > 0
+        if(rlottie->frame_cache) data = rlottie->frame_cache[frame];
+#endif
+        if(data == NULL && rlottie->render_state == RENDER_STATE_READY && rlottie->ready_frame == frame) {
+            data = rlottie->ready_data;
+            rlottie->render_state = RENDER_STATE_IDLE;
+
+            /*Show the rendered buffer and let the thread render into the previous one*/
+            if(data == rlottie->back_buf) {
+                rlottie->back_buf = (uint8_t *)rlottie->allocated_buf;
+                rlottie->allocated_buf = (uint32_t *)data;
+            }
+        }
+        RENDER_UNLOCK();
+
+        if(data == NULL) {
+            thread_request_frame(rlottie, frame);
+            return false;
+        }
+    }
+#endif
+
+    /*Render on this thread*/
+    if(data == NULL) data = render_frame_cached(rlottie, frame, (uint8_t *)rlottie->allocated_buf);
 
+    rlottie->imgdsc.data = data;
+    rlottie->shown_frame = frame;
+    lv_img_cache_invalidate_src(&rlottie->imgdsc);
     lv_obj_invalidate(obj);
+
+#if LV_RLOTTIE_USE_THREAD
+    thread_request_next_frame(rlottie, frame);
+#endif
+
+    return true;
+}
+
+/**
+ * Render a frame in the format of the frame buffers
+ * @param rlottie   pointer to an rlottie object
+ * @param frame     index of the frame
+ * @param dst       buffer for the pixels
+ */
+static void render_frame(lv_rlottie_t * rlottie, size_t frame, uint8_t * dst)
+{
+#if LV_COLOR_DEPTH == 16
+    lottie_animation_render(rlottie->animation, frame, rlottie->render_buf,
+                            rlottie->imgdsc.header.w, rlottie->imgdsc.header.h, rlottie->scanline_width);
+    argb8888_to_rgb565a8(rlottie->render_buf, dst, rlottie->imgdsc.header.w * rlottie->imgdsc.header.h);
+#else
+    lottie_animation_render(rlottie->animation, frame, (uint32_t *)dst,
+                            rlottie->imgdsc.header.w, rlottie->imgdsc.header.h, rlottie->scanline_width);
+#endif
+}
+
+/**
+ * Render a frame into the cache, or if the cache is full into a buffer
+ * @param rlottie       pointer to an rlottie object
+ * @param frame         index of a frame which is not cached yet
+ * @param fallback_buf  render here if the frame can't be cached
+ * @return              the buffer with the rendered frame
+ */
+static uint8_t * render_frame_cached(lv_rlottie_t * rlottie, size_t frame, uint8_t * fallback_buf)
+{
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    size_t buf_size = rlottie->allocated_buffer_size;
+    uint8_t * buf = NULL;
+
+    RENDER_LOCK();
+    if(rlottie->frame_cache && rlottie->frame_cache[frame]) {
+        buf = rlottie->frame_cache[frame];
+        RENDER_UNLOCK();
+        return buf;
+    }
+
+    bool cacheable = rlottie->frame_cache && cache_used + buf_size <= LV_RLOTTIE_CACHE_SIZE;
+    if(cacheable) cache_used += buf_size;
+    RENDER_UNLOCK();
+
+    if(cacheable) {
+        buf = lv_malloc(buf_size);
+        if(buf == NULL) {
+            RENDER_LOCK();
+            cache_used -= buf_size;
+            RENDER_UNLOCK();
+        }
+    }
+
+    if(buf == NULL) {
+        render_frame(rlottie, frame, fallback_buf);
+        return fallback_buf;
+    }
+
+    render_frame(rlottie, frame, buf);
+    RENDER_LOCK();
+    rlottie->frame_cache[frame] = buf;
+    RENDER_UNLOCK();
+    return buf;
+#else
+    render_frame(rlottie, frame, fallback_buf);
+    return fallback_buf;
+#endif
+}
+
+#if LV_COLOR_DEPTH == 16
+/**
+ * Convert the pixels rendered by rlottie to RGB565 color and A8 alpha planes
+ * @param src       ARGB8888 pixels
+ * @param dst       buffer for `px_cnt` RGB565 colors followed by `px_cnt` alpha values
+ * @param px_cnt    number of pixels
+ */
+static void argb8888_to_rgb565a8(const uint32_t * src, uint8_t * dst, uint32_t px_cnt)
+{
+    uint16_t * dst_color = (uint16_t *)dst;
+    uint8_t * dst_alpha = dst + px_cnt * 2;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t c = src[i];
+        dst_color[i] = ((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F);
+        dst_alpha[i] = c >> 24;
+    }
+}
+#endif
+
+#if LV_RLOTTIE_CACHE_SIZE > 0
+/**
+ * Free the cached frames of an animation
+ * @param rlottie   pointer to an rlottie object
+ */
+static void cache_free(lv_rlottie_t * rlottie)
+{
+    if(rlottie->frame_cache == NULL) return;
+
+    RENDER_LOCK();
+    size_t i;
+    for(i = 0; i < rlottie->total_frames; i++) {
+        if(rlottie->frame_cache[i]) {
+            lv_free(rlottie->frame_cache[i]);
+            cache_used -= rlottie->allocated_buffer_size;
+        }
+    }
+    RENDER_UNLOCK();
+
+    lv_free(rlottie->frame_cache);
+    rlottie->frame_cache = NULL;
+}
+#endif
+
+#if LV_RLOTTIE_USE_THREAD
+
+/**
+ * Start rendering the frames of an animation on the render thread
+ * @param rlottie   pointer to an rlottie object
+ */
+static void thread_rlottie_add(lv_rlottie_t * rlottie)
+{
+    /*The render thread can't be deleted so it's created only once*/
+    if(!thread_inited) {
+        thread_inited = true;
+        lv_mutex_init(&render_mutex);
+        lv_thread_sync_init(&render_sync);
+        lv_thread_sync_init(&idle_sync);
+        lv_thread_init(&render_thread, LV_THREAD_PRIO_MID, render_thread_cb, 32 * 1024, NULL);
+    }
+
+    if(rlottie->allocated_buf == NULL) return;
+
+    rlottie->back_buf = lv_malloc(rlottie->allocated_buffer_size);
+    if(rlottie->back_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the back buffer");
+        return;
+    }
+
+    rlottie->render_state = RENDER_STATE_IDLE;
+
+    RENDER_LOCK();
+    rlottie->next = rlottie_head;
+    rlottie_head = rlottie;
+    RENDER_UNLOCK();
+
+    /*Render the first frame to show*/
+    thread_request_next_frame(rlottie, rlottie->current_frame);
+}
+
+/**
+ * Stop rendering the frames of an animation on the render thread and free the back buffer
+ * @param rlottie   pointer to an rlottie object
+ */
+static void thread_rlottie_remove(lv_rlottie_t * rlottie)
+{
+    if(rlottie->back_buf == NULL) return;
+
+    /*Cancel the requested frame or wait until the render thread finishes it*/
+    RENDER_LOCK();
+    if(rlottie->render_state == RENDER_STATE_REQUESTED) rlottie->render_state = RENDER_STATE_IDLE;
+    while(rlottie->render_state == RENDER_STATE_RENDERING) {
+        RENDER_UNLOCK();
+        lv_thread_sync_wait(&idle_sync);
+        RENDER_LOCK();
+    }
+
+    lv_rlottie_t ** prev_next = &rlottie_head;
+    while(*prev_next != rlottie) prev_next = &(*prev_next)->next;
+    *prev_next = rlottie->next;
+    RENDER_UNLOCK();
+
+    lv_free(rlottie->back_buf);
+    rlottie->back_buf = NULL;
 }
 
+/**
+ * Ask the render thread to render a frame
+ * @param rlottie   pointer to an rlottie object
+ * @param frame     index of the frame
+ */
+static void thread_request_frame(lv_rlottie_t * rlottie, size_t frame)
+{
+    if(rlottie->back_buf == NULL) return;
+
+    RENDER_LOCK();
+    /*A frame being rendered can't be changed. If it's a different frame it will be requested again*/
+    bool changed = true;
+    if(rlottie->render_state == RENDER_STATE_RENDERING) changed = false;
+    else if(rlottie->render_state == RENDER_STATE_READY && rlottie->ready_frame == frame) changed = false;
+    else if(rlottie->render_state == RENDER_STATE_REQUESTED && rlottie->req_frame == frame) changed = false;
+
+    if(changed) {
+        rlottie->req_frame = frame;
+        rlottie->render_state = RENDER_STATE_REQUESTED;
+    }
+    RENDER_UNLOCK();
+
+    if(changed) lv_thread_sync_signal(&render_sync);
+}
+
+/**
+ * Render the frame which will be probably shown after a given frame
+ * @param rlottie   pointer to an rlottie object
+ * @param frame     index of the shown frame
+ */
+static void thread_request_next_frame(lv_rlottie_t * rlottie, size_t frame)
+{
+    if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_PAUSE) == LV_RLOTTIE_CTRL_PAUSE) return;
+
+    bool loop = (rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP;
+    if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_BACKWARD) == LV_RLOTTIE_CTRL_BACKWARD) {
+        if(frame > 0) frame--;
+        else if(loop) frame = rlottie->total_frames - 1;
+        else return;
+    }
+    else {
+        if(frame + 1 < rlottie->total_frames) frame++;
+        else if(loop) frame = 0;
+        else return;
+    }
+
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    RENDER_LOCK();
+    bool cached = rlottie->frame_cache && rlottie->frame_cache[frame];
+    RENDER_UNLOCK();
+    if(cached) return;
+#endif
+
+    thread_request_frame(rlottie, frame);
+}
+
+static void render_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    while(1) {
+        RENDER_LOCK();
+        lv_rlottie_t * rlottie;
+        for(rlottie = rlottie_head; rlottie; rlottie = rlottie->next) {
+            if(rlottie->render_state == RENDER_STATE_REQUESTED) break;
+        }
+
+        if(rlottie == NULL) {
+            RENDER_UNLOCK();
+            lv_thread_sync_wait(&render_sync);
+            continue;
+        }
+
+        rlottie->render_state = RENDER_STATE_RENDERING;
+        size_t frame = rlottie->req_frame;
+        RENDER_UNLOCK();
+
+        /*The back buffer is not shown so it can be written*/
+        uint8_t * data = render_frame_cached(rlottie, frame, rlottie->back_buf);
+
+        RENDER_LOCK();
+        rlottie->ready_data = data;
+        rlottie->ready_frame = frame;
+        rlottie->render_state = RENDER_STATE_READY;
+        RENDER_UNLOCK();
+        lv_thread_sync_signal(&idle_sync);
+    }
+}
+
+#endif /*LV_RLOTTIE_USE_THREAD*/
+
 #endif /*LV_USE_RLOTTIE*/
@@ -33,7 +33,7 @@ typedef enum {
 
 /** definition in lottieanimation_capi.c */
 struct Lottie_Animation_S;
-typedef struct {
+typedef struct _lv_rlottie_t {
     lv_img_t img_ext;
     struct Lottie_Animation_S * animation;
     lv_timer_t * task;
@@ -46,6 +46,21 @@ typedef struct {
     size_t scanline_width;
     lv_rlottie_ctrl_t play_ctrl;
     size_t dest_frame;
+    size_t shown_frame;             /*The frame in `imgdsc`*/
+#if LV_COLOR_DEPTH == 16
+    uint32_t * render_buf;          /*rlottie renders ARGB8888 here which is converted to RGB565A8*/
+#endif
+#if LV_RLOTTIE_CACHE_SIZE > 0
+    uint8_t ** frame_cache;         /*The rendered frames indexed by the frame number. NULL: not cached*/
+#endif
+#if LV_RLOTTIE_USE_THREAD
+    struct _lv_rlottie_t * next;    /*Next animation handled by the render thread*/
+    uint8_t * back_buf;             /*The render thread renders the not cached frames here*/
+    const uint8_t * ready_data;     /*The pixels of `ready_frame`*/
+    size_t req_frame;               /*The frame to render on the render thread*/
+    size_t ready_frame;             /*The frame rendered by the render thread*/
+    uint8_t render_state;
+#endif
 } lv_rlottie_t;
 
 extern const lv_obj_class_t lv_rlottie_class;
@@ -51,6 +51,7 @@
 #include "tjpgd.h"
 #include "lv_sjpg.h"
 #include "../../misc/lv_fs.h"
+#include "../../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -65,6 +66,29 @@
 #define SJPEG_BLOCK_WIDTH_OFFSET        20
 #define SJPEG_FRAME_INFO_ARRAY_OFFSET   22
 
+/*The decoded slices are stored in the format of the read lines.
+ *tjpgd creates RGB565 itself (see `JD_FORMAT`) and RGB888 is stored in LVGL's byte order,
+ *so the lines are simply copied. On 32 bit displays the blending converts RGB888 to the display's format.*/
+#if LV_COLOR_DEPTH == 16
+#define SJPG_COLOR_FORMAT               LV_COLOR_FORMAT_RGB565
+#define SJPG_PX_SIZE                    2
+#elif LV_COLOR_DEPTH == 8
+#define SJPG_COLOR_FORMAT               LV_COLOR_FORMAT_NATIVE    /*Converted from RGB888 in `read_line`*/
+#define SJPG_PX_SIZE                    3
+#else
+#define SJPG_COLOR_FORMAT               LV_COLOR_FORMAT_RGB888
+#define SJPG_PX_SIZE                    3
+#endif
+
+#if LV_SJPG_THREAD_CNT
+#if LV_USE_OS == LV_OS_NONE
+#error "LV_SJPG_THREAD_CNT > 0 requires LV_USE_OS"
+#endif
+
+/*The requested slice, the prefetched ones and the previous one*/
+#define SJPG_SLOT_CNT                   (LV_SJPG_PREFETCH_CNT + 2)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -100,8 +124,50 @@ typedef struct {
     uint8_t * workb;                    //JPG work buffer for jpeg library
     JDEC * tjpeg_jd;
     io_source_t io;
+#if LV_SJPG_THREAD_CNT
+    struct _sjpg_parallel_t * par;      //Slices decoded by the worker threads. NULL if not used.
+#endif
 } SJPEG;
 
+#if LV_SJPG_THREAD_CNT
+typedef enum {
+    SLOT_STATE_EMPTY,
+    SLOT_STATE_LOADING,     /*The compressed slice is being read*/
+    SLOT_STATE_PENDING,     /*Waiting for a thread to decode it*/
+    SLOT_STATE_DECODING,
+    SLOT_STATE_READY,
+    SLOT_STATE_ERROR,
+} slot_state_t;
+
+typedef struct {
+    slot_state_t state;
+    int frame_index;
+    uint32_t last_use;
+    const uint8_t * src;    /*The compressed slice*/
+    uint32_t src_size;
+    uint8_t * src_buf;      /*Buffer for `src` if the image is read from a file*/
+    uint8_t * pixels;       /*Decoded pixels of the slice in `pixel_buf`*/
+} sjpg_slot_t;
+
+typedef struct _sjpg_parallel_t {
+    struct _sjpg_parallel_t * next;     /*Next image in the list scanned by the worker threads*/
+    sjpg_slot_t slots[SJPG_SLOT_CNT];
+    uint8_t * pixel_buf;                /*Shared output buffer of the slots*/
+    uint32_t file_size;
+    int x_res;
+    int last_frame_index;
+    uint32_t use_cnt;
+    lv_thread_sync_t done_sync;         /*Signaled when a worker thread finished a slice*/
+} sjpg_parallel_t;
+
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    JDEC jd;
+    uint8_t workb[TJPGD_WORKBUFF_SIZE];
+} sjpg_worker_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -111,13 +177,30 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
                                   lv_coord_t len, uint8_t * buf);
 static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
 static size_t input_func(JDEC * jd, uint8_t * buff, size_t ndata);
+static void frame_cache_read(SJPEG * sjpeg, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
 static int is_jpg(const uint8_t * raw_data, size_t len);
 static void lv_sjpg_cleanup(SJPEG * sjpeg);
 static void lv_sjpg_free(SJPEG * sjpeg);
+#if LV_SJPG_THREAD_CNT
+static void parallel_create(SJPEG * sjpeg);
+static void parallel_delete(SJPEG * sjpeg);
+static lv_res_t parallel_load_frame(SJPEG * sjpeg, int frame_index);
+static sjpg_slot_t * slot_get(sjpg_parallel_t * par, int frame_index, int req_frame_index, int dir);
+static lv_res_t slot_load(SJPEG * sjpeg, sjpg_slot_t * slot);
+static bool slot_decode(JDEC * jd, uint8_t * workb, sjpg_slot_t * slot, int x_res);
+static void worker_thread_cb(void * user_data);
+static void workers_wake(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_SJPG_THREAD_CNT
+static sjpg_worker_t workers[LV_SJPG_THREAD_CNT];
+static lv_mutex_t workers_mutex;        /*Protects the list of images and the state of their slots*/
+static sjpg_parallel_t * par_head;
+static bool workers_inited;
+#endif
 
 /**********************
  *      MACROS
@@ -133,6 +216,19 @@ void lv_split_jpeg_init(void)
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_close_cb(dec, decoder_close);
     lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+
+#if LV_SJPG_THREAD_CNT
+    /*The threads can't be deleted so create them only once*/
+    if(workers_inited) return;
+    workers_inited = true;
+
+    lv_mutex_init(&workers_mutex);
+    uint32_t i;
+    for(i = 0; i < LV_SJPG_THREAD_CNT; i++) {
+        lv_thread_sync_init(&workers[i].sync);
+        lv_thread_init(&workers[i].thread, LV_THREAD_PRIO_MID, worker_thread_cb, 8 * 1024, &workers[i]);
+    }
+#endif
 }
 
 /**********************
@@ -165,7 +261,7 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
 
             raw_sjpeg_data += 14; //seek to res info ... refer sjpeg format
             header->always_zero = 0;
-            header->cf = LV_COLOR_FORMAT_RAW;
+            header->cf = SJPG_COLOR_FORMAT;
 
             header->w = *raw_sjpeg_data++;
             header->w |= *raw_sjpeg_data++ << 8;
@@ -178,7 +274,7 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
         }
         else if(is_jpg(raw_sjpeg_data, raw_sjpeg_data_size) == true) {
             header->always_zero = 0;
-            header->cf = LV_COLOR_FORMAT_RAW;
+            header->cf = SJPG_COLOR_FORMAT;
 
             uint8_t * workb_temp = lv_malloc(TJPGD_WORKBUFF_SIZE);
             if(!workb_temp) return LV_RES_INV;
@@ -235,7 +331,7 @@ end:
                     return LV_RES_INV;
                 }
                 header->always_zero = 0;
-                header->cf = LV_COLOR_FORMAT_RAW;
+                header->cf = SJPG_COLOR_FORMAT;
                 uint8_t * raw_sjpeg_data = buff;
                 header->w = *raw_sjpeg_data++;
                 header->w |= *raw_sjpeg_data++ << 8;
@@ -270,7 +366,7 @@ end:
 
             if(rc == JDR_OK) {
                 header->always_zero = 0;
-                header->cf = LV_COLOR_FORMAT_RAW;
+                header->cf = SJPG_COLOR_FORMAT;
                 header->w = jd_tmp.width;
                 header->h = jd_tmp.height;
                 return LV_RES_OK;
@@ -286,14 +382,25 @@ static int img_data_cb(JDEC * jd, void * data, JRECT * rect)
     uint8_t * cache = io->img_cache_buff;
     const int xres = io->img_cache_x_res;
     uint8_t * buf = data;
-    const int INPUT_PIXEL_SIZE = 3;
     const int row_width = rect->right - rect->left + 1; // Row width in pixels.
-    const int row_size = row_width * INPUT_PIXEL_SIZE;  // Row size (bytes).
 
     for(int y = rect->top; y <= rect->bottom; y++) {
-        int row_offset = y * xres * INPUT_PIXEL_SIZE + rect->left * INPUT_PIXEL_SIZE;
-        memcpy(cache + row_offset, buf, row_size);
+        int row_offset = y * xres * SJPG_PX_SIZE + rect->left * SJPG_PX_SIZE;
+#if SJPG_PX_SIZE == 2
+        const int row_size = row_width * SJPG_PX_SIZE;  // Row size (bytes).
+        lv_memcpy(cache + row_offset, buf, row_size);
         buf += row_size;
+#else
+        /*tjpgd's RGB888 is R, G, B in memory but LVGL stores it as B, G, R*/
+        uint8_t * dest = cache + row_offset;
+        for(int x = 0; x < row_width; x++) {
+            dest[0] = buf[2];
+            dest[1] = buf[1];
+            dest[2] = buf[0];
+            dest += 3;
+            buf += 3;
+        }
+#endif
     }
 
     return 1;
@@ -396,7 +503,7 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 sjpeg->frame_base_array[i] = sjpeg->frame_base_array[i - 1] + offset;
             }
             sjpeg->sjpeg_cache_frame_index = -1;
-            sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/);
+            sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * SJPG_PX_SIZE);
             if(! sjpeg->frame_cache) {
                 lv_sjpg_cleanup(sjpeg);
                 sjpeg = NULL;
@@ -419,6 +526,9 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
             }
             sjpeg->io.type = SJPEG_IO_SOURCE_C_ARRAY;
             sjpeg->io.lv_file.file_d = NULL;
+#if LV_SJPG_THREAD_CNT
+            parallel_create(sjpeg);
+#endif
             dsc->img_data = NULL;
             return lv_ret;
         }
@@ -459,7 +569,7 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 sjpeg->frame_base_array[0] = img_frame_base;
 
                 sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * SJPG_PX_SIZE);
                 if(! sjpeg->frame_cache) {
                     lv_sjpg_cleanup(sjpeg);
                     sjpeg = NULL;
@@ -578,7 +688,7 @@ end:
                 }
 
                 sjpeg->sjpeg_cache_frame_index = -1; //INVALID AT BEGINNING for a forced compare mismatch at first time.
-                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * SJPG_PX_SIZE);
                 if(! sjpeg->frame_cache) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
@@ -602,6 +712,9 @@ end:
 
                 sjpeg->io.type = SJPEG_IO_SOURCE_DISK;
                 sjpeg->io.lv_file = lv_file;
+#if LV_SJPG_THREAD_CNT
+                parallel_create(sjpeg);
+#endif
                 dsc->img_data = NULL;
                 return LV_RES_OK;
             }
@@ -666,7 +779,7 @@ end:
                 sjpeg->frame_base_offset[0] = img_frame_start_offset;
 
                 sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+                sjpeg->frame_cache = (void *)lv_malloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * SJPG_PX_SIZE);
                 if(! sjpeg->frame_cache) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
@@ -728,6 +841,13 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
 
         int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
 
+#if LV_SJPG_THREAD_CNT
+        /*Get the slice from the worker threads. It also updates the cache.*/
+        if(sjpeg->par && sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
+            if(parallel_load_frame(sjpeg, sjpeg_req_frame_index) != LV_RES_OK) return LV_RES_INV;
+        }
+#endif
+
         /*If line not from cache, refresh cache */
         if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
             sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[ sjpeg_req_frame_index ];
@@ -748,48 +868,7 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
             sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
         }
 
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if  LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-#elif  LV_COLOR_DEPTH == 24
-        for(int i = 0; i < len; i++) {
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 3;
-        }
-#elif  LV_COLOR_DEPTH == 16
-        for(int i = 0; i < len; i++) {
-            uint16_t col_16bit = (*cache++ & 0xf8) << 8;
-            col_16bit |= (*cache++ & 0xFC) << 3;
-            col_16bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1
-            buf[offset++] = col_16bit >> 8;
-            buf[offset++] = col_16bit & 0xff;
-#else
-            buf[offset++] = col_16bit & 0xff;
-            buf[offset++] = col_16bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-#elif  LV_COLOR_DEPTH == 8
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-#else
-#error Unsupported LV_COLOR_DEPTH
-#endif // LV_COLOR_DEPTH
+        frame_cache_read(sjpeg, x, y, len, buf);
         return LV_RES_OK;
     }
     else if(dsc->src_type == LV_IMG_SRC_FILE) {
@@ -800,6 +879,13 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
         lv_fs_file_t * lv_file_p = &(sjpeg->io.lv_file);
         if(!lv_file_p) goto end;
 
+#if LV_SJPG_THREAD_CNT
+        /*Get the slice from the worker threads. It also updates the cache.*/
+        if(sjpeg->par && sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
+            if(parallel_load_frame(sjpeg, sjpeg_req_frame_index) != LV_RES_OK) return LV_RES_INV;
+        }
+#endif
+
         /*If line not from cache, refresh cache */
         if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
             sjpeg->io.raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset [ sjpeg_req_frame_index ]);
@@ -814,54 +900,7 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
             sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
         }
 
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-#elif LV_COLOR_DEPTH == 24
-        for(int i = 0; i < len; i++) {
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 3;
-        }
-#elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_8bit = (*cache++ & 0xf8) << 8;
-            col_8bit |= (*cache++ & 0xFC) << 3;
-            col_8bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1
-            buf[offset++] = col_8bit >> 8;
-            buf[offset++] = col_8bit & 0xff;
-#else
-            buf[offset++] = col_8bit & 0xff;
-            buf[offset++] = col_8bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-
-#elif  LV_COLOR_DEPTH == 8
-
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-
-#else
-#error Unsupported LV_COLOR_DEPTH
-
-
-#endif // LV_COLOR_DEPTH
+        frame_cache_read(sjpeg, x, y, len, buf);
 
         return LV_RES_OK;
     }
@@ -898,6 +937,32 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
     }
 }
 
+/**
+ * Copy a line from the decoded slice
+ * @param sjpeg     pointer to an SJPG image whose `frame_cache` contains line `y`
+ * @param x         start x coordinate
+ * @param y         y coordinate
+ * @param len       number of pixels to copy
+ * @param buf       store the pixels here
+ */
+static void frame_cache_read(SJPEG * sjpeg, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    const uint8_t * cache = sjpeg->frame_cache;
+    cache += (x + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res) * SJPG_PX_SIZE;
+
+#if LV_COLOR_DEPTH == 8
+    for(int i = 0; i < len; i++) {
+        uint8_t col_8bit = (cache[2] & 0xC0);
+        col_8bit |= (cache[1] & 0xe0) >> 2;
+        col_8bit |= (cache[0] & 0xe0) >> 5;
+        buf[i] = col_8bit;
+        cache += 3;
+    }
+#else
+    lv_memcpy(buf, cache, len * SJPG_PX_SIZE);
+#endif
+}
+
 static int is_jpg(const uint8_t * raw_data, size_t len)
 {
     const uint8_t jpg_signature[] = {0xFF, 0xD8, 0xFF,  0xE0,  0x00,  0x10, 0x4A,  0x46, 0x49, 0x46};
@@ -907,6 +972,9 @@ static int is_jpg(const uint8_t * raw_data, size_t len)
 
 static void lv_sjpg_free(SJPEG * sjpeg)
 {
+#if LV_SJPG_THREAD_CNT
+    parallel_delete(sjpeg);
+#endif
     if(sjpeg->frame_cache) lv_free(sjpeg->frame_cache);
     if(sjpeg->frame_base_array) lv_free(sjpeg->frame_base_array);
     if(sjpeg->frame_base_offset) lv_free(sjpeg->frame_base_offset);
@@ -922,4 +990,363 @@ static void lv_sjpg_cleanup(SJPEG * sjpeg)
     lv_free(sjpeg);
 }
 
+#if LV_SJPG_THREAD_CNT
+
+/**
+ * Get the size of a compressed slice
+ * @param sjpeg         pointer to an opened SJPG image
+ * @param par           pointer to the parallel decoding data of the image
+ * @param frame_index   index of the slice
+ * @return              size of the slice in bytes
+ */
+static uint32_t frame_get_src_size(SJPEG * sjpeg, sjpg_parallel_t * par, int frame_index)
+{
+    bool last = frame_index == sjpeg->sjpeg_total_frames - 1;
+    if(sjpeg->io.type == SJPEG_IO_SOURCE_DISK) {
+        uint32_t end = last ? par->file_size : (uint32_t)sjpeg->frame_base_offset[frame_index + 1];
+        return end - (uint32_t)sjpeg->frame_base_offset[frame_index];
+    }
+    else {
+        uint8_t * end = last ? sjpeg->sjpeg_data + sjpeg->sjpeg_data_size : sjpeg->frame_base_array[frame_index + 1];
+        return (uint32_t)(end - sjpeg->frame_base_array[frame_index]);
+    }
+}
+
+/**
+ * Prepare an SJPG image to decode its slices on the worker threads.
+ * If it fails the slices are decoded one by one in `read_line`.
+ * @param sjpeg     pointer to an opened SJPG image
+ */
+static void parallel_create(SJPEG * sjpeg)
+{
+    if(sjpeg->sjpeg_total_frames < 2) return;
+
+    sjpg_parallel_t * par = lv_malloc(sizeof(sjpg_parallel_t));
+    if(par == NULL) return;
+    lv_memzero(par, sizeof(sjpg_parallel_t));
+    par->x_res = sjpeg->sjpeg_x_res;
+    par->last_frame_index = -1;
+
+    uint32_t frame_px_size = sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * SJPG_PX_SIZE;
+    par->pixel_buf = lv_malloc(frame_px_size * SJPG_SLOT_CNT);
+    if(par->pixel_buf == NULL) {
+        lv_free(par);
+        return;
+    }
+
+    /*The slices of files are read into the slots on the calling thread
+     *so that the worker threads don't need to use the file system*/
+    if(sjpeg->io.type == SJPEG_IO_SOURCE_DISK) {
+        lv_fs_seek(&sjpeg->io.lv_file, 0, LV_FS_SEEK_END);
+        lv_fs_tell(&sjpeg->io.lv_file, &par->file_size);
+
+        uint32_t max_size = 0;
+        int i;
+        for(i = 0; i < sjpeg->sjpeg_total_frames; i++) {
+            max_size = LV_MAX(max_size, frame_get_src_size(sjpeg, par, i));
+        }
+
+        for(i = 0; i < SJPG_SLOT_CNT; i++) {
+            par->slots[i].src_buf = lv_malloc(max_size);
+            if(par->slots[i].src_buf == NULL) {
+                for(i = 0; i < SJPG_SLOT_CNT; i++) lv_free(par->slots[i].src_buf);
+                lv_free(par->pixel_buf);
+                lv_free(par);
+                return;
+            }
+        }
+    }
+
+    int i;
+    for(i = 0; i < SJPG_SLOT_CNT; i++) {
+        par->slots[i].frame_index = -1;
+        par->slots[i].pixels = par->pixel_buf + i * frame_px_size;
+    }
+
+    lv_thread_sync_init(&par->done_sync);
+
+    lv_mutex_lock(&workers_mutex);
+    par->next = par_head;
+    par_head = par;
+    lv_mutex_unlock(&workers_mutex);
+
+    /*The decoded slices are stored in the slots instead*/
+    lv_free(sjpeg->frame_cache);
+    sjpeg->frame_cache = NULL;
+    sjpeg->par = par;
+}
+
+/**
+ * Stop decoding the slices of an image on the worker threads and free the related data.
+ * @param sjpeg     pointer to an SJPG image
+ */
+static void parallel_delete(SJPEG * sjpeg)
+{
+    sjpg_parallel_t * par = sjpeg->par;
+    if(par == NULL) return;
+
+    lv_mutex_lock(&workers_mutex);
+    sjpg_parallel_t ** prev_next = &par_head;
+    while(*prev_next != par) prev_next = &(*prev_next)->next;
+    *prev_next = par->next;
+
+    /*Wait until the worker threads finish the slices they have already started*/
+    while(1) {
+        bool decoding = false;
+        int i;
+        for(i = 0; i < SJPG_SLOT_CNT; i++) {
+            if(par->slots[i].state == SLOT_STATE_DECODING) decoding = true;
+        }
+        if(!decoding) break;
+
+        lv_mutex_unlock(&workers_mutex);
+        lv_thread_sync_wait(&par->done_sync);
+        lv_mutex_lock(&workers_mutex);
+    }
+    lv_mutex_unlock(&workers_mutex);
+
+    lv_thread_sync_delete(&par->done_sync);
+    int i;
+    for(i = 0; i < SJPG_SLOT_CNT; i++) lv_free(par->slots[i].src_buf);
+    lv_free(par->pixel_buf);
+    lv_free(par);
+
+    /*It pointed to one of the slots*/
+    sjpeg->frame_cache = NULL;
+    sjpeg->par = NULL;
+}
+
+/**
+ * Make a slice the `frame_cache` of the image. The next `LV_SJPG_PREFETCH_CNT` slices
+ * in the direction of reading are also queued to be decoded by the worker threads.
+ * @param sjpeg         pointer to an SJPG image with parallel decoding
+ * @param frame_index   index of the required slice
+ * @return              LV_RES_OK: the slice is decoded; LV_RES_INV: error
+ */
+static lv_res_t parallel_load_frame(SJPEG * sjpeg, int frame_index)
+{
+    sjpg_parallel_t * par = sjpeg->par;
+    sjpg_slot_t * prefetch_slots[LV_SJPG_PREFETCH_CNT];
+    uint32_t prefetch_cnt = 0;
+
+    lv_mutex_lock(&workers_mutex);
+    int dir = frame_index >= par->last_frame_index ? 1 : -1;
+    par->last_frame_index = frame_index;
+
+    /*If all slots are busy wait until a worker thread finishes one*/
+    sjpg_slot_t * slot = slot_get(par, frame_index, frame_index, dir);
+    while(slot == NULL) {
+        lv_mutex_unlock(&workers_mutex);
+        lv_thread_sync_wait(&par->done_sync);
+        lv_mutex_lock(&workers_mutex);
+        slot = slot_get(par, frame_index, frame_index, dir);
+    }
+    bool load = slot->state == SLOT_STATE_LOADING;
+
+    int i;
+    for(i = 1; i <= LV_SJPG_PREFETCH_CNT; i++) {
+        int prefetch_index = frame_index + i * dir;
+        if(prefetch_index < 0 || prefetch_index >= sjpeg->sjpeg_total_frames) break;
+
+        sjpg_slot_t * prefetch_slot = slot_get(par, prefetch_index, frame_index, dir);
+        if(prefetch_slot && prefetch_slot->state == SLOT_STATE_LOADING) {
+            prefetch_slots[prefetch_cnt] = prefetch_slot;
+            prefetch_cnt++;
+        }
+    }
+    lv_mutex_unlock(&workers_mutex);
+
+    /*Read the slices and let the worker threads decode them.
+     *The required slice comes first to let a worker thread start on it while the others are read*/
+    if(load) {
+        lv_res_t res = slot_load(sjpeg, slot);
+        lv_mutex_lock(&workers_mutex);
+        slot->state = res == LV_RES_OK ? SLOT_STATE_PENDING : SLOT_STATE_ERROR;
+        lv_mutex_unlock(&workers_mutex);
+        workers_wake();
+    }
+
+    uint32_t p;
+    for(p = 0; p < prefetch_cnt; p++) {
+        lv_res_t res = slot_load(sjpeg, prefetch_slots[p]);
+        lv_mutex_lock(&workers_mutex);
+        prefetch_slots[p]->state = res == LV_RES_OK ? SLOT_STATE_PENDING : SLOT_STATE_ERROR;
+        lv_mutex_unlock(&workers_mutex);
+    }
+    if(prefetch_cnt) workers_wake();
+
+    /*Decode the required slice here if no worker thread has started it yet*/
+    lv_mutex_lock(&workers_mutex);
+    while(slot->state != SLOT_STATE_READY && slot->state != SLOT_STATE_ERROR) {
+        if(slot->state == SLOT_STATE_PENDING) {
+            slot->state = SLOT_STATE_DECODING;
+            lv_mutex_unlock(&workers_mutex);
+            bool ok = slot_decode(sjpeg->tjpeg_jd, sjpeg->workb, slot, par->x_res);
+            lv_mutex_lock(&workers_mutex);
+            slot->state = ok ? SLOT_STATE_READY : SLOT_STATE_ERROR;
+        }
+        else {
+            lv_mutex_unlock(&workers_mutex);
+            lv_thread_sync_wait(&par->done_sync);
+            lv_mutex_lock(&workers_mutex);
+        }
+    }
+
+    lv_res_t res = LV_RES_INV;
+    if(slot->state == SLOT_STATE_READY) {
+        par->use_cnt++;
+        slot->last_use = par->use_cnt;
+        sjpeg->frame_cache = slot->pixels;
+        sjpeg->sjpeg_cache_frame_index = frame_index;
+        res = LV_RES_OK;
+    }
+    lv_mutex_unlock(&workers_mutex);
+
+    return res;
+}
+
+/**
+ * Get the slot of a slice or assign a slot to it. `workers_mutex` needs to be locked.
+ * The slices in the window of `req_frame_index` and the next `LV_SJPG_PREFETCH_CNT` slices are kept,
+ * else the least recently used slot is reused.
+ * @param par               pointer to the parallel decoding data of an image
+ * @param frame_index       index of the slice
+ * @param req_frame_index   index of the slice required by `read_line`
+ * @param dir               direction of reading: 1 or -1
+ * @return                  the slot of the slice; the slot is in `SLOT_STATE_LOADING` if it was just assigned.
+ *                          NULL if all slots are in use.
+ */
+static sjpg_slot_t * slot_get(sjpg_parallel_t * par, int frame_index, int req_frame_index, int dir)
+{
+    sjpg_slot_t * victim = NULL;
+    int i;
+    for(i = 0; i < SJPG_SLOT_CNT; i++) {
+        sjpg_slot_t * slot = &par->slots[i];
+        if(slot->state != SLOT_STATE_EMPTY && slot->frame_index == frame_index) return slot;
+    }
+
+    for(i = 0; i < SJPG_SLOT_CNT; i++) {
+        sjpg_slot_t * slot = &par->slots[i];
+        if(slot->state == SLOT_STATE_LOADING || slot->state == SLOT_STATE_DECODING) continue;
+        if(slot->state != SLOT_STATE_EMPTY) {
+            int dist = (slot->frame_index - req_frame_index) * dir;
+            if(dist >= 0 && dist <= LV_SJPG_PREFETCH_CNT) continue;
+        }
+
+        if(victim == NULL || slot->state == SLOT_STATE_EMPTY) victim = slot;
+        else if(victim->state != SLOT_STATE_EMPTY && slot->last_use < victim->last_use) victim = slot;
+    }
+
+    if(victim) {
+        victim->state = SLOT_STATE_LOADING;
+        victim->frame_index = frame_index;
+        victim->last_use = 0;
+    }
+
+    return victim;
+}
+
+/**
+ * Set the compressed data of a slot. Files are read into the slot's buffer.
+ * @param sjpeg     pointer to an SJPG image
+ * @param slot      pointer to a slot in `SLOT_STATE_LOADING` state
+ * @return          LV_RES_OK: no error; LV_RES_INV: the slice couldn't be read
+ */
+static lv_res_t slot_load(SJPEG * sjpeg, sjpg_slot_t * slot)
+{
+    slot->src_size = frame_get_src_size(sjpeg, sjpeg->par, slot->frame_index);
+
+    if(sjpeg->io.type == SJPEG_IO_SOURCE_C_ARRAY) {
+        slot->src = sjpeg->frame_base_array[slot->frame_index];
+        return LV_RES_OK;
+    }
+
+    uint32_t rn = 0;
+    lv_fs_res_t res = lv_fs_seek(&sjpeg->io.lv_file, sjpeg->frame_base_offset[slot->frame_index], LV_FS_SEEK_SET);
+    if(res == LV_FS_RES_OK) res = lv_fs_read(&sjpeg->io.lv_file, slot->src_buf, slot->src_size, &rn);
+    if(res != LV_FS_RES_OK || rn != slot->src_size) return LV_RES_INV;
+
+    slot->src = slot->src_buf;
+    return LV_RES_OK;
+}
+
+/**
+ * Decode the slice of a slot into its pixels
+ * @param jd        a JPG decoder object to use
+ * @param workb     work buffer for the decoder with `TJPGD_WORKBUFF_SIZE` size
+ * @param slot      pointer to a slot with loaded compressed data
+ * @param x_res     width of the image
+ * @return          true: success; false: decoding error
+ */
+static bool slot_decode(JDEC * jd, uint8_t * workb, sjpg_slot_t * slot, int x_res)
+{
+    io_source_t io;
+    lv_memzero(&io, sizeof(io));
+    io.type = SJPEG_IO_SOURCE_C_ARRAY;
+    io.raw_sjpg_data = (uint8_t *)slot->src;
+    io.raw_sjpg_data_size = slot->src_size;
+    io.img_cache_buff = slot->pixels;
+    io.img_cache_x_res = x_res;
+
+    JRESULT rc = jd_prepare(jd, input_func, workb, (size_t)TJPGD_WORKBUFF_SIZE, &io);
+    if(rc != JDR_OK) return false;
+    rc = jd_decomp(jd, img_data_cb, 0);
+    return rc == JDR_OK;
+}
+
+static void worker_thread_cb(void * user_data)
+{
+    sjpg_worker_t * worker = user_data;
+
+    while(1) {
+        lv_mutex_lock(&workers_mutex);
+
+        /*Find the queued slice closest to the last required one in any image*/
+        sjpg_parallel_t * par_act = NULL;
+        sjpg_slot_t * slot_act = NULL;
+        int dist_act = 0;
+        sjpg_parallel_t * par;
+        for(par = par_head; par; par = par->next) {
+            int i;
+            for(i = 0; i < SJPG_SLOT_CNT; i++) {
+                sjpg_slot_t * slot = &par->slots[i];
+                if(slot->state != SLOT_STATE_PENDING) continue;
+                int dist = LV_ABS(slot->frame_index - par->last_frame_index);
+                if(slot_act == NULL || dist < dist_act) {
+                    par_act = par;
+                    slot_act = slot;
+                    dist_act = dist;
+                }
+            }
+        }
+
+        if(slot_act == NULL) {
+            lv_mutex_unlock(&workers_mutex);
+            lv_thread_sync_wait(&worker->sync);
+            continue;
+        }
+
+        slot_act->state = SLOT_STATE_DECODING;
+        lv_mutex_unlock(&workers_mutex);
+
+        bool ok = slot_decode(&worker->jd, worker->workb, slot_act, par_act->x_res);
+
+        /*Signal with the mutex locked as the image can be deleted right after the state is changed*/
+        lv_mutex_lock(&workers_mutex);
+        slot_act->state = ok ? SLOT_STATE_READY : SLOT_STATE_ERROR;
+        lv_thread_sync_signal(&par_act->done_sync);
+        lv_mutex_unlock(&workers_mutex);
+    }
+}
+
+static void workers_wake(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_SJPG_THREAD_CNT; i++) {
+        lv_thread_sync_signal(&workers[i].sync);
+    }
+}
+
+#endif /*LV_SJPG_THREAD_CNT*/
+
 #endif /*LV_USE_SJPG*/
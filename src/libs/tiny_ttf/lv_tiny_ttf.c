@@ -6,7 +6,7 @@
     #define LV_TINY_TTF_DEFAULT_CACHE_SIZE 4096
 #endif
 #ifndef LV_TINY_TTF_CACHE_BUCKETS
-    #define LV_TINY_TTF_CACHE_BUCKETS 16
+    #define LV_TINY_TTF_CACHE_BUCKETS 64
 #endif
 
 #define STB_RECT_PACK_IMPLEMENTATION
@@ -18,202 +18,156 @@
 #define STBTT_HEAP_FACTOR_SIZE_DEFAULT 10
 #define STBTT_malloc(x,u)  ((void)(u),lv_malloc(x))
 #define STBTT_free(x,u)    ((void)(u),lv_free(x))
-#define TTF_CACHE_MALLOC(x)  (lv_malloc(x))
-#define TTF_CACHE_REALLOC(x,y)  (lv_realloc(x,y))
-#define TTF_CACHE_FREE(x)    (lv_free(x))
 #define TTF_MALLOC(x)  (lv_malloc(x))
 #define TTF_FREE(x)    (lv_free(x))
-typedef void * ttf_cache_handle_t;
-typedef struct ttf_cache_entry {
-    int key;
-    unsigned long long age;
-    int size;
-    void * data;
-} ttf_cache_entry_t;
-typedef struct ttf_cache_bucket {
-    int capacity;
-    ttf_cache_entry_t * entries;
-} ttf_cache_bucket_t;
-
-typedef struct ttf_cache {
-    int max_size;
-    int bucket_size;
-    int total_size;
-    unsigned long long age;
-    ttf_cache_bucket_t * buckets;
-} ttf_cache_t;
-
-static unsigned long long ttf_cache_get_oldest_age(ttf_cache_handle_t * handle)
+#if LV_USE_OS
+    #include "../../osal/lv_os.h"
+    #define TTF_LOCK()      lv_mutex_lock(&glyph_cache.lock)
+    #define TTF_UNLOCK()    lv_mutex_unlock(&glyph_cache.lock)
+#else
+    #define TTF_LOCK()
+    #define TTF_UNLOCK()
+#endif
+
+// A rendered glyph in the glyph cache. The A8 bitmap is stored right after the entry.
+typedef struct ttf_glyph_entry {
+    struct ttf_glyph_entry * hash_next;
+    struct ttf_glyph_entry * lru_prev;  // more recently used
+    struct ttf_glyph_entry * lru_next;  // less recently used
+    const void * font_dsc;
+    uint32_t letter;
+    lv_coord_t line_height;
+    size_t size;
+} ttf_glyph_entry_t;
+
+// LRU glyph cache shared by all tiny_ttf fonts. Its budget is the sum of the cache sizes of the fonts.
+typedef struct ttf_glyph_cache {
+    ttf_glyph_entry_t * buckets[LV_TINY_TTF_CACHE_BUCKETS];
+    ttf_glyph_entry_t * lru_head;
+    ttf_glyph_entry_t * lru_tail;
+    size_t max_size;
+    size_t total_size;
+    uint32_t font_cnt;
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} ttf_glyph_cache_t;
+
+static ttf_glyph_cache_t glyph_cache;
+
+static ttf_glyph_entry_t ** ttf_cache_bucket(const void * font_dsc, lv_coord_t line_height, uint32_t letter)
 {
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    unsigned long long result = (unsigned long long) - 1;
-    for(int i = 0; i < cache->bucket_size; ++i) {
-        ttf_cache_bucket_t * bucket = &cache->buckets[i];
-        if(bucket->entries != NULL) {
-            for(int j = 0; j < bucket->capacity; ++j) {
-                ttf_cache_entry_t * entry = &bucket->entries[j];
-                if(entry->age != 0 && entry->age < result) {
-                    result = entry->age;
-                }
-            }
-        }
-    }
-    if(result == (unsigned long long) - 1) {
-        return 0;
-    }
-    return result;
+    uint32_t h = (uint32_t)((lv_uintptr_t)font_dsc >> 4) ^ (letter * 2654435761U) ^ ((uint32_t)line_height * 40503U);
+    return &glyph_cache.buckets[h % LV_TINY_TTF_CACHE_BUCKETS];
 }
-static ttf_cache_handle_t ttf_cache_create(int max_size, int buckets)
+
+static void ttf_cache_lru_unlink(ttf_glyph_entry_t * entry)
 {
-    ttf_cache_t * result = (ttf_cache_t *)TTF_CACHE_MALLOC(sizeof(ttf_cache_t));
-    if(result == NULL) {
-        return NULL;
-    }
-    result->age = 1;
-    result->max_size = max_size;
-    result->total_size = 0;
-    result->bucket_size = buckets;
-    result->buckets = (ttf_cache_bucket_t *)TTF_CACHE_MALLOC(buckets * sizeof(ttf_cache_bucket_t));
-    if(result->buckets == NULL) {
-        TTF_CACHE_FREE(result);
-        return NULL;
-    }
-    for(int i = 0; i < buckets; ++i) {
-        result->buckets[i].capacity = 0;
-        result->buckets[i].entries = NULL;
-    }
-    return result;
+    if(entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else glyph_cache.lru_head = entry->lru_next;
+    if(entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else glyph_cache.lru_tail = entry->lru_prev;
 }
-static void * ttf_cache_get(ttf_cache_handle_t handle, int key)
+
+static void ttf_cache_lru_push(ttf_glyph_entry_t * entry)
 {
-    if(handle == NULL) {
-        return NULL;
-    }
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    int ci = key % cache->bucket_size;
-    ttf_cache_bucket_t * bucket = &cache->buckets[ci];
-    for(int i = 0; i < bucket->capacity; ++i) {
-        ttf_cache_entry_t * entry = &bucket->entries[i];
-        if(entry->age != 0 && entry->key == key) {
-            entry->age = ++cache->age;
-            return entry->data;
-        }
-    }
-    return NULL;
+    entry->lru_prev = NULL;
+    entry->lru_next = glyph_cache.lru_head;
+    if(glyph_cache.lru_head) glyph_cache.lru_head->lru_prev = entry;
+    else glyph_cache.lru_tail = entry;
+    glyph_cache.lru_head = entry;
+}
+
+static void ttf_cache_remove(ttf_glyph_entry_t * entry)
+{
+    ttf_glyph_entry_t ** p = ttf_cache_bucket(entry->font_dsc, entry->line_height, entry->letter);
+    while(*p != entry) p = &(*p)->hash_next;
+    *p = entry->hash_next;
+    ttf_cache_lru_unlink(entry);
+    glyph_cache.total_size -= entry->size;
+    TTF_FREE(entry);
 }
-static void * ttf_cache_add(ttf_cache_handle_t handle, int key, int size)
+
+// evict the least recently used glyphs until `size` more bytes fit into the budget
+static void ttf_cache_shrink(size_t size)
 {
-    if(handle == NULL) {
-        return NULL;
-    }
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    int ci = key % cache->bucket_size;
-    ttf_cache_bucket_t * bucket = &cache->buckets[ci];
-    for(int i = 0; i < bucket->capacity; ++i) {
-        ttf_cache_entry_t * entry = &bucket->entries[i];
-        if(entry->age != 0 && entry->key == key) {
-            TTF_CACHE_FREE(entry->data);
-            cache->total_size -= entry->size;
-            entry->age = 0;
-            break;
-        }
-    }
-    while(cache->total_size > 0 && (cache->max_size < cache->total_size + size)) {
-        // expire entries
-        unsigned long long oldest = ttf_cache_get_oldest_age(handle);
-        if(oldest == 0) {
-            break;
-        }
-        for(int i = 0; i < cache->bucket_size; ++i) {
-            ttf_cache_bucket_t * bucket2 = &cache->buckets[i];
-            for(int j = 0; j < bucket2->capacity; ++j) {
-                ttf_cache_entry_t * entry = &bucket2->entries[j];
-                if(entry->age == oldest) {
-                    if(entry->data != NULL) {
-                        TTF_CACHE_FREE(entry->data);
-                        entry->data = NULL;
-                        entry->age = 0;
-                        cache->total_size -= entry->size;
-                        entry->size = 0;
-                        i = cache->bucket_size;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-    if(bucket->entries == NULL) {
-        bucket->capacity = 4;
-        bucket->entries = (ttf_cache_entry_t *)TTF_CACHE_MALLOC(sizeof(ttf_cache_entry_t) * bucket->capacity);
-        if(bucket->entries == NULL) {
-            return NULL;
-        }
-        for(int i = 0; i < bucket->capacity; ++i) {
-            bucket->entries[i].age = 0;
-            bucket->entries[i].data = NULL;
-            bucket->entries[i].size = 0;
-        }
+    while(glyph_cache.lru_tail && glyph_cache.total_size + size > glyph_cache.max_size) {
+        ttf_cache_remove(glyph_cache.lru_tail);
     }
-    for(int i = 0; i < bucket->capacity; ++i) {
-        ttf_cache_entry_t * entry = &bucket->entries[i];
-        if(entry->age == 0) {
-            entry->data = TTF_CACHE_MALLOC(size);
-            if(entry->data == NULL) {
-                return NULL;
+}
+
+// copy a cached bitmap to `buf` and mark it as the most recently used
+static bool ttf_cache_get(const void * font_dsc, lv_coord_t line_height, uint32_t letter, uint8_t * buf)
+{
+    ttf_glyph_entry_t * entry = *ttf_cache_bucket(font_dsc, line_height, letter);
+    while(entry) {
+        if(entry->font_dsc == font_dsc && entry->letter == letter && entry->line_height == line_height) {
+            lv_memcpy(buf, entry + 1, entry->size);
+            if(glyph_cache.lru_head != entry) {
+                ttf_cache_lru_unlink(entry);
+                ttf_cache_lru_push(entry);
             }
-            entry->size = size;
-            entry->age = cache->age;
-            entry->key = key;
-            cache->total_size += size;
-            return entry->data;
+            return true;
         }
+        entry = entry->hash_next;
     }
-    int newcap = bucket->capacity * 2;
-    ttf_cache_entry_t * te = (ttf_cache_entry_t *)TTF_CACHE_REALLOC(bucket->entries, sizeof(ttf_cache_entry_t) * newcap);
-    if(te == NULL) {
-        return NULL;
-    }
-    bucket->entries = te;
-    for(int i = bucket->capacity; i < newcap; ++i) {
-        bucket->entries[i].age = 0;
-        bucket->entries[i].data = NULL;
-        bucket->entries[i].size = 0;
-    }
-    void * result = TTF_CACHE_MALLOC(size);
-    bucket->entries[bucket->capacity].data = result;
-    if(result == NULL) {
-        return NULL;
-    }
-    bucket->entries[bucket->capacity].size = size;
-    bucket->entries[bucket->capacity].age = cache->age;
-    bucket->entries[bucket->capacity].key = key;
-    bucket->capacity = newcap;
-    return result;
+    return false;
 }
 
-static void ttf_cache_clear(ttf_cache_handle_t handle)
+static void ttf_cache_add(const void * font_dsc, lv_coord_t line_height, uint32_t letter, const uint8_t * bitmap,
+                          size_t size)
 {
-    if(handle == NULL) {
-        return;
-    }
-    ttf_cache_t * cache = (ttf_cache_t *)handle;
-    for(int i = 0; i < cache->bucket_size; ++i) {
-        ttf_cache_bucket_t * bucket = &cache->buckets[i];
-        if(bucket->entries != NULL) {
-            for(int j = 0; j < bucket->capacity; ++j) {
-                ttf_cache_entry_t * entry = &bucket->entries[j];
-                if(entry->age != 0 && entry->data != NULL) {
-                    TTF_CACHE_FREE(entry->data);
-                }
-            }
-            TTF_CACHE_FREE(cache->buckets[i].entries);
-        }
+    if(size > glyph_cache.max_size) return;
+    ttf_cache_shrink(size);
+
+    ttf_glyph_entry_t * entry = (ttf_glyph_entry_t *)TTF_MALLOC(sizeof(ttf_glyph_entry_t) + size);
+    if(entry == NULL) return;
+    entry->font_dsc = font_dsc;
+    entry->letter = letter;
+    entry->line_height = line_height;
+    entry->size = size;
+    lv_memcpy(entry + 1, bitmap, size);
+
+    ttf_glyph_entry_t ** bucket = ttf_cache_bucket(font_dsc, line_height, letter);
+    entry->hash_next = *bucket;
+    *bucket = entry;
+    ttf_cache_lru_push(entry);
+    glyph_cache.total_size += size;
+}
+
+// drop every glyph of a font
+static void ttf_cache_drop(const void * font_dsc)
+{
+    ttf_glyph_entry_t * entry = glyph_cache.lru_head;
+    while(entry) {
+        ttf_glyph_entry_t * next = entry->lru_next;
+        if(entry->font_dsc == font_dsc) ttf_cache_remove(entry);
+        entry = next;
     }
 }
-static void ttf_cache_destroy(ttf_cache_handle_t handle)
+
+static void ttf_cache_register_font(size_t cache_size)
+{
+#if LV_USE_OS
+    if(glyph_cache.font_cnt == 0) lv_mutex_init(&glyph_cache.lock);
+#endif
+    TTF_LOCK();
+    glyph_cache.font_cnt++;
+    glyph_cache.max_size += cache_size;
+    TTF_UNLOCK();
+}
+
+static void ttf_cache_unregister_font(const void * font_dsc, size_t cache_size)
 {
-    ttf_cache_clear(handle);
-    TTF_CACHE_FREE((ttf_cache_t *)handle);
+    TTF_LOCK();
+    ttf_cache_drop(font_dsc);
+    glyph_cache.max_size -= cache_size;
+    ttf_cache_shrink(0);
+    glyph_cache.font_cnt--;
+    TTF_UNLOCK();
+#if LV_USE_OS
+    if(glyph_cache.font_cnt == 0) lv_mutex_delete(&glyph_cache.lock);
+#endif
 }
 #if LV_TINY_TTF_FILE_SUPPORT !=0
 // a hydra stream that can be in memory or from a file
@@ -261,6 +215,18 @@ static void ttf_cb_stream_seek(ttf_cb_stream_t * stream, size_t position)
 #include "stb_rect_pack.h"
 #include "stb_truetype_htcw.h"
 
+#if LV_TINY_TTF_ATLAS
+#define TTF_ATLAS_GLYPH_CNT (LV_TINY_TTF_ATLAS_LAST - LV_TINY_TTF_ATLAS_FIRST + 1)
+
+// position of a pre-rendered glyph in the atlas
+typedef struct ttf_atlas_glyph {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} ttf_atlas_glyph_t;
+#endif
+
 typedef struct ttf_font_desc {
     lv_fs_file_t file;
 #if LV_TINY_TTF_FILE_SUPPORT !=0
@@ -269,12 +235,79 @@ typedef struct ttf_font_desc {
     const uint8_t * stream;
 #endif
     stbtt_fontinfo info;
-    ttf_cache_handle_t cache;
+    size_t cache_size;
     float scale;
     int ascent;
     int descent;
+#if LV_TINY_TTF_ATLAS
+    uint8_t * atlas;    // A8 bitmap of the pre-rendered glyphs, NULL if it couldn't be created
+    uint32_t atlas_w;
+    ttf_atlas_glyph_t atlas_glyphs[TTF_ATLAS_GLYPH_CNT];
+#endif
 } ttf_font_desc_t;
 
+#if LV_TINY_TTF_ATLAS
+// render the glyphs of the atlas range next to each other in rows into a single bitmap
+static void ttf_atlas_build(ttf_font_desc_t * dsc)
+{
+    TTF_FREE(dsc->atlas);
+    dsc->atlas = NULL;
+
+    uint32_t area = 0;
+    uint32_t max_w = 0;
+    uint32_t i;
+    for(i = 0; i < TTF_ATLAS_GLYPH_CNT; i++) {
+        int g = stbtt_FindGlyphIndex(&dsc->info, (int)(LV_TINY_TTF_ATLAS_FIRST + i));
+        int x1, y1, x2, y2;
+        stbtt_GetGlyphBitmapBox(&dsc->info, g, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+        dsc->atlas_glyphs[i].w = (uint16_t)(x2 - x1 + 1);
+        dsc->atlas_glyphs[i].h = (uint16_t)(y2 - y1 + 1);
+        area += dsc->atlas_glyphs[i].w * dsc->atlas_glyphs[i].h;
+        max_w = LV_MAX(max_w, dsc->atlas_glyphs[i].w);
+    }
+
+    // a roughly square atlas
+    uint32_t atlas_w = max_w;
+    while(atlas_w * atlas_w < area) atlas_w += 16;
+
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t row_h = 0;
+    for(i = 0; i < TTF_ATLAS_GLYPH_CNT; i++) {
+        ttf_atlas_glyph_t * ag = &dsc->atlas_glyphs[i];
+        if(x + ag->w > atlas_w) {
+            x = 0;
+            y += row_h;
+            row_h = 0;
+        }
+        ag->x = (uint16_t)x;
+        ag->y = (uint16_t)y;
+        x += ag->w;
+        row_h = LV_MAX(row_h, ag->h);
+    }
+    uint32_t atlas_h = y + row_h;
+    if(atlas_w > UINT16_MAX || atlas_h > UINT16_MAX) {
+        LV_LOG_WARN("tiny_ttf: the font is too large for the atlas");
+        return;
+    }
+
+    uint8_t * atlas = TTF_MALLOC(atlas_w * atlas_h);
+    if(atlas == NULL) {
+        LV_LOG_WARN("tiny_ttf: couldn't allocate the atlas");
+        return;
+    }
+    lv_memzero(atlas, atlas_w * atlas_h);
+    for(i = 0; i < TTF_ATLAS_GLYPH_CNT; i++) {
+        ttf_atlas_glyph_t * ag = &dsc->atlas_glyphs[i];
+        int g = stbtt_FindGlyphIndex(&dsc->info, (int)(LV_TINY_TTF_ATLAS_FIRST + i));
+        stbtt_MakeGlyphBitmap(&dsc->info, atlas + ag->y * atlas_w + ag->x, ag->w, ag->h, (int)atlas_w,
+                              dsc->scale, dsc->scale, g);
+    }
+    dsc->atlas = atlas;
+    dsc->atlas_w = atlas_w;
+}
+#endif
+
 static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                  uint32_t unicode_letter_next)
 {
@@ -296,12 +329,12 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
 
     stbtt_GetGlyphBitmapBox(&dsc->info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
     int g2 = 0;
-    if(unicode_letter_next != 0) {
+    if(unicode_letter_next != 0 && font->kerning == LV_FONT_KERNING_NORMAL) {
         g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next);
     }
     int advw, lsb;
     stbtt_GetGlyphHMetrics(&dsc->info, g1, &advw, &lsb);
-    int k = stbtt_GetGlyphKernAdvance(&dsc->info, g1, g2);
+    int k = g2 ? stbtt_GetGlyphKernAdvance(&dsc->info, g1, g2) : 0;
     dsc_out->adv_w = (uint16_t)floor((((float)advw + (float)k) * dsc->scale) +
                                      0.5f); /*Horizontal space required by the glyph in [px]*/
 
@@ -318,26 +351,41 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
 
 static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter, uint8_t * bitmap_buf)
 {
-    LV_UNUSED(bitmap_buf);
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
     const stbtt_fontinfo * info = (const stbtt_fontinfo *)&dsc->info;
-    uint8_t * buffer = (uint8_t *)ttf_cache_get(dsc->cache, unicode_letter);
-    if(buffer == NULL) {
-        int g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
-        int x1, y1, x2, y2;
-        stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
-        int w, h;
-        w = x2 - x1 + 1;
-        h = y2 - y1 + 1;
-        int buffer_size = w * h;
-        buffer = ttf_cache_add(dsc->cache, unicode_letter, buffer_size);
-        if(buffer == NULL) {
-            return NULL;
+#if LV_TINY_TTF_ATLAS
+    if(dsc->atlas && unicode_letter >= LV_TINY_TTF_ATLAS_FIRST && unicode_letter <= LV_TINY_TTF_ATLAS_LAST) {
+        const ttf_atlas_glyph_t * ag = &dsc->atlas_glyphs[unicode_letter - LV_TINY_TTF_ATLAS_FIRST];
+        const uint8_t * src = dsc->atlas + ag->y * dsc->atlas_w + ag->x;
+        uint8_t * dest = bitmap_buf;
+        uint32_t y;
+        for(y = 0; y < ag->h; y++) {
+            lv_memcpy(dest, src, ag->w);
+            dest += ag->w;
+            src += dsc->atlas_w;
         }
-        memset(buffer, 0, buffer_size);
-        stbtt_MakeGlyphBitmap(info, buffer, w, h, w, dsc->scale, dsc->scale, g1);
+        return bitmap_buf;
+    }
+#endif
+
+    TTF_LOCK();
+    if(ttf_cache_get(dsc, font->line_height, unicode_letter, bitmap_buf)) {
+        TTF_UNLOCK();
+        return bitmap_buf;
     }
-    return buffer; /*Or NULL if not found*/
+
+    int g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
+    int x1, y1, x2, y2;
+    stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    int w, h;
+    w = x2 - x1 + 1;
+    h = y2 - y1 + 1;
+    size_t buffer_size = (size_t)w * h;
+    lv_memzero(bitmap_buf, buffer_size);
+    stbtt_MakeGlyphBitmap(info, bitmap_buf, w, h, w, dsc->scale, dsc->scale, g1);
+    ttf_cache_add(dsc, font->line_height, unicode_letter, bitmap_buf, buffer_size);
+    TTF_UNLOCK();
+    return bitmap_buf;
 }
 
 static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size,  lv_coord_t line_height,
@@ -356,16 +404,13 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
         return NULL;
     }
-    dsc->cache = ttf_cache_create(cache_size, LV_TINY_TTF_CACHE_BUCKETS);
-    if(dsc->cache == NULL) {
-        LV_LOG_ERROR("tiny_ttf: out of memory\n");
-        TTF_FREE(dsc);
-        return NULL;
-    }
+    dsc->cache_size = cache_size;
+#if LV_TINY_TTF_ATLAS
+    dsc->atlas = NULL;
+#endif
 #if LV_TINY_TTF_FILE_SUPPORT !=0
     if(path != NULL) {
         if(LV_FS_RES_OK != lv_fs_open(&dsc->file, path, LV_FS_MODE_RD)) {
-            ttf_cache_destroy(dsc->cache);
             TTF_FREE(dsc);
             LV_LOG_ERROR("tiny_ttf: unable to open %s\n", path);
             return NULL;
@@ -379,7 +424,6 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
         dsc->stream.position = 0;
     }
     if(0 == stbtt_InitFont(&dsc->info, &dsc->stream, stbtt_GetFontOffsetForIndex(&dsc->stream, 0))) {
-        ttf_cache_destroy(dsc->cache);
         TTF_FREE(dsc);
 
         LV_LOG_ERROR("tiny_ttf: init failed\n");
@@ -389,7 +433,6 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
 #else
     dsc->stream = (const uint8_t *)data;
     if(0 == stbtt_InitFont(&dsc->info, dsc->stream, stbtt_GetFontOffsetForIndex(dsc->stream, 0))) {
-        ttf_cache_destroy(dsc->cache);
         TTF_FREE(dsc);
         LV_LOG_ERROR("tiny_ttf: init failed\n");
         return NULL;
@@ -400,11 +443,11 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
     float scale = stbtt_ScaleForPixelHeight(&dsc->info, line_height);
     lv_font_t * out_font = (lv_font_t *)TTF_MALLOC(sizeof(lv_font_t));
     if(out_font == NULL) {
-        ttf_cache_destroy(dsc->cache);
         TTF_FREE(dsc);
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
         return NULL;
     }
+    lv_memzero(out_font, sizeof(lv_font_t));
     out_font->line_height = line_height;
     out_font->fallback = NULL;
     out_font->dsc = dsc;
@@ -417,6 +460,10 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
     out_font->subpx = 0;
     out_font->get_glyph_dsc = ttf_get_glyph_dsc_cb;
     out_font->get_glyph_bitmap = ttf_get_glyph_bitmap_cb;
+#if LV_TINY_TTF_ATLAS
+    ttf_atlas_build(dsc);
+#endif
+    ttf_cache_register_font(cache_size);
     return out_font;
 }
 #if LV_TINY_TTF_FILE_SUPPORT !=0
@@ -445,7 +492,10 @@ void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t line_height)
         dsc->scale = stbtt_ScaleForPixelHeight(&dsc->info, line_height);
         font->base_line = line_height - (lv_coord_t)(dsc->ascent * dsc->scale);
         font->underline_position = (uint8_t)line_height - dsc->descent;
-        ttf_cache_clear(dsc->cache);
+        // the glyphs of the previous size stay in the cache until they are evicted
+#if LV_TINY_TTF_ATLAS
+        ttf_atlas_build(dsc);
+#endif
     }
 }
 void lv_tiny_ttf_destroy(lv_font_t * font)
@@ -453,7 +503,10 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
     if(font != NULL) {
         if(font->dsc != NULL) {
             ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
-            ttf_cache_destroy(ttf->cache);
+            ttf_cache_unregister_font(ttf, ttf->cache_size);
+#if LV_TINY_TTF_ATLAS
+            TTF_FREE(ttf->atlas);
+#endif
 #if LV_TINY_TTF_FILE_SUPPORT !=0
             if(ttf->stream.file != NULL) {
                 lv_fs_close(&ttf->file);
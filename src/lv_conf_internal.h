@@ -690,6 +690,57 @@
     #endif
 #endif
 
+/*Memory budget in bytes for a block cache shared by the files read with `lv_fs_read()`.
+ *The blocks are kept after the file is closed, so reopened files are read from the RAM.
+ *It's used for drivers with `cache_size == 0` and the files opened only for reading.
+ *0: to disable the block cache*/
+#ifndef LV_FS_BLOCK_CACHE_SIZE
+    #ifdef CONFIG_LV_FS_BLOCK_CACHE_SIZE
+        #define LV_FS_BLOCK_CACHE_SIZE CONFIG_LV_FS_BLOCK_CACHE_SIZE
+    #else
+        #define LV_FS_BLOCK_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_FS_BLOCK_CACHE_SIZE
+    #ifndef LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #else
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 512    /*Size of a block in bytes*/
+        #endif
+    #endif
+    #ifndef LV_FS_BLOCK_CACHE_READAHEAD
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_READAHEAD
+            #define LV_FS_BLOCK_CACHE_READAHEAD CONFIG_LV_FS_BLOCK_CACHE_READAHEAD
+        #else
+            #define LV_FS_BLOCK_CACHE_READAHEAD 4       /*Read this many blocks at once if a file is read sequentially*/
+        #endif
+    #endif
+#endif
+
+/*1: Enable the asynchronous file system API (`lv_fs_async_...()`). Requires `LV_USE_OS`.
+ *A thread reads the files and the callbacks are called from `lv_timer_handler()`*/
+#ifndef LV_USE_FS_ASYNC
+    #ifdef CONFIG_LV_USE_FS_ASYNC
+        #define LV_USE_FS_ASYNC CONFIG_LV_USE_FS_ASYNC
+    #else
+        #define LV_USE_FS_ASYNC 0
+    #endif
+#endif
+
+/*Number of resolved style properties cached per object (a power of 2, e.g. 32).
+ *`lv_obj_get_style_...()` returns the cached value instead of checking all styles of the object and its parents.
+ *The cache is allocated when a style property of the object is read first and uses
+ *`(sizeof(lv_style_value_t) + 4) * LV_OBJ_STYLE_CACHE_SIZE + 8` bytes per object.
+ *0: to disable the cache*/
+#ifndef LV_OBJ_STYLE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_CACHE_SIZE 0
+    #endif
+#endif
+
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -1057,6 +1108,49 @@
     #endif
 #endif
 
+/*Size of the cache in bytes for the A8 bitmaps of the glyphs of the built-in and binary (`lv_font_load()`) fonts.
+ *The glyphs don't need to be unpacked or decompressed again when they are drawn the next time.
+ *0: to disable caching*/
+#ifndef LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Find the glyphs of the letters in a table instead of searching them in the cmaps of the font.
+ *The table is built per font in pages of 256 letters (512 bytes) when the letters of a page are used first.
+ *Speeds up rendering large fonts with many cmaps (e.g. CJK fonts). Requires `cache` to be set in the font's descriptor.*/
+#ifndef LV_USE_FONT_GLYPH_ID_LOOKUP
+    #ifdef CONFIG_LV_USE_FONT_GLYPH_ID_LOOKUP
+        #define LV_USE_FONT_GLYPH_ID_LOOKUP CONFIG_LV_USE_FONT_GLYPH_ID_LOOKUP
+    #else
+        #define LV_USE_FONT_GLYPH_ID_LOOKUP 0
+    #endif
+#endif
+
+/*Find the kerning values of the fonts with kerning pairs in a hash table instead of a binary search.
+ *The table is built per font when it's used first and needs about 10 bytes per kerning pair.
+ *(Class based kerning is always a table lookup.) Requires `cache` to be set in the font's descriptor.*/
+#ifndef LV_USE_FONT_KERN_LOOKUP
+    #ifdef CONFIG_LV_USE_FONT_KERN_LOOKUP
+        #define LV_USE_FONT_KERN_LOOKUP CONFIG_LV_USE_FONT_KERN_LOOKUP
+    #else
+        #define LV_USE_FONT_KERN_LOOKUP 0
+    #endif
+#endif
+
+/*Enable fonts whose glyphs are stored as signed distance fields (see `lv_font_sdf_init()`).
+ *One set of glyphs can be rendered at any size. Use `scripts/font_sdf_conv.py` to convert TTF fonts.*/
+#ifndef LV_USE_FONT_SDF
+    #ifdef CONFIG_LV_USE_FONT_SDF
+        #define LV_USE_FONT_SDF CONFIG_LV_USE_FONT_SDF
+    #else
+        #define LV_USE_FONT_SDF 0
+    #endif
+#endif
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef _LV_KCONFIG_PRESENT
@@ -1413,6 +1507,20 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_LAYOUT_CACHE
+        #ifdef CONFIG_LV_LABEL_LAYOUT_CACHE
+            #define LV_LABEL_LAYOUT_CACHE CONFIG_LV_LABEL_LAYOUT_CACHE
+        #else
+            #define LV_LABEL_LAYOUT_CACHE 0   /*Store the line breaks of labels to not break the lines again on every refresh and redraw*/
+        #endif
+    #endif
+    #ifndef LV_LABEL_BITMAP_CACHE
+        #ifdef CONFIG_LV_LABEL_BITMAP_CACHE
+            #define LV_LABEL_BITMAP_CACHE CONFIG_LV_LABEL_BITMAP_CACHE
+        #else
+            #define LV_LABEL_BITMAP_CACHE 0   /*Allow rendering the text of labels once to an A8 bitmap. Enable per label with `lv_label_set_bitmap_cache()`*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LED
@@ -1846,6 +1954,25 @@
     #endif
 #endif
 
+/*API for a read-only asset archive created by `scripts/fs_archive_pack.py`.
+ *Mount the archive with `lv_fs_archive_mount("S:path/to/assets.pak")`*/
+#ifndef LV_USE_FS_ARCHIVE
+    #ifdef CONFIG_LV_USE_FS_ARCHIVE
+        #define LV_USE_FS_ARCHIVE CONFIG_LV_USE_FS_ARCHIVE
+    #else
+        #define LV_USE_FS_ARCHIVE 0
+    #endif
+#endif
+#if LV_USE_FS_ARCHIVE
+    #ifndef LV_FS_ARCHIVE_LETTER
+        #ifdef CONFIG_LV_FS_ARCHIVE_LETTER
+            #define LV_FS_ARCHIVE_LETTER CONFIG_LV_FS_ARCHIVE_LETTER
+        #else
+            #define LV_FS_ARCHIVE_LETTER '\0'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
+        #endif
+    #endif
+#endif
+
 /*API for FATFS (needs to be added separately). Uses f_open, f_read, etc*/
 #ifndef LV_USE_FS_FATFS
     #ifdef CONFIG_LV_USE_FS_FATFS
@@ -1879,6 +2006,27 @@
         #define LV_USE_PNG 0
     #endif
 #endif
+#if LV_USE_PNG
+    /*1: Decode non-interlaced PNGs row by row in `read_line` instead of decoding the whole image when it's opened.
+     *   It needs about 40 kB + `LV_PNG_STREAM_ROW_CACHE_CNT` rows of RAM regardless of the image's height*/
+    #ifndef LV_PNG_USE_STREAM
+        #ifdef CONFIG_LV_PNG_USE_STREAM
+            #define LV_PNG_USE_STREAM CONFIG_LV_PNG_USE_STREAM
+        #else
+            #define LV_PNG_USE_STREAM 0
+        #endif
+    #endif
+    #if LV_PNG_USE_STREAM
+        /*Number of decoded rows to keep. Reading a row before the cached ones restarts decoding from the first row*/
+        #ifndef LV_PNG_STREAM_ROW_CACHE_CNT
+            #ifdef CONFIG_LV_PNG_STREAM_ROW_CACHE_CNT
+                #define LV_PNG_STREAM_ROW_CACHE_CNT CONFIG_LV_PNG_STREAM_ROW_CACHE_CNT
+            #else
+                #define LV_PNG_STREAM_ROW_CACHE_CNT 4
+            #endif
+        #endif
+    #endif
+#endif
 
 /*BMP decoder library*/
 #ifndef LV_USE_BMP
@@ -1898,6 +2046,27 @@
         #define LV_USE_SJPG 0
     #endif
 #endif
+#if LV_USE_SJPG
+    /*Number of worker threads decoding the slices of split JPGs in parallel. Requires `LV_USE_OS`.
+     *0: decode the slices one by one in `read_line`*/
+    #ifndef LV_SJPG_THREAD_CNT
+        #ifdef CONFIG_LV_SJPG_THREAD_CNT
+            #define LV_SJPG_THREAD_CNT CONFIG_LV_SJPG_THREAD_CNT
+        #else
+            #define LV_SJPG_THREAD_CNT 0
+        #endif
+    #endif
+    #if LV_SJPG_THREAD_CNT
+        /*Number of slices to decode ahead in the direction of reading (e.g. while scrolling)*/
+        #ifndef LV_SJPG_PREFETCH_CNT
+            #ifdef CONFIG_LV_SJPG_PREFETCH_CNT
+                #define LV_SJPG_PREFETCH_CNT CONFIG_LV_SJPG_PREFETCH_CNT
+            #else
+                #define LV_SJPG_PREFETCH_CNT 2
+            #endif
+        #endif
+    #endif
+#endif
 
 /*GIF decoder library*/
 #ifndef LV_USE_GIF
@@ -1907,6 +2076,18 @@
         #define LV_USE_GIF 0
     #endif
 #endif
+#if LV_USE_GIF
+    /*1: Decode the next frame on a separate thread into a second buffer while the current frame is shown.
+     *   Requires `LV_USE_OS` and a thread-safe file system driver to open GIF files.
+     *   Needs 2 more buffers with the size of the GIF's canvas*/
+    #ifndef LV_GIF_USE_THREAD
+        #ifdef CONFIG_LV_GIF_USE_THREAD
+            #define LV_GIF_USE_THREAD CONFIG_LV_GIF_USE_THREAD
+        #else
+            #define LV_GIF_USE_THREAD 0
+        #endif
+    #endif
+#endif
 
 /*QR code library*/
 #ifndef LV_USE_QRCODE
@@ -1980,6 +2161,16 @@
             #define LV_FREETYPE_CACHE_FT_SIZES 4
         #endif
     #endif
+
+    /* Size of a cache of rendered A8 glyphs in front of the FreeType cache [bytes].*/
+    /* The glyphs found in it can be used by several draw units in parallel without locking FreeType. (0: disable) */
+    #ifndef LV_FREETYPE_GLYPH_CACHE_SIZE
+        #ifdef CONFIG_LV_FREETYPE_GLYPH_CACHE_SIZE
+            #define LV_FREETYPE_GLYPH_CACHE_SIZE CONFIG_LV_FREETYPE_GLYPH_CACHE_SIZE
+        #else
+            #define LV_FREETYPE_GLYPH_CACHE_SIZE 0
+        #endif
+    #endif
 #endif
 
 /* Built-in TTF decoder */
@@ -1999,6 +2190,33 @@
             #define LV_TINY_TTF_FILE_SUPPORT 0
         #endif
     #endif
+
+    /* Render the glyphs of a range of letters into an A8 atlas when a font is created or resized
+     * to avoid rasterizing them one by one on their first use */
+    #ifndef LV_TINY_TTF_ATLAS
+        #ifdef CONFIG_LV_TINY_TTF_ATLAS
+            #define LV_TINY_TTF_ATLAS CONFIG_LV_TINY_TTF_ATLAS
+        #else
+            #define LV_TINY_TTF_ATLAS 0
+        #endif
+    #endif
+    #if LV_TINY_TTF_ATLAS
+        /* First and last letter of the range (printable ASCII by default) */
+        #ifndef LV_TINY_TTF_ATLAS_FIRST
+            #ifdef CONFIG_LV_TINY_TTF_ATLAS_FIRST
+                #define LV_TINY_TTF_ATLAS_FIRST CONFIG_LV_TINY_TTF_ATLAS_FIRST
+            #else
+                #define LV_TINY_TTF_ATLAS_FIRST 0x20
+            #endif
+        #endif
+        #ifndef LV_TINY_TTF_ATLAS_LAST
+            #ifdef CONFIG_LV_TINY_TTF_ATLAS_LAST
+                #define LV_TINY_TTF_ATLAS_LAST CONFIG_LV_TINY_TTF_ATLAS_LAST
+            #else
+                #define LV_TINY_TTF_ATLAS_LAST  0x7E
+            #endif
+        #endif
+    #endif
 #endif
 
 /*Rlottie library*/
@@ -2009,6 +2227,27 @@
         #define LV_USE_RLOTTIE 0
     #endif
 #endif
+#if LV_USE_RLOTTIE
+    /*1: Render the next frame on a separate thread while the current frame is shown.
+     *   Requires `LV_USE_OS`. Needs 1 more buffer with the size of the animation*/
+    #ifndef LV_RLOTTIE_USE_THREAD
+        #ifdef CONFIG_LV_RLOTTIE_USE_THREAD
+            #define LV_RLOTTIE_USE_THREAD CONFIG_LV_RLOTTIE_USE_THREAD
+        #else
+            #define LV_RLOTTIE_USE_THREAD 0
+        #endif
+    #endif
+
+    /*Size of the cache of rendered frames in bytes shared by all animations.
+     *Looping animations render each frame only once if all their frames fit. 0: disable caching*/
+    #ifndef LV_RLOTTIE_CACHE_SIZE
+        #ifdef CONFIG_LV_RLOTTIE_CACHE_SIZE
+            #define LV_RLOTTIE_CACHE_SIZE CONFIG_LV_RLOTTIE_CACHE_SIZE
+        #else
+            #define LV_RLOTTIE_CACHE_SIZE 0
+        #endif
+    #endif
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -2028,6 +2267,26 @@
             #define LV_FFMPEG_DUMP_FORMAT 0
         #endif
     #endif
+
+    /*1: Demux and decode the video on a separate thread and drop the late frames.
+     *   Requires `LV_USE_OS`*/
+    #ifndef LV_FFMPEG_USE_THREAD
+        #ifdef CONFIG_LV_FFMPEG_USE_THREAD
+            #define LV_FFMPEG_USE_THREAD CONFIG_LV_FFMPEG_USE_THREAD
+        #else
+            #define LV_FFMPEG_USE_THREAD 0
+        #endif
+    #endif
+    #if LV_FFMPEG_USE_THREAD
+        /*Number of decoded frames buffered ahead. Each needs a buffer with the size of the video*/
+        #ifndef LV_FFMPEG_FRAME_QUEUE_CNT
+            #ifdef CONFIG_LV_FFMPEG_FRAME_QUEUE_CNT
+                #define LV_FFMPEG_FRAME_QUEUE_CNT CONFIG_LV_FFMPEG_FRAME_QUEUE_CNT
+            #else
+                #define LV_FFMPEG_FRAME_QUEUE_CNT 2
+            #endif
+        #endif
+    #endif
 #endif
 
 /*==================
@@ -2187,7 +2446,7 @@
 #endif
 #if LV_USE_IME_PINYIN
     /*1: Use default thesaurus*/
-    /*If you do not use the default thesaurus, be sure to use `lv_ime_pinyin` after setting the thesauruss*/
+    /*If you do not use the default thesaurus, be sure to use `lv_ime_pinyin` after setting the thesaurus*/
     #ifndef LV_IME_PINYIN_USE_DEFAULT_DICT
         #ifdef _LV_KCONFIG_PRESENT
             #ifdef CONFIG_LV_IME_PINYIN_USE_DEFAULT_DICT
@@ -24,6 +24,7 @@
 #include "misc/lv_async.h"
 #include "misc/lv_fs.h"
 #include "misc/lv_gc.h"
+#include "font/lv_font_fmt_txt.h"
 #if LV_USE_DRAW_SW
     #include "draw/sw/lv_draw_sw.h"
 #endif
@@ -85,6 +86,8 @@ void lv_init(void)
 
     _lv_fs_init();
 
+    _lv_font_fmt_txt_init();
+
     _lv_anim_core_init();
 
     _lv_group_init();
@@ -176,6 +179,10 @@ void lv_init(void)
     lv_fs_win32_init();
 #endif
 
+#if LV_USE_FS_ARCHIVE != '\0'
+    lv_fs_archive_init();
+#endif
+
 #if LV_USE_PNG
     lv_png_init();
 #endif
@@ -216,6 +223,8 @@ void lv_deinit(void)
 
     lv_disp_set_default(NULL);
 
+    _lv_font_clean_up_fmt_txt();
+
     lv_mem_deinit();
     lv_initialized = false;
 
@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include "lv_bidi.h"
 #include "lv_txt.h"
+#include "lv_assert.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 
@@ -306,6 +307,29 @@ void _lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t le
     }
 }
 
+void _lv_bidi_process_layout(lv_txt_layout_t * layout, lv_base_dir_t base_dir)
+{
+    if(layout->text == NULL) return;
+    if(layout->bidi_text && layout->bidi_dir == base_dir) return;
+
+    /*Every line is terminated by '\0'*/
+    lv_free(layout->bidi_text);
+    layout->bidi_text = lv_malloc(layout->text_len + layout->line_cnt + 1);
+    LV_ASSERT_MALLOC(layout->bidi_text);
+    if(layout->bidi_text == NULL) return;
+
+    layout->bidi_text[0] = '\0';
+    uint32_t i;
+    for(i = 0; i < layout->line_cnt; i++) {
+        uint32_t line_start = layout->lines[i].start;
+        uint32_t line_end = i + 1 < layout->line_cnt ? layout->lines[i + 1].start : layout->text_len;
+        _lv_bidi_process_paragraph(&layout->text[line_start], &layout->bidi_text[line_start + i], line_end - line_start,
+                                   base_dir, NULL, 0);
+    }
+
+    layout->bidi_dir = base_dir;
+}
+
 void lv_bidi_calculate_align(lv_text_align_t * align, lv_base_dir_t * base_dir, const char * txt)
 {
     if(*base_dir == LV_BASE_DIR_AUTO) *base_dir = _lv_bidi_detect_base_dir(txt);
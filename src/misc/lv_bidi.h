@@ -97,6 +97,14 @@ uint16_t _lv_bidi_get_logical_pos(const char * str_in, char ** bidi_txt, uint32_
 uint16_t _lv_bidi_get_visual_pos(const char * str_in, char ** bidi_txt, uint16_t len, lv_base_dir_t base_dir,
                                  uint32_t logical_pos, bool * is_rtl);
 
+/**
+ * Store the lines of a text layout in visual order too to not process them again on every redraw.
+ * Nothing happens if it was already done with the same base direction.
+ * @param layout pointer to a valid text layout
+ * @param base_dir base direction of the text: `LV_BASE_DIR_LTR` or `LV_BASE_DIR_RTL`
+ */
+void _lv_bidi_process_layout(lv_txt_layout_t * layout, lv_base_dir_t base_dir);
+
 /**
  * Bidi process a paragraph of text
  * @param str_in the string to process
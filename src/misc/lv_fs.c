@@ -13,23 +13,100 @@
 #include "../stdlib/lv_string.h"
 #include "lv_ll.h"
 #include "lv_gc.h"
+#if LV_FS_BLOCK_CACHE_SIZE
+    #include "../osal/lv_os.h"
+#endif
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_FS_BLOCK_CACHE_SIZE
+#define BLOCK_SIZE      LV_FS_BLOCK_CACHE_BLOCK_SIZE
+#define BLOCK_CNT       (LV_FS_BLOCK_CACHE_SIZE / LV_FS_BLOCK_CACHE_BLOCK_SIZE)
+#define BLOCK_NONE      0xFFFF
+#define READAHEAD_CNT   LV_MIN(LV_FS_BLOCK_CACHE_READAHEAD, BLOCK_CNT)
+
+/*Larger reads are passed to the driver directly to not flush the cache*/
+#define BYPASS_SIZE     LV_MAX(LV_FS_BLOCK_CACHE_SIZE / 4, BLOCK_SIZE)
+
+#if BLOCK_CNT < 1 || BLOCK_CNT >= BLOCK_NONE
+    #error "LV_FS_BLOCK_CACHE_SIZE / LV_FS_BLOCK_CACHE_BLOCK_SIZE should be in the 1..65534 range"
+#endif
+
+#if LV_FS_BLOCK_CACHE_BLOCK_SIZE > 32768
+    #error "LV_FS_BLOCK_CACHE_BLOCK_SIZE should be max. 32768"
+#endif
+
+#if LV_FS_BLOCK_CACHE_READAHEAD < 1
+    #error "LV_FS_BLOCK_CACHE_READAHEAD should be at least 1"
+#endif
+
+#if LV_USE_OS
+    #define BLOCK_CACHE_LOCK()      lv_mutex_lock(&block_cache.lock)
+    #define BLOCK_CACHE_UNLOCK()    lv_mutex_unlock(&block_cache.lock)
+#else
+    #define BLOCK_CACHE_LOCK()
+    #define BLOCK_CACHE_UNLOCK()
+#endif
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_FS_BLOCK_CACHE_SIZE
+/*A file (driver + path) whose blocks can be cached*/
+typedef struct _lv_fs_block_cache_file_t {
+    struct _lv_fs_block_cache_file_t * next;
+    lv_fs_drv_t * drv;
+    uint32_t hash;
+    uint32_t ref_cnt;       /*Number of opened files and cached blocks referring to it*/
+    bool dropped;           /*Already removed from the list of files*/
+    char path[];
+} lv_fs_block_cache_file_t;
+
+typedef struct {
+    lv_fs_block_cache_file_t * file;    /*NULL if the block is unused*/
+    uint32_t block;                     /*Index of the block in the file*/
+    uint16_t size;                      /*Number of valid bytes. Less than BLOCK_SIZE at the end of the file*/
+    uint16_t hash_next;                 /*Next block in the same bucket or in the list of free blocks*/
+    uint16_t lru_prev;                  /*The more recently used block*/
+    uint16_t lru_next;                  /*The less recently used block*/
+} lv_fs_block_t;
+
+typedef struct {
+    lv_fs_block_t * blocks;
+    uint8_t * data;                     /*Data of the blocks, BLOCK_SIZE bytes for each*/
+    uint8_t * readahead_buf;            /*To read multiple blocks with one driver call*/
+    uint16_t * buckets;                 /*Hash table of the used blocks*/
+    uint16_t lru_head;                  /*The most recently used block*/
+    uint16_t lru_tail;                  /*The least recently used block*/
+    uint16_t free_head;
+    lv_fs_block_cache_file_t * files;
+    lv_fs_block_cache_stats_t stats;
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} lv_fs_block_cache_t;
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static const char * lv_fs_get_real_path(const char * path);
+#if LV_FS_BLOCK_CACHE_SIZE
+    static lv_fs_res_t lv_fs_read_block_cached(lv_fs_file_t * file_p, char * buf, uint32_t btr, uint32_t * br);
+    static lv_fs_res_t block_cache_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+    static lv_fs_block_cache_file_t * block_cache_file_get(lv_fs_drv_t * drv, const char * path, bool create);
+    static void block_cache_file_release(lv_fs_block_cache_file_t * file);
+    static void block_cache_file_drop(lv_fs_block_cache_file_t * file);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_FS_BLOCK_CACHE_SIZE
+    static lv_fs_block_cache_t block_cache;
+#endif
 
 /**********************
  *      MACROS
@@ -42,6 +119,10 @@ static const char * lv_fs_get_real_path(const char * path);
 void _lv_fs_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_fsdrv_ll), sizeof(lv_fs_drv_t *));
+
+#if LV_FS_BLOCK_CACHE_SIZE && LV_USE_OS
+    lv_mutex_init(&block_cache.lock);
+#endif
 }
 
 bool lv_fs_is_ready(char letter)
@@ -91,6 +172,24 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 
     file_p->drv = drv;
     file_p->file_d = file_d;
+    file_p->cache = NULL;
+
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_memzero(&file_p->block_cache, sizeof(lv_fs_file_block_cache_t));
+    if(drv->cache_size == 0 && !drv->no_block_cache && mode == LV_FS_MODE_RD) {
+        BLOCK_CACHE_LOCK();
+        file_p->block_cache.file = block_cache_file_get(drv, real_path, true);
+        BLOCK_CACHE_UNLOCK();
+        file_p->block_cache.last_block = UINT32_MAX;
+    }
+    else if(mode & LV_FS_MODE_WR) {
+        /*The file might be modified so forget its cached blocks*/
+        BLOCK_CACHE_LOCK();
+        lv_fs_block_cache_file_t * cached_file = block_cache_file_get(drv, real_path, false);
+        if(cached_file) block_cache_file_drop(cached_file);
+        BLOCK_CACHE_UNLOCK();
+    }
+#endif
 
     if(drv->cache_size) {
         file_p->cache = lv_malloc(sizeof(lv_fs_file_cache_t));
@@ -123,6 +222,15 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
         lv_free(file_p->cache);
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->block_cache.file) {
+        BLOCK_CACHE_LOCK();
+        block_cache_file_release(file_p->block_cache.file);
+        BLOCK_CACHE_UNLOCK();
+        file_p->block_cache.file = NULL;
+    }
+#endif
+
     file_p->file_d = NULL;
     file_p->drv    = NULL;
     file_p->cache  = NULL;
@@ -223,6 +331,11 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     if(file_p->drv->cache_size) {
         res = lv_fs_read_cached(file_p, (char *)buf, btr, &br_tmp);
     }
+#if LV_FS_BLOCK_CACHE_SIZE
+    else if(file_p->block_cache.file) {
+        res = lv_fs_read_block_cached(file_p, (char *)buf, btr, &br_tmp);
+    }
+#endif
     else {
         res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, &br_tmp);
     }
@@ -299,6 +412,11 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
                 }
         }
     }
+#if LV_FS_BLOCK_CACHE_SIZE
+    else if(file_p->block_cache.file) {
+        res = block_cache_seek(file_p, pos, whence);
+    }
+#endif
     else {
         res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
     }
@@ -323,6 +441,12 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
         *pos = file_p->cache->file_position;
         res = LV_FS_RES_OK;
     }
+#if LV_FS_BLOCK_CACHE_SIZE
+    else if(file_p->block_cache.file) {
+        *pos = file_p->block_cache.pos;
+        res = LV_FS_RES_OK;
+    }
+#endif
     else {
         res = file_p->drv->tell_cb(file_p->drv, file_p->file_d, pos);
     }
@@ -330,6 +454,75 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, const void ** data, uint32_t * size)
+{
+    *data = NULL;
+    *size = 0;
+
+    if(file_p->drv == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->map_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    lv_fs_res_t res = file_p->drv->map_cb(file_p->drv, file_p->file_d, data, size);
+    if(res != LV_FS_RES_OK) {
+        *data = NULL;
+        *size = 0;
+    }
+
+    return res;
+}
+
+lv_fs_res_t lv_fs_unmap(lv_fs_file_t * file_p, const void * data, uint32_t size)
+{
+    if(file_p->drv == NULL || data == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->unmap_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    return file_p->drv->unmap_cb(file_p->drv, file_p->file_d, data, size);
+}
+
+#if LV_FS_BLOCK_CACHE_SIZE
+void lv_fs_block_cache_get_stats(lv_fs_block_cache_stats_t * stats)
+{
+    BLOCK_CACHE_LOCK();
+    lv_memcpy(stats, &block_cache.stats, sizeof(lv_fs_block_cache_stats_t));
+    BLOCK_CACHE_UNLOCK();
+}
+
+void lv_fs_block_cache_reset_stats(void)
+{
+    BLOCK_CACHE_LOCK();
+    uint32_t used_size = block_cache.stats.used_size;
+    lv_memzero(&block_cache.stats, sizeof(lv_fs_block_cache_stats_t));
+    block_cache.stats.used_size = used_size;
+    BLOCK_CACHE_UNLOCK();
+}
+
+void lv_fs_block_cache_drop(const char * path)
+{
+    BLOCK_CACHE_LOCK();
+    if(path == NULL) {
+        while(block_cache.files) {
+            block_cache_file_drop(block_cache.files);
+        }
+    }
+    else {
+        lv_fs_drv_t * drv = lv_fs_get_drv(path[0]);
+        lv_fs_block_cache_file_t * file = drv ? block_cache_file_get(drv, lv_fs_get_real_path(path), false) : NULL;
+        if(file) block_cache_file_drop(file);
+    }
+    BLOCK_CACHE_UNLOCK();
+}
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
@@ -525,3 +718,359 @@ static const char * lv_fs_get_real_path(const char * path)
 
     return path;
 }
+
+#if LV_FS_BLOCK_CACHE_SIZE
+
+static uint32_t path_hash(const char * path)
+{
+    /*FNV-1a*/
+    uint32_t hash = 2166136261u;
+    while(*path) {
+        hash ^= (uint8_t) * path;
+        hash *= 16777619u;
+        path++;
+    }
+    return hash;
+}
+
+static uint16_t bucket_index(const lv_fs_block_cache_file_t * file, uint32_t block)
+{
+    return (uint16_t)((file->hash ^ (block * 2654435761u)) % BLOCK_CNT);
+}
+
+static bool block_cache_pool_init(void)
+{
+    if(block_cache.blocks) return true;
+
+    block_cache.blocks = lv_malloc(BLOCK_CNT * sizeof(lv_fs_block_t));
+    block_cache.buckets = lv_malloc(BLOCK_CNT * sizeof(uint16_t));
+    block_cache.data = lv_malloc(BLOCK_CNT * BLOCK_SIZE);
+    if(READAHEAD_CNT > 1) block_cache.readahead_buf = lv_malloc(READAHEAD_CNT * BLOCK_SIZE);
+
+    if(block_cache.blocks == NULL || block_cache.buckets == NULL || block_cache.data == NULL ||
+       (READAHEAD_CNT > 1 && block_cache.readahead_buf == NULL)) {
+        LV_LOG_WARN("Couldn't allocate the block cache");
+        lv_free(block_cache.blocks);
+        lv_free(block_cache.buckets);
+        lv_free(block_cache.data);
+        lv_free(block_cache.readahead_buf);
+        block_cache.blocks = NULL;
+        block_cache.buckets = NULL;
+        block_cache.data = NULL;
+        block_cache.readahead_buf = NULL;
+        return false;
+    }
+
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        lv_memzero(&block_cache.blocks[i], sizeof(lv_fs_block_t));
+        block_cache.blocks[i].hash_next = i + 1 < BLOCK_CNT ? i + 1 : BLOCK_NONE;
+        block_cache.buckets[i] = BLOCK_NONE;
+    }
+    block_cache.free_head = 0;
+    block_cache.lru_head = BLOCK_NONE;
+    block_cache.lru_tail = BLOCK_NONE;
+
+    return true;
+}
+
+/**
+ * Find a file in the block cache
+ * @param drv       the file's driver
+ * @param path      the file's path without the driver letter
+ * @param create    true: add the file if not found
+ * @return          the file with an incremented reference count if `create` is true, or NULL
+ */
+static lv_fs_block_cache_file_t * block_cache_file_get(lv_fs_drv_t * drv, const char * path, bool create)
+{
+    uint32_t hash = path_hash(path);
+    lv_fs_block_cache_file_t * file;
+    for(file = block_cache.files; file; file = file->next) {
+        if(file->drv == drv && file->hash == hash && strcmp(file->path, path) == 0) break;
+    }
+
+    if(file == NULL && create) {
+        size_t len = lv_strlen(path);
+        file = lv_malloc(sizeof(lv_fs_block_cache_file_t) + len + 1);
+        if(file == NULL) return NULL;
+
+        file->drv = drv;
+        file->hash = hash;
+        file->ref_cnt = 0;
+        file->dropped = false;
+        lv_memcpy(file->path, path, len + 1);
+        file->next = block_cache.files;
+        block_cache.files = file;
+    }
+
+    if(file && create) file->ref_cnt++;
+
+    return file;
+}
+
+static void block_cache_file_unlink(lv_fs_block_cache_file_t * file)
+{
+    lv_fs_block_cache_file_t ** prev = &block_cache.files;
+    while(*prev) {
+        if(*prev == file) {
+            *prev = file->next;
+            break;
+        }
+        prev = &(*prev)->next;
+    }
+    file->dropped = true;
+}
+
+static void block_cache_file_release(lv_fs_block_cache_file_t * file)
+{
+    file->ref_cnt--;
+    if(file->ref_cnt > 0) return;
+
+    if(!file->dropped) block_cache_file_unlink(file);
+    lv_free(file);
+}
+
+static void lru_unlink(uint16_t idx)
+{
+    lv_fs_block_t * b = &block_cache.blocks[idx];
+    if(b->lru_prev != BLOCK_NONE) block_cache.blocks[b->lru_prev].lru_next = b->lru_next;
+    else block_cache.lru_head = b->lru_next;
+
+    if(b->lru_next != BLOCK_NONE) block_cache.blocks[b->lru_next].lru_prev = b->lru_prev;
+    else block_cache.lru_tail = b->lru_prev;
+}
+
+static void lru_add_head(uint16_t idx)
+{
+    lv_fs_block_t * b = &block_cache.blocks[idx];
+    b->lru_prev = BLOCK_NONE;
+    b->lru_next = block_cache.lru_head;
+    if(block_cache.lru_head != BLOCK_NONE) block_cache.blocks[block_cache.lru_head].lru_prev = idx;
+    block_cache.lru_head = idx;
+    if(block_cache.lru_tail == BLOCK_NONE) block_cache.lru_tail = idx;
+}
+
+static uint16_t block_find(const lv_fs_block_cache_file_t * file, uint32_t block)
+{
+    uint16_t idx = block_cache.buckets[bucket_index(file, block)];
+    while(idx != BLOCK_NONE) {
+        lv_fs_block_t * b = &block_cache.blocks[idx];
+        if(b->file == file && b->block == block) return idx;
+        idx = b->hash_next;
+    }
+    return BLOCK_NONE;
+}
+
+static void block_remove(uint16_t idx)
+{
+    lv_fs_block_t * b = &block_cache.blocks[idx];
+
+    uint16_t * prev = &block_cache.buckets[bucket_index(b->file, b->block)];
+    while(*prev != idx) prev = &block_cache.blocks[*prev].hash_next;
+    *prev = b->hash_next;
+
+    lru_unlink(idx);
+    block_cache.stats.used_size -= b->size;
+    block_cache_file_release(b->file);
+
+    b->file = NULL;
+    b->hash_next = block_cache.free_head;
+    block_cache.free_head = idx;
+}
+
+/**
+ * Get an unused block (drop the least recently used one if there is no free block) and add it to the cache
+ */
+static uint16_t block_add(lv_fs_block_cache_file_t * file, uint32_t block, const uint8_t * data, uint16_t size)
+{
+    if(block_cache.free_head == BLOCK_NONE) {
+        block_remove(block_cache.lru_tail);
+        block_cache.stats.evict++;
+    }
+
+    uint16_t idx = block_cache.free_head;
+    lv_fs_block_t * b = &block_cache.blocks[idx];
+    block_cache.free_head = b->hash_next;
+
+    b->file = file;
+    b->block = block;
+    b->size = size;
+    file->ref_cnt++;
+
+    uint16_t * bucket = &block_cache.buckets[bucket_index(file, block)];
+    b->hash_next = *bucket;
+    *bucket = idx;
+    lru_add_head(idx);
+
+    if(data) lv_memcpy(&block_cache.data[idx * BLOCK_SIZE], data, size);
+    block_cache.stats.used_size += size;
+
+    return idx;
+}
+
+static void block_cache_file_drop(lv_fs_block_cache_file_t * file)
+{
+    /*Keep the file alive while removing its blocks*/
+    file->ref_cnt++;
+
+    if(block_cache.blocks) {
+        uint32_t i;
+        for(i = 0; i < BLOCK_CNT; i++) {
+            if(block_cache.blocks[i].file == file) block_remove(i);
+        }
+    }
+
+    if(!file->dropped) block_cache_file_unlink(file);
+    block_cache_file_release(file);
+}
+
+static lv_fs_res_t block_cache_drv_read(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_file_block_cache_t * bc = &file_p->block_cache;
+    lv_fs_res_t res;
+
+    *br = 0;
+    if(bc->drv_pos != pos) {
+        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) return res;
+        bc->drv_pos = pos;
+    }
+
+    res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, br);
+    if(res == LV_FS_RES_OK) bc->drv_pos += *br;
+
+    return res;
+}
+
+/**
+ * Read a block from the driver. If the file is read sequentially read the next blocks too.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param block     index of the block to read
+ * @param idx_p     store the index of the cached block here or `BLOCK_NONE` if it's beyond the end of the file
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t block_load(lv_fs_file_t * file_p, uint32_t block, uint16_t * idx_p)
+{
+    lv_fs_file_block_cache_t * bc = &file_p->block_cache;
+    lv_fs_block_cache_file_t * file = bc->file;
+    lv_fs_res_t res;
+    uint32_t br;
+
+    *idx_p = BLOCK_NONE;
+    block_cache.stats.miss++;
+
+    uint32_t cnt = 1;
+    if(READAHEAD_CNT > 1 && bc->last_block != UINT32_MAX && block == bc->last_block + 1) {
+        while(cnt < READAHEAD_CNT && block_find(file, block + cnt) == BLOCK_NONE) cnt++;
+    }
+
+    if(cnt == 1) {
+        uint16_t idx = block_add(file, block, NULL, 0);
+        res = block_cache_drv_read(file_p, block * BLOCK_SIZE, &block_cache.data[idx * BLOCK_SIZE], BLOCK_SIZE, &br);
+        if(res != LV_FS_RES_OK || br == 0) {
+            block_remove(idx);
+            return res;
+        }
+        block_cache.blocks[idx].size = br;
+        block_cache.stats.used_size += br;
+        *idx_p = idx;
+        return LV_FS_RES_OK;
+    }
+
+    res = block_cache_drv_read(file_p, block * BLOCK_SIZE, block_cache.readahead_buf, cnt * BLOCK_SIZE, &br);
+    if(res != LV_FS_RES_OK) return res;
+
+    /*Add the requested block last to be sure it's not dropped*/
+    uint32_t i;
+    for(i = cnt; i > 0; i--) {
+        uint32_t ofs = (i - 1) * BLOCK_SIZE;
+        if(br <= ofs) continue;
+
+        uint16_t size = LV_MIN(br - ofs, BLOCK_SIZE);
+        *idx_p = block_add(file, block + i - 1, &block_cache.readahead_buf[ofs], size);
+        if(i > 1) block_cache.stats.readahead++;
+    }
+
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t lv_fs_read_block_cached(lv_fs_file_t * file_p, char * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_file_block_cache_t * bc = &file_p->block_cache;
+    lv_fs_res_t res = LV_FS_RES_OK;
+
+    *br = 0;
+
+    BLOCK_CACHE_LOCK();
+    if(btr >= BYPASS_SIZE || !block_cache_pool_init()) {
+        /*Large reads would drop many blocks and gain nothing from the cache*/
+        block_cache.stats.bypass++;
+        res = block_cache_drv_read(file_p, bc->pos, buf, btr, br);
+        if(res == LV_FS_RES_OK) bc->pos += *br;
+        BLOCK_CACHE_UNLOCK();
+        return res;
+    }
+
+    while(btr > 0) {
+        uint32_t block = bc->pos / BLOCK_SIZE;
+        uint32_t ofs = bc->pos % BLOCK_SIZE;
+
+        uint16_t idx = block_find(bc->file, block);
+        if(idx != BLOCK_NONE) {
+            block_cache.stats.hit++;
+            if(block_cache.lru_head != idx) {
+                lru_unlink(idx);
+                lru_add_head(idx);
+            }
+        }
+        else {
+            res = block_load(file_p, block, &idx);
+            if(res != LV_FS_RES_OK || idx == BLOCK_NONE) break;
+        }
+        bc->last_block = block;
+
+        uint16_t size = block_cache.blocks[idx].size;
+        if(ofs >= size) break;  /*End of the file*/
+
+        uint32_t n = LV_MIN(btr, size - ofs);
+        lv_memcpy(buf, &block_cache.data[idx * BLOCK_SIZE + ofs], n);
+        buf += n;
+        btr -= n;
+        *br += n;
+        bc->pos += n;
+
+        if(size < BLOCK_SIZE) break;    /*It was the last block*/
+    }
+    BLOCK_CACHE_UNLOCK();
+
+    return res;
+}
+
+static lv_fs_res_t block_cache_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    lv_fs_file_block_cache_t * bc = &file_p->block_cache;
+    lv_fs_res_t res = LV_FS_RES_OK;
+
+    switch(whence) {
+        case LV_FS_SEEK_SET:
+            bc->pos = pos;
+            break;
+        case LV_FS_SEEK_CUR:
+            bc->pos += pos;
+            break;
+        case LV_FS_SEEK_END:
+            /*The size of the file is unknown so let the driver seek and get the position from it*/
+            res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+            if(res == LV_FS_RES_OK) {
+                res = file_p->drv->tell_cb(file_p->drv, file_p->file_d, &bc->drv_pos);
+                if(res == LV_FS_RES_OK) bc->pos = bc->drv_pos;
+                else bc->drv_pos = UINT32_MAX;  /*Unknown, seek the next time*/
+            }
+            break;
+        default:
+            res = LV_FS_RES_INV_PARAM;
+    }
+
+    return res;
+}
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
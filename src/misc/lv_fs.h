@@ -81,6 +81,7 @@ typedef enum {
 typedef struct _lv_fs_drv_t {
     char letter;
     uint16_t cache_size;
+    bool no_block_cache;    /**< Don't use the shared block cache, e.g. if the files are already in the memory*/
     bool (*ready_cb)(struct _lv_fs_drv_t * drv);
 
     void * (*open_cb)(struct _lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
@@ -90,6 +91,10 @@ typedef struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    /*Optional. Map the whole file into the memory read-only*/
+    lv_fs_res_t (*map_cb)(struct _lv_fs_drv_t * drv, void * file_p, const void ** data_p, uint32_t * size_p);
+    lv_fs_res_t (*unmap_cb)(struct _lv_fs_drv_t * drv, void * file_p, const void * data, uint32_t size);
+
     void * (*dir_open_cb)(struct _lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(struct _lv_fs_drv_t * drv, void * rddir_p, char * fn);
     lv_fs_res_t (*dir_close_cb)(struct _lv_fs_drv_t * drv, void * rddir_p);
@@ -104,10 +109,33 @@ typedef struct {
     void * buffer;
 } lv_fs_file_cache_t;
 
+#if LV_FS_BLOCK_CACHE_SIZE
+struct _lv_fs_block_cache_file_t;
+
+typedef struct {
+    struct _lv_fs_block_cache_file_t * file;    /**< The file in the shared block cache. NULL if not used*/
+    uint32_t pos;                               /**< Position of the next read*/
+    uint32_t drv_pos;                           /**< Position of the driver's read write pointer*/
+    uint32_t last_block;                        /**< The last read block to detect sequential reading*/
+} lv_fs_file_block_cache_t;
+
+typedef struct {
+    uint32_t hit;           /**< Number of blocks found in the cache*/
+    uint32_t miss;          /**< Number of blocks read from the driver*/
+    uint32_t readahead;     /**< Number of blocks read ahead because of sequential reading*/
+    uint32_t evict;         /**< Number of blocks dropped to make room for new ones*/
+    uint32_t bypass;        /**< Number of large reads passed to the driver directly*/
+    uint32_t used_size;     /**< Bytes used by cached blocks*/
+} lv_fs_block_cache_stats_t;
+#endif
+
 typedef struct {
     void * file_d;
     lv_fs_drv_t * drv;
     lv_fs_file_cache_t * cache;
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_fs_file_block_cache_t block_cache;
+#endif
 } lv_fs_file_t;
 
 typedef struct {
@@ -208,6 +236,45 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Map the whole content of a file into the memory to access it without copying.
+ * The data is read-only and valid until `lv_fs_unmap` is called, which should happen before closing the file.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param data      pointer to store the address of the file's content
+ * @param size      pointer to store the size of the file
+ * @return          LV_FS_RES_OK, LV_FS_RES_NOT_IMP if the driver can't map files or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, const void ** data, uint32_t * size);
+
+/**
+ * Release a mapping created by `lv_fs_map`
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param data      the address returned by `lv_fs_map`
+ * @param size      the size returned by `lv_fs_map`
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_unmap(lv_fs_file_t * file_p, const void * data, uint32_t size);
+
+#if LV_FS_BLOCK_CACHE_SIZE
+/**
+ * Get the statistics of the shared block cache
+ * @param stats     store the statistics here
+ */
+void lv_fs_block_cache_get_stats(lv_fs_block_cache_stats_t * stats);
+
+/**
+ * Reset the counters of the shared block cache's statistics
+ */
+void lv_fs_block_cache_reset_stats(void);
+
+/**
+ * Drop the cached blocks of a file, e.g. if it was modified without LVGL.
+ * Files opened for writing with `lv_fs_open` are dropped automatically.
+ * @param path      path to the file beginning with the driver letter or NULL to drop all files
+ */
+void lv_fs_block_cache_drop(const char * path);
+#endif
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
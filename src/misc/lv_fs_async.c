@@ -0,0 +1,368 @@
+/**
+ * @file lv_fs_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_fs_async.h"
+#if LV_USE_FS_ASYNC
+
+#include "lv_timer.h"
+#include "lv_log.h"
+#include "lv_assert.h"
+#include "../osal/lv_os.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+#if LV_USE_OS == LV_OS_NONE
+#error "LV_USE_FS_ASYNC requires LV_USE_OS"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define POLL_PERIOD     10      /*Period of checking the completed requests in ms*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_fs_async_req_t * req_create(lv_fs_async_type_t type, const char * path, lv_fs_async_cb_t cb,
+                                      void * user_data);
+static void req_submit(lv_fs_async_req_t * req);
+static void req_free(lv_fs_async_req_t * req);
+static bool list_remove(lv_fs_async_req_t ** head, lv_fs_async_req_t * req);
+static void list_append(lv_fs_async_req_t ** head, lv_fs_async_req_t * req);
+static void process(lv_fs_async_req_t * req);
+static void process_read_file(lv_fs_async_req_t * req);
+static void process_dir_read(lv_fs_async_req_t * req);
+static void worker_thread_cb(void * user_data);
+static void done_timer_cb(lv_timer_t * t);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static bool thread_inited;
+static lv_thread_t worker_thread;
+static lv_thread_sync_t work_sync;      /*Wakes up the worker thread*/
+static lv_thread_sync_t cancel_sync;    /*Signaled when the worker finished a canceled request*/
+static lv_mutex_t lock;                 /*Protects the lists below*/
+static lv_fs_async_req_t * pending_head;
+static lv_fs_async_req_t * running;
+static lv_fs_async_req_t * done_head;
+
+/*Used only in the LVGL thread*/
+static lv_timer_t * done_timer;
+static uint32_t active_cnt;             /*Submitted but not yet finished requests*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_fs_async_req_t * lv_fs_async_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mode,
+                                     lv_fs_async_cb_t cb, void * user_data)
+{
+    if(file_p == NULL) return NULL;
+
+    lv_fs_async_req_t * req = req_create(LV_FS_ASYNC_OPEN, path, cb, user_data);
+    if(req == NULL) return NULL;
+
+    req->file_p = file_p;
+    req->mode = mode;
+    req_submit(req);
+    return req;
+}
+
+lv_fs_async_req_t * lv_fs_async_read(lv_fs_file_t * file_p, void * buf, uint32_t btr,
+                                     lv_fs_async_cb_t cb, void * user_data)
+{
+    if(file_p == NULL || buf == NULL) return NULL;
+
+    lv_fs_async_req_t * req = req_create(LV_FS_ASYNC_READ, NULL, cb, user_data);
+    if(req == NULL) return NULL;
+
+    req->file_p = file_p;
+    req->buf = buf;
+    req->btr = btr;
+    req_submit(req);
+    return req;
+}
+
+lv_fs_async_req_t * lv_fs_async_read_file(const char * path, lv_fs_async_cb_t cb, void * user_data)
+{
+    lv_fs_async_req_t * req = req_create(LV_FS_ASYNC_READ_FILE, path, cb, user_data);
+    if(req == NULL) return NULL;
+
+    req_submit(req);
+    return req;
+}
+
+lv_fs_async_req_t * lv_fs_async_dir_read(const char * path, lv_fs_async_cb_t cb, void * user_data)
+{
+    lv_fs_async_req_t * req = req_create(LV_FS_ASYNC_DIR_READ, path, cb, user_data);
+    if(req == NULL) return NULL;
+
+    req_submit(req);
+    return req;
+}
+
+void lv_fs_async_cancel(lv_fs_async_req_t * req)
+{
+    if(req == NULL) return;
+
+    lv_mutex_lock(&lock);
+    bool found = list_remove(&pending_head, req);
+    if(!found && running == req) {
+        /*Wait until the worker is done with it to be sure the buffers are not used anymore*/
+        req->canceled = true;
+        lv_mutex_unlock(&lock);
+        lv_thread_sync_wait(&cancel_sync);
+        lv_mutex_lock(&lock);
+    }
+    if(!found) found = list_remove(&done_head, req);
+    lv_mutex_unlock(&lock);
+
+    if(!found) {
+        LV_LOG_WARN("request not found");
+        return;
+    }
+
+    if(req->type == LV_FS_ASYNC_OPEN && req->res == LV_FS_RES_OK) {
+        lv_fs_close(&req->file);
+    }
+    req_free(req);
+
+    active_cnt--;
+    if(active_cnt == 0) lv_timer_pause(done_timer);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_fs_async_req_t * req_create(lv_fs_async_type_t type, const char * path, lv_fs_async_cb_t cb,
+                                      void * user_data)
+{
+    lv_fs_async_req_t * req = lv_malloc(sizeof(lv_fs_async_req_t));
+    LV_ASSERT_MALLOC(req);
+    if(req == NULL) return NULL;
+
+    lv_memzero(req, sizeof(lv_fs_async_req_t));
+    req->type = type;
+    req->cb = cb;
+    req->user_data = user_data;
+    req->res = LV_FS_RES_UNKNOWN;
+
+    if(path) {
+        req->path = lv_malloc(lv_strlen(path) + 1);
+        LV_ASSERT_MALLOC(req->path);
+        if(req->path == NULL) {
+            lv_free(req);
+            return NULL;
+        }
+        lv_strcpy(req->path, path);
+    }
+
+    return req;
+}
+
+static void req_submit(lv_fs_async_req_t * req)
+{
+    if(!thread_inited) {
+        lv_mutex_init(&lock);
+        lv_thread_sync_init(&work_sync);
+        lv_thread_sync_init(&cancel_sync);
+        lv_thread_init(&worker_thread, LV_THREAD_PRIO_MID, worker_thread_cb, 8 * 1024, NULL);
+        thread_inited = true;
+    }
+
+    if(done_timer == NULL) done_timer = lv_timer_create(done_timer_cb, POLL_PERIOD, NULL);
+    if(active_cnt == 0) lv_timer_resume(done_timer);
+    active_cnt++;
+
+    lv_mutex_lock(&lock);
+    list_append(&pending_head, req);
+    lv_mutex_unlock(&lock);
+
+    lv_thread_sync_signal(&work_sync);
+}
+
+static void req_free(lv_fs_async_req_t * req)
+{
+    if(req->type == LV_FS_ASYNC_READ_FILE) lv_free(req->buf);
+
+    uint32_t i;
+    for(i = 0; i < req->name_cnt; i++) lv_free(req->names[i]);
+    lv_free(req->names);
+    lv_free(req->path);
+    lv_free(req);
+}
+
+static bool list_remove(lv_fs_async_req_t ** head, lv_fs_async_req_t * req)
+{
+    lv_fs_async_req_t ** p = head;
+    while(*p) {
+        if(*p == req) {
+            *p = req->next;
+            req->next = NULL;
+            return true;
+        }
+        p = &(*p)->next;
+    }
+    return false;
+}
+
+static void list_append(lv_fs_async_req_t ** head, lv_fs_async_req_t * req)
+{
+    lv_fs_async_req_t ** p = head;
+    while(*p) p = &(*p)->next;
+    req->next = NULL;
+    *p = req;
+}
+
+static void process(lv_fs_async_req_t * req)
+{
+    switch(req->type) {
+        case LV_FS_ASYNC_OPEN:
+            req->res = lv_fs_open(&req->file, req->path, req->mode);
+            break;
+        case LV_FS_ASYNC_READ:
+            req->res = lv_fs_read(req->file_p, req->buf, req->btr, &req->br);
+            break;
+        case LV_FS_ASYNC_READ_FILE:
+            process_read_file(req);
+            break;
+        case LV_FS_ASYNC_DIR_READ:
+            process_dir_read(req);
+            break;
+    }
+}
+
+static void process_read_file(lv_fs_async_req_t * req)
+{
+    lv_fs_file_t f;
+    req->res = lv_fs_open(&f, req->path, LV_FS_MODE_RD);
+    if(req->res != LV_FS_RES_OK) return;
+
+    uint32_t size = 0;
+    req->res = lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    if(req->res == LV_FS_RES_OK) req->res = lv_fs_tell(&f, &size);
+    if(req->res == LV_FS_RES_OK) req->res = lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+
+    if(req->res == LV_FS_RES_OK) {
+        /*+1 to be able to use `buf` as a string*/
+        uint8_t * buf = lv_malloc(size + 1);
+        if(buf == NULL) {
+            req->res = LV_FS_RES_OUT_OF_MEM;
+        }
+        else {
+            req->res = lv_fs_read(&f, buf, size, &req->br);
+            buf[req->br] = '\0';
+            req->buf = buf;
+        }
+    }
+
+    lv_fs_close(&f);
+}
+
+static void process_dir_read(lv_fs_async_req_t * req)
+{
+    lv_fs_dir_t dir;
+    req->res = lv_fs_dir_open(&dir, req->path);
+    if(req->res != LV_FS_RES_OK) return;
+
+    uint32_t cap = 0;
+    char fn[LV_FS_MAX_PATH_LENGTH];
+    while(1) {
+        req->res = lv_fs_dir_read(&dir, fn);
+        if(req->res != LV_FS_RES_OK || fn[0] == '\0') break;
+
+        if(req->name_cnt == cap) {
+            uint32_t new_cap = cap ? cap * 2 : 16;
+            char ** names = lv_realloc(req->names, new_cap * sizeof(char *));
+            if(names == NULL) {
+                req->res = LV_FS_RES_OUT_OF_MEM;
+                break;
+            }
+            req->names = names;
+            cap = new_cap;
+        }
+
+        char * name = lv_malloc(lv_strlen(fn) + 1);
+        if(name == NULL) {
+            req->res = LV_FS_RES_OUT_OF_MEM;
+            break;
+        }
+        lv_strcpy(name, fn);
+        req->names[req->name_cnt] = name;
+        req->name_cnt++;
+    }
+
+    lv_fs_dir_close(&dir);
+}
+
+static void worker_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    while(1) {
+        lv_mutex_lock(&lock);
+        lv_fs_async_req_t * req = pending_head;
+        if(req) {
+            pending_head = req->next;
+            req->next = NULL;
+            running = req;
+        }
+        lv_mutex_unlock(&lock);
+
+        if(req == NULL) {
+            lv_thread_sync_wait(&work_sync);
+            continue;
+        }
+
+        process(req);
+
+        lv_mutex_lock(&lock);
+        running = NULL;
+        list_append(&done_head, req);
+        bool canceled = req->canceled;
+        lv_mutex_unlock(&lock);
+
+        if(canceled) lv_thread_sync_signal(&cancel_sync);
+    }
+}
+
+static void done_timer_cb(lv_timer_t * t)
+{
+    while(1) {
+        /*Take the requests one by one as the callbacks might cancel other completed requests*/
+        lv_mutex_lock(&lock);
+        lv_fs_async_req_t * req = done_head;
+        if(req) done_head = req->next;
+        lv_mutex_unlock(&lock);
+
+        if(req == NULL) break;
+
+        active_cnt--;
+        if(req->type == LV_FS_ASYNC_OPEN) {
+            /*The file was opened into the request to be able to close it if the request is canceled*/
+            *req->file_p = req->file;
+        }
+
+        if(req->cb) req->cb(req);
+        req_free(req);
+    }
+
+    if(active_cnt == 0) lv_timer_pause(t);
+}
+
+#endif /*LV_USE_FS_ASYNC*/
@@ -0,0 +1,138 @@
+/**
+ * @file lv_fs_async.h
+ *
+ */
+
+#ifndef LV_FS_ASYNC_H
+#define LV_FS_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_FS_ASYNC
+
+#include "lv_fs.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_FS_ASYNC_OPEN,
+    LV_FS_ASYNC_READ,
+    LV_FS_ASYNC_READ_FILE,
+    LV_FS_ASYNC_DIR_READ,
+} lv_fs_async_type_t;
+
+struct _lv_fs_async_req_t;
+
+/**
+ * Called in `lv_timer_handler()` when a request is completed.
+ * The request is freed when the callback returns.
+ */
+typedef void (*lv_fs_async_cb_t)(struct _lv_fs_async_req_t * req);
+
+typedef struct _lv_fs_async_req_t {
+    lv_fs_async_type_t type;
+    lv_fs_res_t res;            /**< Result of the request*/
+    lv_fs_async_cb_t cb;
+    void * user_data;
+    lv_fs_file_t * file_p;      /**< OPEN, READ: the file to open or read*/
+    void * buf;                 /**< READ: the destination buffer. READ_FILE: the content of the file*/
+    uint32_t btr;               /**< READ: bytes to read*/
+    uint32_t br;                /**< READ, READ_FILE: number of bytes read*/
+    char ** names;              /**< DIR_READ: name of the entries. Directories start with '/'*/
+    uint32_t name_cnt;          /**< DIR_READ: number of entries in `names`*/
+    char * path;                /**< OPEN, READ_FILE, DIR_READ: path of the file or directory*/
+
+    /*Internal fields*/
+    struct _lv_fs_async_req_t * next;
+    lv_fs_mode_t mode;
+    lv_fs_file_t file;
+    bool canceled;
+} lv_fs_async_req_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Open a file on the file system thread.
+ * `file_p` is set before `cb` is called. Check `req->res` to see if it was successful.
+ * @param file_p    pointer to a lv_fs_file_t variable. It needs to be valid until the callback is called.
+ * @param path      path to the file beginning with the driver letter (e.g. S:/folder/file.txt)
+ * @param mode      read: FS_MODE_RD, write: FS_MODE_WR, both: FS_MODE_RD | FS_MODE_WR
+ * @param cb        called when the file is opened
+ * @param user_data custom data, available as `req->user_data` in the callback
+ * @return          the request or NULL on error
+ */
+lv_fs_async_req_t * lv_fs_async_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mode,
+                                     lv_fs_async_cb_t cb, void * user_data);
+
+/**
+ * Read from a file on the file system thread.
+ * The file and the buffer shouldn't be used until the callback is called.
+ * @param file_p    pointer to an opened lv_fs_file_t variable
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       bytes to read
+ * @param cb        called when the data is read. `req->br` tells the number of read bytes.
+ * @param user_data custom data, available as `req->user_data` in the callback
+ * @return          the request or NULL on error
+ */
+lv_fs_async_req_t * lv_fs_async_read(lv_fs_file_t * file_p, void * buf, uint32_t btr,
+                                     lv_fs_async_cb_t cb, void * user_data);
+
+/**
+ * Read a whole file into an allocated buffer on the file system thread.
+ * In the callback `req->buf` and `req->br` tell the content and the size of the file.
+ * The buffer is freed after the callback unless the callback sets `req->buf = NULL`
+ * and takes over the buffer. In this case it needs to be freed with `lv_free()`.
+ * @param path      path to the file beginning with the driver letter (e.g. S:/folder/file.txt)
+ * @param cb        called when the file is read
+ * @param user_data custom data, available as `req->user_data` in the callback
+ * @return          the request or NULL on error
+ */
+lv_fs_async_req_t * lv_fs_async_read_file(const char * path, lv_fs_async_cb_t cb, void * user_data);
+
+/**
+ * Read the entries of a directory on the file system thread.
+ * In the callback `req->names` and `req->name_cnt` tell the entries as returned by `lv_fs_dir_read()`.
+ * The names are freed after the callback.
+ * @param path      path to the directory beginning with the driver letter (e.g. S:/folder)
+ * @param cb        called when the directory is read
+ * @param user_data custom data, available as `req->user_data` in the callback
+ * @return          the request or NULL on error
+ */
+lv_fs_async_req_t * lv_fs_async_dir_read(const char * path, lv_fs_async_cb_t cb, void * user_data);
+
+/**
+ * Cancel a request. Its callback won't be called and the request is freed.
+ * If the request is being processed it waits until it's finished, so the buffers
+ * passed to the request can be freed after this function returns.
+ * A file opened by a canceled OPEN request is closed.
+ * Shouldn't be called after the callback of the request was called.
+ * @param req       pointer to a request
+ */
+void lv_fs_async_cancel(lv_fs_async_req_t * req);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FS_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FS_ASYNC_H*/
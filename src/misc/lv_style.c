@@ -428,35 +428,42 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
     if(style->prop_cnt > 1) {
         uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
-        int32_t i;
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            if(LV_STYLE_PROP_ID_MASK(props[i]) == prop_id) {
+
+        /*The properties are sorted by their ID to allow binary search in `lv_style_get_prop_inlined`.
+         *Find the property or the place where it should be inserted.*/
+        uint32_t first = 0;
+        uint32_t last = style->prop_cnt;
+        while(first < last) {
+            uint32_t i = (first + last) >> 1;
+            lv_style_prop_t act_id = LV_STYLE_PROP_ID_MASK(props[i]);
+            if(act_id < prop_id) first = i + 1;
+            else if(act_id > prop_id) last = i;
+            else {
                 lv_style_value_t * values = (lv_style_value_t *)style->v_p.values_and_props;
                 value_adjustment_helper(prop_and_meta, value, &props[i], &values[i]);
                 return;
             }
         }
+        uint32_t pos = first;
 
         size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(uint16_t));
         uint8_t * values_and_props = lv_realloc(style->v_p.values_and_props, size);
         if(values_and_props == NULL) return;
         style->v_p.values_and_props = values_and_props;
 
-        tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        props = (uint16_t *)tmp;
-        /*Shift all props to make place for the value before them*/
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            props[i + sizeof(lv_style_value_t) / sizeof(uint16_t)] = props[i];
-        }
-        style->prop_cnt++;
+        /*Move the props to make place for the new value and leave a gap for the new prop*/
+        uint16_t * old_props = (uint16_t *)(values_and_props + style->prop_cnt * sizeof(lv_style_value_t));
+        uint16_t * new_props = (uint16_t *)(values_and_props + (style->prop_cnt + 1) * sizeof(lv_style_value_t));
+        lv_memmove(&new_props[pos + 1], &old_props[pos], (style->prop_cnt - pos) * sizeof(uint16_t));
+        lv_memmove(new_props, old_props, pos * sizeof(uint16_t));
 
-        /*Go to the new position wit the props*/
-        tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        props = (uint16_t *)tmp;
+        /*Leave a gap for the new value*/
         lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+        lv_memmove(&values[pos + 1], &values[pos], (style->prop_cnt - pos) * sizeof(lv_style_value_t));
+        style->prop_cnt++;
 
         /*Set the new property and value*/
-        value_adjustment_helper(prop_and_meta, value, &props[style->prop_cnt - 1], &values[style->prop_cnt - 1]);
+        value_adjustment_helper(prop_and_meta, value, &new_props[pos], &values[pos]);
     }
     else if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop_id) {
@@ -473,9 +480,11 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         uint8_t * tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
         lv_style_value_t * values = (lv_style_value_t *)values_and_props;
-        props[0] = style->prop1;
-        values[0] = value_tmp;
-        value_adjustment_helper(prop_and_meta, value, &props[1], &values[1]);
+        /*Keep the properties sorted by their ID*/
+        uint32_t old_pos = LV_STYLE_PROP_ID_MASK(style->prop1) < prop_id ? 0 : 1;
+        props[old_pos] = style->prop1;
+        values[old_pos] = value_tmp;
+        value_adjustment_helper(prop_and_meta, value, &props[1 - old_pos], &values[1 - old_pos]);
     }
     else {
         style->prop_cnt = 1;
@@ -511,10 +511,15 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
     if(style->prop_cnt > 1) {
         uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
-        uint32_t i;
-        for(i = 0; i < style->prop_cnt; i++) {
+        /*The properties are sorted by their ID*/
+        uint32_t first = 0;
+        uint32_t last = style->prop_cnt;
+        while(first < last) {
+            uint32_t i = (first + last) >> 1;
             lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(props[i]);
-            if(prop_id == prop) {
+            if(prop_id < prop) first = i + 1;
+            else if(prop_id > prop) last = i;
+            else {
                 if(props[i] & LV_STYLE_PROP_META_INHERIT)
                     return LV_STYLE_RES_INHERIT;
                 if(props[i] & LV_STYLE_PROP_META_INITIAL)
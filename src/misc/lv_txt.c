@@ -28,6 +28,7 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static inline uint32_t encoded_next_fast(const char * txt, uint32_t * i);
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
     static uint8_t lv_txt_utf8_size(const char * str);
     static uint32_t lv_txt_unicode_to_utf8(uint32_t letter_uni);
@@ -51,6 +52,21 @@
  *  STATIC VARIABLES
  **********************/
 
+#if LV_TXT_ENC == LV_TXT_ENC_UTF8
+/*Length of the UTF-8 characters indexed by the upper 5 bits of their first byte. 0: not a first byte*/
+static const uint8_t utf8_size_lut[32] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /*0xxxxxxx: ASCII*/
+    0, 0, 0, 0, 0, 0, 0, 0,                           /*10xxxxxx: continuation byte*/
+    2, 2, 2, 2,                                       /*110xxxxx*/
+    3, 3,                                             /*1110xxxx*/
+    4,                                                /*11110xxx*/
+    0                                                 /*11111xxx: invalid*/
+};
+
+/*Mask of the payload bits in the first byte, indexed by the length of the character*/
+static const uint8_t utf8_first_byte_mask[5] = {0x00, 0x7F, 0x1F, 0x0F, 0x07};
+#endif
+
 /**********************
  *  GLOBAL VARIABLES
  **********************/
@@ -80,9 +96,6 @@
  **********************/
 
 #define LV_IS_ASCII(value)              ((value & 0x80U) == 0x00U)
-#define LV_IS_2BYTES_UTF8_CODE(value)   ((value & 0xE0U) == 0xC0U)
-#define LV_IS_3BYTES_UTF8_CODE(value)   ((value & 0xF0U) == 0xE0U)
-#define LV_IS_4BYTES_UTF8_CODE(value)   ((value & 0xF8U) == 0xF0U)
 #define LV_IS_INVALID_UTF8_CODE(value)  ((value & 0xC0U) != 0x80U)
 
 /**********************
@@ -185,12 +198,12 @@ static uint32_t lv_txt_get_next_word(const char * txt, const lv_font_t * font,
     uint32_t break_index = NO_BREAK_FOUND; /*only used for "long" words*/
     uint32_t break_letter_count = 0; /*Number of characters up to the long word break point*/
 
-    letter = _lv_txt_encoded_next(txt, &i_next);
+    letter = encoded_next_fast(txt, &i_next);
     i_next_next = i_next;
 
     /*Obtain the full word, regardless if it fits or not in max_width*/
     while(txt[i] != '\0') {
-        letter_next = _lv_txt_encoded_next(txt, &i_next_next);
+        letter_next = encoded_next_fast(txt, &i_next_next);
         word_len++;
 
         letter_w = lv_font_get_glyph_width(font, letter, letter_next);
@@ -344,16 +357,30 @@ lv_coord_t lv_txt_get_width(const char * txt, uint32_t length, const lv_font_t *
     lv_coord_t width             = 0;
 
     if(length != 0) {
+        /*The next letter is needed for kerning, and it's the letter of the next step.
+         *Keep it to decode every letter only once.*/
+        uint32_t i_next = 0;
+        uint32_t letter = encoded_next_fast(txt, &i_next);
         while(i < length) {
-            uint32_t letter;
-            uint32_t letter_next;
-            _lv_txt_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+            uint32_t i_next_next = i_next;
+            uint32_t letter_next = letter != '\0' ? encoded_next_fast(txt, &i_next_next) : 0;
 
             lv_coord_t char_width = lv_font_get_glyph_width(font, letter, letter_next);
             if(char_width > 0) {
                 width += char_width;
                 width += letter_space;
             }
+
+            i = i_next;
+            if(letter != '\0') {
+                i_next = i_next_next;
+                letter = letter_next;
+            }
+            else {
+                /*No next letter was decoded after an invalid one*/
+                i_next = i;
+                letter = encoded_next_fast(txt, &i_next);
+            }
         }
 
         if(width > 0) {
@@ -365,6 +392,255 @@ lv_coord_t lv_txt_get_width(const char * txt, uint32_t length, const lv_font_t *
     return width;
 }
 
+void lv_txt_layout_init(lv_txt_layout_t * layout)
+{
+    lv_memzero(layout, sizeof(lv_txt_layout_t));
+}
+
+void lv_txt_layout_update(lv_txt_layout_t * layout, const char * text, const lv_font_t * font,
+                          lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(lv_txt_layout_is_valid(layout, text, font, letter_space, line_space, max_width, flag)) return;
+
+    lv_txt_layout_invalidate(layout);
+    layout->line_cnt = 0;
+    layout->size.x = 0;
+    layout->size.y = 0;
+
+    if(text == NULL) return;
+    if(font == NULL) return;
+
+    /*The lines don't depend on the width in these cases*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    /*Break the lines the same way as `lv_txt_get_size`*/
+    uint32_t line_start     = 0;
+    uint32_t new_line_start = 0;
+    uint16_t letter_height = lv_font_get_line_height(font);
+    lv_point_t * size_res = &layout->size;
+
+    while(text[line_start] != '\0') {
+        new_line_start += _lv_txt_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+
+        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(lv_coord_t)) {
+            LV_LOG_WARN("integer overflow while calculating text height");
+            return;
+        }
+        else {
+            size_res->y += letter_height;
+            size_res->y += line_space;
+        }
+
+        if(layout->line_cnt == layout->line_cap) {
+            uint32_t new_cap = layout->line_cap ? layout->line_cap * 2 : 8;
+            lv_txt_layout_line_t * new_lines = lv_realloc(layout->lines, new_cap * sizeof(lv_txt_layout_line_t));
+            LV_ASSERT_MALLOC(new_lines);
+            if(new_lines == NULL) return;
+            layout->lines = new_lines;
+            layout->line_cap = new_cap;
+        }
+
+        lv_txt_layout_line_t * line = &layout->lines[layout->line_cnt];
+        line->start = line_start;
+        line->width = lv_txt_get_width(&text[line_start], new_line_start - line_start, font, letter_space);
+        layout->line_cnt++;
+
+        size_res->x = LV_MAX(line->width, size_res->x);
+        line_start  = new_line_start;
+    }
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
+        size_res->y += letter_height + line_space;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    if(size_res->y == 0)
+        size_res->y = letter_height;
+    else
+        size_res->y -= line_space;
+
+    layout->text = text;
+    layout->font = font;
+    layout->font_line_height = font->line_height;
+    layout->letter_space = letter_space;
+    layout->line_space = line_space;
+    layout->max_width = max_width;
+    layout->flag = flag;
+    layout->text_len = line_start;
+}
+
+void lv_txt_layout_edit(lv_txt_layout_t * layout, const char * text, uint32_t pos, uint32_t del_len,
+                        uint32_t ins_len)
+{
+    if(layout->text == NULL) return;
+
+#if LV_USE_BIDI
+    lv_free(layout->bidi_text);
+    layout->bidi_text = NULL;
+#endif
+
+    /*Find the last line starting before the edited part*/
+    uint32_t first = lv_txt_layout_get_line_of_byte(layout, pos);
+
+    /*Go to the start of the paragraph. The text before `pos` hasn't changed,
+     *and the line breaks of a paragraph don't depend on the text before it.*/
+    while(first > 0 && layout->lines[first].start > 0 &&
+          text[layout->lines[first].start - 1] != '\n' && text[layout->lines[first].start - 1] != '\r') {
+        first--;
+    }
+
+    uint32_t old_end = pos + del_len;   /*End of the edited part in the old text*/
+    uint32_t new_end = pos + ins_len;   /*End of the edited part in the new text*/
+
+    /*Break the lines again until a line starts where an old line started after the edited part.
+     *The text from there is the same as before, so the old lines can be reused.*/
+    lv_txt_layout_line_t * new_lines = NULL;
+    uint32_t new_cnt = 0;
+    uint32_t new_cap = 0;
+    uint32_t reuse = first < layout->line_cnt ? first : layout->line_cnt;
+    uint32_t line_start = first < layout->line_cnt ? layout->lines[first].start : 0;
+
+    while(text[line_start] != '\0') {
+        if(line_start >= new_end) {
+            uint32_t old_start = line_start - new_end + old_end;
+            while(reuse < layout->line_cnt && layout->lines[reuse].start < old_start) reuse++;
+            if(reuse < layout->line_cnt && layout->lines[reuse].start == old_start) break;
+        }
+
+        if(new_cnt == new_cap) {
+            new_cap = new_cap ? new_cap * 2 : 8;
+            lv_txt_layout_line_t * tmp = lv_realloc(new_lines, new_cap * sizeof(lv_txt_layout_line_t));
+            LV_ASSERT_MALLOC(tmp);
+            if(tmp == NULL) {
+                lv_free(new_lines);
+                lv_txt_layout_invalidate(layout);
+                return;
+            }
+            new_lines = tmp;
+        }
+
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&text[line_start], layout->font, layout->letter_space,
+                                                               layout->max_width, NULL, layout->flag);
+        new_lines[new_cnt].start = line_start;
+        new_lines[new_cnt].width = lv_txt_get_width(&text[line_start], line_end - line_start, layout->font,
+                                                    layout->letter_space);
+        new_cnt++;
+        line_start = line_end;
+    }
+
+    /*No old line is reused if the end of the text was reached*/
+    if(text[line_start] == '\0') reuse = layout->line_cnt;
+
+    /*The new lines replace the old lines from `first` to `reuse`*/
+    uint32_t tail_cnt = layout->line_cnt - reuse;
+    uint32_t line_cnt = first + new_cnt + tail_cnt;
+    if(line_cnt > layout->line_cap) {
+        lv_txt_layout_line_t * tmp = lv_realloc(layout->lines, line_cnt * sizeof(lv_txt_layout_line_t));
+        LV_ASSERT_MALLOC(tmp);
+        if(tmp == NULL) {
+            lv_free(new_lines);
+            lv_txt_layout_invalidate(layout);
+            return;
+        }
+        layout->lines = tmp;
+        layout->line_cap = line_cnt;
+    }
+
+    lv_memmove(&layout->lines[first + new_cnt], &layout->lines[reuse], tail_cnt * sizeof(lv_txt_layout_line_t));
+    if(new_cnt) lv_memcpy(&layout->lines[first], new_lines, new_cnt * sizeof(lv_txt_layout_line_t));
+    lv_free(new_lines);
+
+    uint32_t i;
+    for(i = first + new_cnt; i < line_cnt; i++) {
+        layout->lines[i].start = layout->lines[i].start - old_end + new_end;
+    }
+
+    layout->line_cnt = line_cnt;
+    layout->text = text;
+    layout->text_len = layout->text_len - del_len + ins_len;
+
+    /*Calculate the size the same way as `lv_txt_layout_update`*/
+    uint16_t letter_height = lv_font_get_line_height(layout->font);
+    uint32_t line_h = (uint32_t)letter_height + layout->line_space;
+    uint32_t h = line_cnt * line_h;
+    if(layout->text_len != 0 && (text[layout->text_len - 1] == '\n' || text[layout->text_len - 1] == '\r')) h += line_h;
+
+    if((uint64_t)line_cnt * line_h > LV_MAX_OF(lv_coord_t)) {
+        /*Let `lv_txt_layout_update` handle it*/
+        lv_txt_layout_invalidate(layout);
+        return;
+    }
+
+    layout->size.x = 0;
+    for(i = 0; i < line_cnt; i++) {
+        layout->size.x = LV_MAX(layout->lines[i].width, layout->size.x);
+    }
+    layout->size.y = h == 0 ? letter_height : (lv_coord_t)(h - layout->line_space);
+}
+
+uint32_t lv_txt_layout_get_line_of_byte(const lv_txt_layout_t * layout, uint32_t byte_id)
+{
+    /*Binary search for the last line starting before or at `byte_id`*/
+    uint32_t first = 0;
+    uint32_t last = layout->line_cnt;
+    while(last - first > 1) {
+        uint32_t mid = (first + last) / 2;
+        if(layout->lines[mid].start <= byte_id) first = mid;
+        else last = mid;
+    }
+
+    return first;
+}
+
+uint32_t lv_txt_layout_get_line_at_y(const lv_txt_layout_t * layout, lv_coord_t y)
+{
+    int32_t line_h = layout->font_line_height + layout->line_space;
+    int32_t dist = (int32_t)y - layout->font_line_height;
+    if(dist <= 0 || line_h <= 0) return 0;
+
+    uint32_t line_idx = (uint32_t)((dist + line_h - 1) / line_h);
+    return LV_MIN(line_idx, layout->line_cnt);
+}
+
+lv_coord_t lv_txt_layout_get_line_y(const lv_txt_layout_t * layout, uint32_t line_idx)
+{
+    return (lv_coord_t)((int32_t)line_idx * (layout->font_line_height + layout->line_space));
+}
+
+uint32_t lv_txt_layout_get_line_end(const lv_txt_layout_t * layout, uint32_t line_idx)
+{
+    if(line_idx + 1 < layout->line_cnt) return layout->lines[line_idx + 1].start;
+    else return layout->text_len;
+}
+
+bool lv_txt_layout_is_valid(const lv_txt_layout_t * layout, const char * text, const lv_font_t * font,
+                            lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(layout->text == NULL) return false;
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    return layout->text == text && layout->font == font && layout->font_line_height == font->line_height &&
+           layout->letter_space == letter_space && layout->line_space == line_space &&
+           layout->max_width == max_width && layout->flag == flag;
+}
+
+void lv_txt_layout_invalidate(lv_txt_layout_t * layout)
+{
+    layout->text = NULL;
+#if LV_USE_BIDI
+    lv_free(layout->bidi_text);
+    layout->bidi_text = NULL;
+#endif
+}
+
+void lv_txt_layout_free(lv_txt_layout_t * layout)
+{
+    lv_txt_layout_invalidate(layout);
+    lv_free(layout->lines);
+    lv_txt_layout_init(layout);
+}
+
 void _lv_txt_ins(char * txt_buf, uint32_t pos, const char * ins_txt)
 {
     if(txt_buf == NULL || ins_txt == NULL) return;
@@ -377,10 +653,7 @@ void _lv_txt_ins(char * txt_buf, uint32_t pos, const char * ins_txt)
     pos              = _lv_txt_encoded_get_byte_id(txt_buf, pos); /*Convert to byte index instead of letter index*/
 
     /*Copy the second part into the end to make place to text to insert*/
-    size_t i;
-    for(i = new_len; i >= pos + ins_len; i--) {
-        txt_buf[i] = txt_buf[i - ins_len];
-    }
+    lv_memmove(txt_buf + pos + ins_len, txt_buf + pos, new_len - ins_len - pos + 1);
 
     /*Copy the text into the new space*/
     lv_memcpy(txt_buf + pos, ins_txt, ins_len);
@@ -395,11 +668,8 @@ void _lv_txt_cut(char * txt, uint32_t pos, uint32_t len)
     pos = _lv_txt_encoded_get_byte_id(txt, pos); /*Convert to byte index instead of letter index*/
     len = _lv_txt_encoded_get_byte_id(&txt[pos], len);
 
-    /*Copy the second part into the end to make place to text to insert*/
-    uint32_t i;
-    for(i = pos; i <= old_len - len; i++) {
-        txt[i] = txt[i + len];
-    }
+    /*Move the second part to the place of the deleted part*/
+    lv_memmove(txt + pos, txt + pos + len, old_len - len - pos + 1);
 }
 
 char * _lv_txt_set_text_vfmt(const char * fmt, va_list ap)
@@ -446,8 +716,36 @@ char * _lv_txt_set_text_vfmt(const char * fmt, va_list ap)
 
 void _lv_txt_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t * letter_next, uint32_t * ofs)
 {
-    *letter = _lv_txt_encoded_next(txt, ofs);
-    *letter_next = *letter != '\0' ? _lv_txt_encoded_next(&txt[*ofs], NULL) : 0;
+    *letter = encoded_next_fast(txt, ofs);
+    if(*letter != '\0') {
+        uint32_t i_next = *ofs;
+        *letter_next = encoded_next_fast(txt, &i_next);
+    }
+    else {
+        *letter_next = 0;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Decode the next letter. ASCII letters are the same in all encodings,
+ * so they are decoded here, without calling the decoder of the encoding.
+ * @param txt pointer to '\0' terminated string
+ * @param i start byte index in 'txt'. After the call it will point to the next letter.
+ * @return the decoded Unicode character or 0 on invalid data
+ */
+static inline uint32_t encoded_next_fast(const char * txt, uint32_t * i)
+{
+    uint8_t c = (uint8_t)txt[*i];
+    if(c < 0x80) {
+        (*i)++;
+        return c;
+    }
+
+    return _lv_txt_encoded_next(txt, i);
 }
 
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
@@ -462,15 +760,7 @@ void _lv_txt_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t
  */
 static uint8_t lv_txt_utf8_size(const char * str)
 {
-    if(LV_IS_ASCII(str[0]))
-        return 1;
-    else if(LV_IS_2BYTES_UTF8_CODE(str[0]))
-        return 2;
-    else if(LV_IS_3BYTES_UTF8_CODE(str[0]))
-        return 3;
-    else if(LV_IS_4BYTES_UTF8_CODE(str[0]))
-        return 4;
-    return 0;
+    return utf8_size_lut[(uint8_t)str[0] >> 3];
 }
 
 /**
@@ -552,61 +842,32 @@ static uint32_t lv_txt_utf8_next(const char * txt, uint32_t * i)
      * 00000000 000wwwzz zzzzyyyy yyxxxxxx -> 11110www 10zzzzzz 10yyyyyy 10xxxxxx
      */
 
-    uint32_t result = 0;
-
     /*Dummy 'i' pointer is required*/
     uint32_t i_tmp = 0;
     if(i == NULL) i = &i_tmp;
 
+    const uint8_t * p = (const uint8_t *)&txt[*i];
+
     /*Normal ASCII*/
-    if(LV_IS_ASCII(txt[*i])) {
-        result = txt[*i];
+    if(LV_IS_ASCII(p[0])) {
         (*i)++;
+        return p[0];
     }
+
     /*Real UTF-8 decode*/
-    else {
-        /*2 bytes UTF-8 code*/
-        if(LV_IS_2BYTES_UTF8_CODE(txt[*i])) {
-            result = (uint32_t)(txt[*i] & 0x1F) << 6;
-            (*i)++;
-            if(LV_IS_INVALID_UTF8_CODE(txt[*i])) return 0;
-            result += (txt[*i] & 0x3F);
-            (*i)++;
-        }
-        /*3 bytes UTF-8 code*/
-        else if(LV_IS_3BYTES_UTF8_CODE(txt[*i])) {
-            result = (uint32_t)(txt[*i] & 0x0F) << 12;
-            (*i)++;
-
-            if(LV_IS_INVALID_UTF8_CODE(txt[*i])) return 0;
-            result += (uint32_t)(txt[*i] & 0x3F) << 6;
-            (*i)++;
-
-            if(LV_IS_INVALID_UTF8_CODE(txt[*i])) return 0;
-            result += (txt[*i] & 0x3F);
-            (*i)++;
-        }
-        /*4 bytes UTF-8 code*/
-        else if(LV_IS_4BYTES_UTF8_CODE(txt[*i])) {
-            result = (uint32_t)(txt[*i] & 0x07) << 18;
-            (*i)++;
-
-            if(LV_IS_INVALID_UTF8_CODE(txt[*i])) return 0;
-            result += (uint32_t)(txt[*i] & 0x3F) << 12;
-            (*i)++;
-
-            if(LV_IS_INVALID_UTF8_CODE(txt[*i])) return 0;
-            result += (uint32_t)(txt[*i] & 0x3F) << 6;
-            (*i)++;
-
-            if(LV_IS_INVALID_UTF8_CODE(txt[*i])) return 0;
-            result += txt[*i] & 0x3F;
-            (*i)++;
-        }
-        else {
-            (*i)++; /*Not UTF-8 char. Go the next.*/
-        }
+    uint32_t size = utf8_size_lut[p[0] >> 3];
+    (*i)++;
+    if(size == 0) return 0; /*Not UTF-8 char. Go the next.*/
+
+    uint32_t result = p[0] & utf8_first_byte_mask[size];
+    uint32_t k;
+    for(k = 1; k < size; k++) {
+        /*Stop at the invalid byte (it can be the terminating '\0' too)*/
+        if(LV_IS_INVALID_UTF8_CODE(p[k])) return 0;
+        result = (result << 6) + (p[k] & 0x3F);
+        (*i)++;
     }
+
     return result;
 }
 
@@ -655,7 +916,7 @@ static uint32_t lv_txt_utf8_get_byte_id(const char * txt, uint32_t utf8_id)
     uint32_t i;
     uint32_t byte_cnt = 0;
     for(i = 0; i < utf8_id && txt[byte_cnt] != '\0'; i++) {
-        uint8_t c_size = _lv_txt_encoded_size(&txt[byte_cnt]);
+        uint8_t c_size = lv_txt_utf8_size(&txt[byte_cnt]);
         /* If the char was invalid tell it's 1 byte long*/
         byte_cnt += c_size ? c_size : 1;
     }
@@ -676,7 +937,9 @@ static uint32_t lv_txt_utf8_get_char_id(const char * txt, uint32_t byte_id)
     uint32_t char_cnt = 0;
 
     while(i < byte_id) {
-        _lv_txt_encoded_next(txt, &i); /*'i' points to the next letter so use the prev. value*/
+        /*Skip the ASCII letters without decoding them*/
+        if(LV_IS_ASCII(txt[i])) i++;
+        else lv_txt_utf8_next(txt, &i); /*'i' points to the next letter so use the prev. value*/
         char_cnt++;
     }
 
@@ -695,7 +958,9 @@ static uint32_t lv_txt_utf8_get_length(const char * txt)
     uint32_t i   = 0;
 
     while(txt[i] != '\0') {
-        _lv_txt_encoded_next(txt, &i);
+        /*Skip the ASCII letters without decoding them*/
+        if(LV_IS_ASCII(txt[i])) i++;
+        else lv_txt_utf8_next(txt, &i);
         len++;
     }
 
@@ -65,6 +65,38 @@ typedef _lv_text_align_t lv_text_align_t;
 typedef uint8_t lv_text_align_t;
 #endif /*DOXYGEN*/
 
+/** A line of a text layout*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the first character of the line*/
+    lv_coord_t width;   /**< Width of the line, as returned by `lv_txt_get_width`*/
+} lv_txt_layout_line_t;
+
+/** Line breaks of a text, stored to avoid breaking the lines again
+ * as long as the text and its parameters don't change*/
+typedef struct {
+    /*The parameters the lines were created with. `text == NULL` means invalid.*/
+    const char * text;
+    const lv_font_t * font;
+    lv_coord_t font_line_height;    /**< To notice if the size of the font was changed*/
+    lv_coord_t letter_space;
+    lv_coord_t line_space;
+    lv_coord_t max_width;
+    lv_text_flag_t flag;
+
+    lv_txt_layout_line_t * lines;
+    uint32_t line_cnt;
+    uint32_t line_cap;      /**< Number of lines `lines` has space for*/
+    uint32_t text_len;      /**< End of the last line*/
+    lv_point_t size;        /**< Size of the text, as returned by `lv_txt_get_size`*/
+
+#if LV_USE_BIDI
+    /*The lines in visual order, each terminated by '\0', so line `i` starts at `lines[i].start + i`.
+     *NULL if not created. See `_lv_bidi_process_layout`.*/
+    char * bidi_text;
+    uint8_t bidi_dir;       /**< The `lv_base_dir_t` `bidi_text` was created with*/
+#endif
+} lv_txt_layout_t;
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -112,6 +144,92 @@ uint32_t _lv_txt_get_next_line(const char * txt, const lv_font_t * font, lv_coor
  */
 lv_coord_t lv_txt_get_width(const char * txt, uint32_t length, const lv_font_t * font, lv_coord_t letter_space);
 
+/**
+ * Initialize a text layout as invalid
+ * @param layout pointer to a text layout
+ */
+void lv_txt_layout_init(lv_txt_layout_t * layout);
+
+/**
+ * Break a text to lines and store the lines and the size of the text in a layout.
+ * Nothing happens if the layout was already created with the same parameters.
+ * The parameters are the same as in `lv_txt_get_size`.
+ * @param layout pointer to a text layout
+ * @param text pointer to a text. It's not copied, so it must be valid while the layout is used.
+ * @param font pointer to font of the text
+ * @param letter_space letter space of the text
+ * @param line_space line space of the text
+ * @param max_width max width of the text (break the lines to fit this size). Set COORD_MAX to avoid
+ * @param flag settings for the text from ::lv_text_flag_t
+ */
+void lv_txt_layout_update(lv_txt_layout_t * layout, const char * text, const lv_font_t * font,
+                          lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Update a layout after a part of its text was replaced. Only the lines of the edited paragraph are
+ * broken again, the lines after it are reused. Nothing happens if the layout is invalid.
+ * @param layout pointer to a text layout created for the text before the edit
+ * @param text pointer to the edited text. Can be the same buffer as before the edit.
+ * @param pos byte index where the text was changed
+ * @param del_len number of bytes removed from `pos`
+ * @param ins_len number of bytes inserted to `pos`
+ */
+void lv_txt_layout_edit(lv_txt_layout_t * layout, const char * text, uint32_t pos, uint32_t del_len,
+                        uint32_t ins_len);
+
+/**
+ * Get the line of a character in a valid layout
+ * @param layout pointer to a text layout
+ * @param byte_id byte index of a character. Characters after the last line belong to the last line.
+ * @return index of the line (0 if the layout has no lines)
+ */
+uint32_t lv_txt_layout_get_line_of_byte(const lv_txt_layout_t * layout, uint32_t byte_id);
+
+/**
+ * Get the first line whose bottom is not above a y coordinate.
+ * All lines have the same height so it's found without iterating the lines.
+ * @param layout pointer to a valid text layout
+ * @param y y coordinate relative to the top of the text
+ * @return index of the line, or `line_cnt` if `y` is below the last line
+ */
+uint32_t lv_txt_layout_get_line_at_y(const lv_txt_layout_t * layout, lv_coord_t y);
+
+/**
+ * Get the y coordinate of a line
+ * @param layout pointer to a valid text layout
+ * @param line_idx index of a line
+ * @return y coordinate of the top of the line relative to the top of the text
+ */
+lv_coord_t lv_txt_layout_get_line_y(const lv_txt_layout_t * layout, uint32_t line_idx);
+
+/**
+ * Get where a line ends
+ * @param layout pointer to a valid text layout
+ * @param line_idx index of a line
+ * @return byte index of the first character after the line
+ */
+uint32_t lv_txt_layout_get_line_end(const lv_txt_layout_t * layout, uint32_t line_idx);
+
+/**
+ * Check if a layout was created with the given parameters.
+ * @param layout pointer to a text layout
+ * @return true: the lines of the layout can be used
+ */
+bool lv_txt_layout_is_valid(const lv_txt_layout_t * layout, const char * text, const lv_font_t * font,
+                            lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Mark a layout invalid and free its lines in visual order. Should be called if the text was modified in place.
+ * @param layout pointer to a text layout
+ */
+void lv_txt_layout_invalidate(lv_txt_layout_t * layout);
+
+/**
+ * Free the lines of a layout and mark it invalid
+ * @param layout pointer to a text layout
+ */
+void lv_txt_layout_free(lv_txt_layout_t * layout);
+
 /**
  * Insert a string into an other
  * @param txt_buf the original text (must be big enough for the result text and NULL terminated)
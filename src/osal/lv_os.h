@@ -70,7 +70,8 @@ lv_res_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*call
                         void * user_data);
 
 /**
- * Delete a thread
+ * Delete a thread.
+ * With pthreads it waits until the callback of the thread returns.
  * @param thread        the thread to delete
  * @return              LV_RES_OK: success; LV_RES_INV: failure
  */
@@ -51,9 +51,15 @@ lv_res_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*call
 
 lv_res_t lv_thread_delete(lv_thread_t * thread)
 {
-    LV_UNUSED(thread);
-    /*How?*/
-    return LV_RES_OK;
+    /*A thread can't be stopped from outside so wait for its callback to return*/
+    int ret = pthread_join(thread->thread, NULL);
+    if(ret) {
+        LV_LOG_WARN("Error: %d", ret);
+        return LV_RES_INV;
+    }
+    else {
+        return LV_RES_OK;
+    }
 }
 
 lv_res_t lv_mutex_init(lv_mutex_t * mutex)
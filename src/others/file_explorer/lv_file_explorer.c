@@ -25,6 +25,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_file_explorer_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_file_explorer_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 
 static void browser_file_event_handler(lv_event_t * e);
 #if LV_FILE_EXPLORER_QUICK_ACCESS
@@ -34,6 +35,11 @@ static void browser_file_event_handler(lv_event_t * e);
 
 static void init_style(lv_obj_t * obj);
 static void show_dir(lv_obj_t * obj, const char * path);
+static bool add_table_item(lv_obj_t * obj, uint16_t index, const char * fn);
+static void show_dir_finish(lv_obj_t * obj, const char * path, uint16_t index);
+#if LV_USE_FS_ASYNC
+    static void dir_read_ready_cb(lv_fs_async_req_t * req);
+#endif
 static void strip_ext(char * dir);
 static void file_explorer_sort(lv_obj_t * obj);
 static void sort_by_file_kind(lv_obj_t * tb, int16_t lo, int16_t hi);
@@ -47,6 +53,7 @@ static lv_style_t quick_access_list_btn_style;
 
 const lv_obj_class_t lv_file_explorer_class = {
     .constructor_cb = lv_file_explorer_constructor,
+    .destructor_cb  = lv_file_explorer_destructor,
     .width_def      = LV_SIZE_CONTENT,
     .height_def     = LV_SIZE_CONTENT,
     .instance_size  = sizeof(lv_file_explorer_t),
@@ -340,6 +347,21 @@ static void lv_file_explorer_constructor(const lv_obj_class_t * class_p, lv_obj_
     LV_TRACE_OBJ_CREATE("finished");
 }
 
+static void lv_file_explorer_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+#if LV_USE_FS_ASYNC
+    lv_file_explorer_t * explorer = (lv_file_explorer_t *)obj;
+    if(explorer->dir_req) {
+        lv_fs_async_cancel(explorer->dir_req);
+        explorer->dir_req = NULL;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 
 static void init_style(lv_obj_t * obj)
 {
@@ -533,10 +555,14 @@ static void browser_file_event_handler(lv_event_t * e)
 
 static void show_dir(lv_obj_t * obj, const char * path)
 {
+#if LV_USE_FS_ASYNC
+    /*Read the directory on the file system thread and fill the table when it's ready*/
     lv_file_explorer_t * explorer = (lv_file_explorer_t *)obj;
-
+    if(explorer->dir_req) lv_fs_async_cancel(explorer->dir_req);
+    explorer->dir_req = lv_fs_async_dir_read(path, dir_read_ready_cb, obj);
+#else
     char fn[LV_FILE_EXPLORER_PATH_MAX_LEN];
-    uint16_t index = 0;
+    uint16_t index = 2;
     lv_fs_dir_t dir;
     lv_fs_res_t res;
 
@@ -546,11 +572,6 @@ static void show_dir(lv_obj_t * obj, const char * path)
         return;
     }
 
-    lv_table_set_cell_value_fmt(explorer->file_table, index++, 0, LV_SYMBOL_DIRECTORY "  %s", ".");
-    lv_table_set_cell_value_fmt(explorer->file_table, index++, 0, LV_SYMBOL_DIRECTORY "  %s", "..");
-    lv_table_set_cell_value(explorer->file_table, 0, 1, "0");
-    lv_table_set_cell_value(explorer->file_table, 1, 1, "0");
-
     while(1) {
         res = lv_fs_dir_read(&dir, fn);
         if(res != LV_FS_RES_OK) {
@@ -564,39 +585,82 @@ static void show_dir(lv_obj_t * obj, const char * path)
             break;
         }
 
-        if((is_end_with(fn, ".png") == true)  || (is_end_with(fn, ".PNG") == true)  || \
-           (is_end_with(fn, ".jpg") == true) || (is_end_with(fn, ".JPG") == true) || \
-           (is_end_with(fn, ".bmp") == true) || (is_end_with(fn, ".BMP") == true) || \
-           (is_end_with(fn, ".gif") == true) || (is_end_with(fn, ".GIF") == true)) {
-            lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_IMAGE "  %s", fn);
-            lv_table_set_cell_value(explorer->file_table, index, 1, "1");
-        }
-        else if((is_end_with(fn, ".mp3") == true) || (is_end_with(fn, ".MP3") == true)) {
-            lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_AUDIO "  %s", fn);
-            lv_table_set_cell_value(explorer->file_table, index, 1, "2");
-        }
-        else if((is_end_with(fn, ".mp4") == true) || (is_end_with(fn, ".MP4") == true)) {
-            lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_VIDEO "  %s", fn);
-            lv_table_set_cell_value(explorer->file_table, index, 1, "3");
-        }
-        else if((is_end_with(fn, ".") == true) || (is_end_with(fn, "..") == true)) {
-            /*is dir*/
-            continue;
-        }
-        else if(fn[0] == '/') {/*is dir*/
-            lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_DIRECTORY "  %s", fn + 1);
-            lv_table_set_cell_value(explorer->file_table, index, 1, "0");
-        }
-        else {
-            lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_FILE "  %s", fn);
-            lv_table_set_cell_value(explorer->file_table, index, 1, "4");
-        }
-
-        index++;
+        if(add_table_item(obj, index, fn)) index++;
     }
 
     lv_fs_dir_close(&dir);
 
+    show_dir_finish(obj, path, index);
+#endif
+}
+
+#if LV_USE_FS_ASYNC
+static void dir_read_ready_cb(lv_fs_async_req_t * req)
+{
+    lv_obj_t * obj = req->user_data;
+    lv_file_explorer_t * explorer = (lv_file_explorer_t *)obj;
+    explorer->dir_req = NULL;
+
+    if(req->res != LV_FS_RES_OK && req->name_cnt == 0) {
+        LV_LOG_USER("Open dir error %d!", req->res);
+        return;
+    }
+
+    uint16_t index = 2;
+    uint32_t i;
+    for(i = 0; i < req->name_cnt; i++) {
+        if(add_table_item(obj, index, req->names[i])) index++;
+    }
+
+    show_dir_finish(obj, req->path, index);
+}
+#endif
+
+/*Set a row of the table according to the kind of the file. Return false if the entry was skipped.*/
+static bool add_table_item(lv_obj_t * obj, uint16_t index, const char * fn)
+{
+    lv_file_explorer_t * explorer = (lv_file_explorer_t *)obj;
+
+    if((is_end_with(fn, ".png") == true)  || (is_end_with(fn, ".PNG") == true)  || \
+       (is_end_with(fn, ".jpg") == true) || (is_end_with(fn, ".JPG") == true) || \
+       (is_end_with(fn, ".bmp") == true) || (is_end_with(fn, ".BMP") == true) || \
+       (is_end_with(fn, ".gif") == true) || (is_end_with(fn, ".GIF") == true)) {
+        lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_IMAGE "  %s", fn);
+        lv_table_set_cell_value(explorer->file_table, index, 1, "1");
+    }
+    else if((is_end_with(fn, ".mp3") == true) || (is_end_with(fn, ".MP3") == true)) {
+        lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_AUDIO "  %s", fn);
+        lv_table_set_cell_value(explorer->file_table, index, 1, "2");
+    }
+    else if((is_end_with(fn, ".mp4") == true) || (is_end_with(fn, ".MP4") == true)) {
+        lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_VIDEO "  %s", fn);
+        lv_table_set_cell_value(explorer->file_table, index, 1, "3");
+    }
+    else if((is_end_with(fn, ".") == true) || (is_end_with(fn, "..") == true)) {
+        /*is dir*/
+        return false;
+    }
+    else if(fn[0] == '/') {/*is dir*/
+        lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_DIRECTORY "  %s", fn + 1);
+        lv_table_set_cell_value(explorer->file_table, index, 1, "0");
+    }
+    else {
+        lv_table_set_cell_value_fmt(explorer->file_table, index, 0, LV_SYMBOL_FILE "  %s", fn);
+        lv_table_set_cell_value(explorer->file_table, index, 1, "4");
+    }
+
+    return true;
+}
+
+static void show_dir_finish(lv_obj_t * obj, const char * path, uint16_t index)
+{
+    lv_file_explorer_t * explorer = (lv_file_explorer_t *)obj;
+
+    lv_table_set_cell_value_fmt(explorer->file_table, 0, 0, LV_SYMBOL_DIRECTORY "  %s", ".");
+    lv_table_set_cell_value_fmt(explorer->file_table, 1, 0, LV_SYMBOL_DIRECTORY "  %s", "..");
+    lv_table_set_cell_value(explorer->file_table, 0, 1, "0");
+    lv_table_set_cell_value(explorer->file_table, 1, 1, "0");
+
     lv_table_set_row_cnt(explorer->file_table, index);
     file_explorer_sort(obj);
     lv_obj_send_event(obj, LV_EVENT_READY, NULL);
@@ -63,6 +63,9 @@ typedef struct {
     const char * sel_fn;
     char   current_path[LV_FILE_EXPLORER_PATH_MAX_LEN];
     lv_file_explorer_sort_t sort;
+#if LV_USE_FS_ASYNC
+    lv_fs_async_req_t * dir_req;
+#endif
 } lv_file_explorer_t;
 
 extern const lv_obj_class_t lv_file_explorer_class;
@@ -114,6 +114,27 @@ LV_ATTRIBUTE_FAST_MEM void * lv_memcpy(void * dst, const void * src, size_t len)
     return dst;
 }
 
+LV_ATTRIBUTE_FAST_MEM void * lv_memmove(void * dst, const void * src, size_t len)
+{
+    uint8_t * d8 = dst;
+    const uint8_t * s8 = src;
+
+    /*`lv_memcpy` copies forward, so it works if the destination is before the source*/
+    if(d8 <= s8 || d8 >= s8 + len) return lv_memcpy(dst, src, len);
+
+    /*Copy backward if the end of the source overlaps with the destination*/
+    d8 += len;
+    s8 += len;
+    while(len) {
+        d8--;
+        s8--;
+        *d8 = *s8;
+        len--;
+    }
+
+    return dst;
+}
+
 LV_ATTRIBUTE_FAST_MEM void lv_memset(void * dst, uint8_t v, size_t len)
 {
     uint8_t * d8 = (uint8_t *)dst;
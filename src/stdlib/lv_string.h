@@ -39,6 +39,16 @@ extern "C" {
  */
 void * lv_memcpy(void * dst, const void * src, size_t len);
 
+/**
+ * @brief Copies a block of memory from a source address to a destination address.
+ *        The source and the destination memory blocks can overlap.
+ * @param dst Pointer to the destination array where the content is to be copied.
+ * @param src Pointer to the source of data to be copied.
+ * @param len Number of bytes to copy.
+ * @return Pointer to the destination array.
+ */
+void * lv_memmove(void * dst, const void * src, size_t len);
+
 /**
  * @brief Fills a block of memory with a specified value.
  * @param dst Pointer to the destination array to fill with the specified value.
@@ -29,11 +29,22 @@
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_END_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
+#define LV_LABEL_BITMAP_MAX_SIZE 2047 /*The largest width and height of an image*/
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_LABEL_BITMAP_CACHE
+/*A draw unit which renders the letters to an A8 buffer*/
+typedef struct {
+    lv_draw_unit_t base_unit;
+    uint8_t * buf;
+    const lv_area_t * buf_area;
+    bool failed;    /*A letter couldn't be rendered to the buffer*/
+} bitmap_render_unit_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -53,6 +64,22 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+static void invalidate_layout(lv_obj_t * obj);
+static void edit_layout(lv_obj_t * obj, uint32_t byte_pos, uint32_t del_len, uint32_t ins_len);
+static void free_bitmap(lv_obj_t * obj);
+#if LV_LABEL_BITMAP_CACHE
+static bool draw_from_bitmap(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
+                             const lv_area_t * txt_coords);
+static bool render_bitmap(lv_obj_t * obj, const lv_draw_label_dsc_t * dsc, const lv_area_t * txt_coords,
+                          const lv_area_t * bitmap_area);
+static void render_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_dsc,
+                             lv_draw_fill_dsc_t * fill_dsc, const lv_area_t * fill_area);
+static void render_coverage(bitmap_render_unit_t * u, const uint8_t * src, const lv_area_t * src_area, lv_opa_t opa);
+#endif
+static const lv_txt_layout_t * get_layout(const lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                          lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag);
+static void get_text_size(lv_obj_t * obj, lv_point_t * size, const lv_font_t * font, lv_coord_t letter_space,
+                          lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag);
 static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, lv_coord_t letter_space, lv_area_t * txt_coords);
 
@@ -95,6 +122,7 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_obj_invalidate(obj);
+    invalidate_layout(obj);
 
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
@@ -138,6 +166,7 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_NULL(fmt);
 
     lv_obj_invalidate(obj);
+    invalidate_layout(obj);
     lv_label_t * label = (lv_label_t *)obj;
 
     /*If text is NULL then refresh*/
@@ -165,6 +194,8 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
+    invalidate_layout(obj);
+
     if(label->static_txt == 0 && label->text != NULL) {
         lv_free(label->text);
         label->text = NULL;
@@ -217,6 +248,23 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     lv_label_refr_text(obj);
 }
 
+void lv_label_set_bitmap_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+#if LV_LABEL_BITMAP_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->bitmap_cache == en) return;
+
+    label->bitmap_cache = en ? 1 : 0;
+    free_bitmap(obj);
+    lv_obj_invalidate(obj);
+#else
+    LV_UNUSED(obj); /*Unused*/
+    LV_UNUSED(en);  /*Unused*/
+#endif
+}
+
 void lv_label_set_text_selection_start(lv_obj_t * obj, uint32_t index)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -271,6 +319,14 @@ bool lv_label_get_recolor(const lv_obj_t * obj)
     return label->recolor ? true : false;
 }
 
+bool lv_label_get_bitmap_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->bitmap_cache ? true : false;
+}
+
 void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t * pos)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -316,13 +372,22 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     lv_coord_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+    const lv_txt_layout_t * layout = get_layout(obj, font, letter_space, line_space, max_w, flag);
+    if(layout) {
+        uint32_t line_idx = lv_txt_layout_get_line_of_byte(layout, byte_id);
+        line_start = layout->lines[line_idx].start;
+        new_line_start = lv_txt_layout_get_line_end(layout, line_idx);
+        y = lv_txt_layout_get_line_y(layout, line_idx);
+    }
+    else {
+        while(txt[new_line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -401,21 +466,39 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
     /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
+    const lv_txt_layout_t * layout = get_layout(obj, font, letter_space, line_space, max_w, flag);
+    if(layout) {
+        uint32_t line_idx = lv_txt_layout_get_line_at_y(layout, pos.y);
+        if(line_idx < layout->line_cnt) {
+            line_start = layout->lines[line_idx].start;
+            new_line_start = lv_txt_layout_get_line_end(layout, line_idx);
             /*Include the NULL terminator in the last line*/
             uint32_t tmp = new_line_start;
-            uint32_t letter;
-            letter = _lv_txt_encoded_prev(txt, &tmp);
+            uint32_t letter = _lv_txt_encoded_prev(txt, &tmp);
             if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
         }
-        y += letter_height + line_space;
+        else {
+            line_start = layout->text_len;
+            new_line_start = layout->text_len;
+        }
+    }
+    else {
+        while(txt[line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                /*Include the NULL terminator in the last line*/
+                uint32_t tmp = new_line_start;
+                uint32_t letter;
+                letter = _lv_txt_encoded_prev(txt, &tmp);
+                if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+                break;
+            }
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     char * bidi_txt;
@@ -501,14 +584,28 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
     /*Search the line of the index letter*/
-    lv_coord_t y = 0;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+    const lv_txt_layout_t * layout = get_layout(obj, font, letter_space, line_space, max_w, flag);
+    if(layout) {
+        uint32_t line_idx = lv_txt_layout_get_line_at_y(layout, pos->y);
+        if(line_idx < layout->line_cnt) {
+            line_start = layout->lines[line_idx].start;
+            new_line_start = lv_txt_layout_get_line_end(layout, line_idx);
+        }
+        else {
+            line_start = layout->text_len;
+            new_line_start = layout->text_len;
+        }
+    }
+    else {
+        lv_coord_t y = 0;
+        while(txt[line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
 
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
-        y += letter_height + line_space;
+            if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     /*Calculate the x coordinate*/
@@ -593,20 +690,38 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
 
     lv_obj_invalidate(obj);
 
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The letters already in the text are shaped, so they don't change the shape of the new letters.
+     *Therefore it's enough to shape only the new text.*/
+    char * txt_ap = lv_malloc(get_text_length(txt));
+    LV_ASSERT_MALLOC(txt_ap);
+    if(txt_ap == NULL) return;
+    _lv_txt_ap_proc(txt, txt_ap);
+    txt = txt_ap;
+#endif
+
     /*Allocate space for the new text*/
     size_t old_len = lv_strlen(label->text);
     size_t ins_len = lv_strlen(txt);
     size_t new_len = ins_len + old_len;
-    label->text        = lv_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
+    char * new_text = lv_realloc(label->text, new_len + 1);
+    LV_ASSERT_MALLOC(new_text);
+    if(new_text != NULL) {
+        label->text = new_text;
 
-    if(pos == LV_LABEL_POS_LAST) {
-        pos = _lv_txt_get_encoded_length(label->text);
+        if(pos == LV_LABEL_POS_LAST) {
+            pos = _lv_txt_get_encoded_length(label->text);
+        }
+
+        uint32_t byte_pos = _lv_txt_encoded_get_byte_id(label->text, pos);
+        _lv_txt_ins(label->text, pos, txt);
+        edit_layout(obj, byte_pos, 0, (uint32_t)ins_len);
+        lv_label_refr_text(obj);
     }
 
-    _lv_txt_ins(label->text, pos, txt);
-    lv_label_set_text(obj, NULL);
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    lv_free(txt_ap);
+#endif
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -620,8 +735,12 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     lv_obj_invalidate(obj);
 
     char * label_txt = lv_label_get_text(obj);
+    uint32_t byte_pos = _lv_txt_encoded_get_byte_id(label_txt, pos);
+    uint32_t byte_cnt = _lv_txt_encoded_get_byte_id(&label_txt[byte_pos], cnt);
+
     /*Delete the characters*/
     _lv_txt_cut(label_txt, pos, cnt);
+    edit_layout(obj, byte_pos, byte_cnt, 0);
 
     /*Refresh the label*/
     lv_label_refr_text(obj);
@@ -641,6 +760,7 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->text       = NULL;
     label->static_txt = 0;
     label->recolor    = 0;
+    label->bitmap_cache = 0;
     label->dot_end    = LV_LABEL_DOT_END_INV;
     label->long_mode  = LV_LABEL_LONG_WRAP;
     label->offset.x = 0;
@@ -652,6 +772,14 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_init(&label->layout);
+#endif
+
+#if LV_LABEL_BITMAP_CACHE
+    lv_memzero(&label->bitmap, sizeof(label->bitmap));
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
@@ -675,6 +803,12 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_free(&label->layout);
+#endif
+
+    free_bitmap(obj);
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -713,10 +847,14 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
             if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
 
             lv_coord_t w = lv_obj_get_content_width(obj);
-            if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
+            if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) {
+                /*The lines are not wrapped, the same as in `lv_label_refr_text`*/
+                w = LV_COORD_MAX;
+                flag |= LV_TEXT_FLAG_FIT;
+            }
             else w = lv_obj_get_content_width(obj);
 
-            lv_txt_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            get_text_size(obj, &label->size_cache, font, letter_space, line_space, w, flag);
             label->invalid_size_cache = false;
         }
 
@@ -771,8 +909,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -784,11 +922,27 @@ static void draw_main(lv_event_t * e)
         return;
     }
 
+#if LV_LABEL_LAYOUT_CACHE
+    /*Usually the lines were already broken when the size of the label was calculated*/
+    lv_txt_layout_update(&label->layout, label->text, label_draw_dsc.font, label_draw_dsc.letter_space,
+                         label_draw_dsc.line_space, lv_area_get_width(&txt_coords), flag);
+#if LV_USE_BIDI
+    /*Keep the lines in visual order too to not run the bidi algorithm on every redraw*/
+    _lv_bidi_process_layout(&label->layout, label_draw_dsc.bidi_dir);
+#endif
+    label_draw_dsc.layout = &label->layout;
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_WRAP) {
         lv_coord_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
         txt_coords.y2 = obj->coords.y2;
     }
+
+#if LV_LABEL_BITMAP_CACHE
+    if(draw_from_bitmap(obj, layer, &label_draw_dsc, &txt_coords)) return;
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         const lv_area_t clip_area_ori = layer->clip_area;
         layer->clip_area = txt_clip;
@@ -804,8 +958,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -865,6 +1019,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
     label->invalid_size_cache = true;
+    free_bitmap(obj); /*The text, the style or the size has changed*/
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
@@ -880,7 +1035,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_text_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1132,6 +1287,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+                invalidate_layout(obj);
             }
         }
     }
@@ -1165,6 +1321,7 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+    invalidate_layout(obj);
 }
 
 /**
@@ -1276,6 +1433,253 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/**
+ * Drop the line breaks of the label. Should be called if the text changes.
+ */
+static void invalidate_layout(lv_obj_t * obj)
+{
+#if LV_LABEL_LAYOUT_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    lv_txt_layout_invalidate(&label->layout);
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+/**
+ * Update the line breaks after a part of the text was replaced.
+ * Only the lines of the edited paragraph are broken again.
+ */
+static void edit_layout(lv_obj_t * obj, uint32_t byte_pos, uint32_t del_len, uint32_t ins_len)
+{
+#if LV_LABEL_LAYOUT_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    lv_txt_layout_edit(&label->layout, label->text, byte_pos, del_len, ins_len);
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(byte_pos);
+    LV_UNUSED(del_len);
+    LV_UNUSED(ins_len);
+#endif
+}
+
+/**
+ * Free the bitmap the text was rendered to. It will be rendered again when the label is drawn.
+ */
+static void free_bitmap(lv_obj_t * obj)
+{
+#if LV_LABEL_BITMAP_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->bitmap.data == NULL) return;
+
+    lv_img_cache_invalidate_src(&label->bitmap);
+    lv_free((void *)label->bitmap.data);
+    label->bitmap.data = NULL;
+    label->bitmap.data_size = 0;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+#if LV_LABEL_BITMAP_CACHE
+/**
+ * Draw the text by blending the bitmap it was rendered to with the text color.
+ * Render the bitmap first if it's missing or the text has moved in the label.
+ * @return false: the text can't be drawn from a bitmap, draw it normally
+ */
+static bool draw_from_bitmap(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
+                             const lv_area_t * txt_coords)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(!label->bitmap_cache) return false;
+
+    /*The colors of the recolor commands and the selection would be lost in an A8 bitmap.
+     *In the scrolling modes the text moves in every frame.*/
+    if(label->recolor) return false;
+    if(label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) return false;
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) return false;
+
+    /*Italic letters might be drawn on the extra draw area too*/
+    lv_area_t bitmap_area = obj->coords;
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&bitmap_area, ext_size, ext_size);
+
+    lv_coord_t w = lv_area_get_width(&bitmap_area);
+    lv_coord_t h = lv_area_get_height(&bitmap_area);
+    if(w > LV_LABEL_BITMAP_MAX_SIZE || h > LV_LABEL_BITMAP_MAX_SIZE) return false;
+
+    lv_point_t txt_ofs;
+    txt_ofs.x = txt_coords->x1 - bitmap_area.x1;
+    txt_ofs.y = txt_coords->y1 - bitmap_area.y1;
+
+    /*The color and the opacity are applied when the bitmap is drawn. Changing the other text styles
+     *refreshes the text which frees the bitmap, but changing the decoration doesn't.*/
+    if(label->bitmap.data == NULL || label->bitmap.header.w != w || label->bitmap.header.h != h ||
+       label->bitmap_txt_ofs.x != txt_ofs.x || label->bitmap_txt_ofs.y != txt_ofs.y ||
+       label->bitmap_decor != dsc->decor) {
+        if(!render_bitmap(obj, dsc, txt_coords, &bitmap_area)) {
+            LV_LOG_WARN("Couldn't render the text to a bitmap, drawing it normally");
+            label->bitmap_cache = 0;
+            return false;
+        }
+        label->bitmap_txt_ofs = txt_ofs;
+        label->bitmap_decor = dsc->decor;
+    }
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    img_dsc.src = &label->bitmap;
+    img_dsc.opa = dsc->opa;
+    img_dsc.blend_mode = dsc->blend_mode;
+    img_dsc.recolor = dsc->color;
+    img_dsc.recolor_opa = LV_OPA_COVER;
+    lv_draw_img(layer, &img_dsc, &bitmap_area);
+
+    return true;
+}
+
+/**
+ * Render the coverage of the letters to `label->bitmap`
+ * @return false: out of memory or a letter is not an A8 bitmap
+ */
+static bool render_bitmap(lv_obj_t * obj, const lv_draw_label_dsc_t * dsc, const lv_area_t * txt_coords,
+                          const lv_area_t * bitmap_area)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    free_bitmap(obj);
+
+    uint32_t size = lv_area_get_size(bitmap_area);
+    uint8_t * buf = lv_malloc(size);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return false;
+    lv_memzero(buf, size);
+
+    bitmap_render_unit_t u;
+    lv_memzero(&u, sizeof(u));
+    u.base_unit.clip_area = bitmap_area;
+    u.buf = buf;
+    u.buf_area = bitmap_area;
+
+    /*The opacity and the color are applied when the bitmap is drawn*/
+    lv_draw_label_dsc_t render_dsc = *dsc;
+    render_dsc.opa = LV_OPA_COVER;
+    lv_draw_label_interate_letters(&u.base_unit, &render_dsc, txt_coords, render_letter_cb);
+
+    if(u.failed) {
+        lv_free(buf);
+        return false;
+    }
+
+    lv_memzero(&label->bitmap.header, sizeof(label->bitmap.header));
+    label->bitmap.header.cf = LV_COLOR_FORMAT_A8;
+    label->bitmap.header.w = lv_area_get_width(bitmap_area);
+    label->bitmap.header.h = lv_area_get_height(bitmap_area);
+    label->bitmap.data_size = size;
+    label->bitmap.data = buf;
+
+    return true;
+}
+
+static void render_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_dsc,
+                             lv_draw_fill_dsc_t * fill_dsc, const lv_area_t * fill_area)
+{
+    bitmap_render_unit_t * u = (bitmap_render_unit_t *)draw_unit;
+
+    if(glyph_dsc) {
+        if(glyph_dsc->bitmap == NULL) {
+#if LV_USE_FONT_PLACEHOLDER
+            /*The 1 px wide border of the placeholder rectangle*/
+            const lv_area_t * bg = glyph_dsc->bg_coords;
+            lv_area_t side;
+            lv_area_set(&side, bg->x1, bg->y1, bg->x2, bg->y1);
+            render_coverage(u, NULL, &side, glyph_dsc->opa);
+            lv_area_set(&side, bg->x1, bg->y2, bg->x2, bg->y2);
+            render_coverage(u, NULL, &side, glyph_dsc->opa);
+            lv_area_set(&side, bg->x1, bg->y1 + 1, bg->x1, bg->y2 - 1);
+            render_coverage(u, NULL, &side, glyph_dsc->opa);
+            lv_area_set(&side, bg->x2, bg->y1 + 1, bg->x2, bg->y2 - 1);
+            render_coverage(u, NULL, &side, glyph_dsc->opa);
+#endif
+        }
+        else if(glyph_dsc->format == LV_DRAW_LETTER_BITMAP_FORMAT_A8) {
+            render_coverage(u, glyph_dsc->bitmap, glyph_dsc->letter_coords, glyph_dsc->opa);
+        }
+        else {
+            u->failed = true;
+        }
+    }
+
+    if(fill_dsc && fill_area) {
+        render_coverage(u, NULL, fill_area, fill_dsc->opa);
+    }
+}
+
+/**
+ * Add the coverage of an A8 bitmap (or a solid area if `src == NULL`) to the buffer
+ * the same way as the letters would be blended one after the other.
+ */
+static void render_coverage(bitmap_render_unit_t * u, const uint8_t * src, const lv_area_t * src_area, lv_opa_t opa)
+{
+    lv_area_t area;
+    if(!_lv_area_intersect(&area, src_area, u->buf_area)) return;
+
+    lv_coord_t buf_w = lv_area_get_width(u->buf_area);
+    lv_coord_t src_w = lv_area_get_width(src_area);
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area.y1; y <= area.y2; y++) {
+        uint8_t * dest = &u->buf[(y - u->buf_area->y1) * buf_w];
+        const uint8_t * src_row = src ? &src[(y - src_area->y1) * src_w] : NULL;
+        for(x = area.x1; x <= area.x2; x++) {
+            uint32_t cov = src_row ? src_row[x - src_area->x1] : LV_OPA_COVER;
+            if(opa < LV_OPA_MAX) cov = LV_UDIV255(cov * opa);
+
+            uint32_t d = dest[x - u->buf_area->x1];
+            dest[x - u->buf_area->x1] = (uint8_t)(d + cov - LV_UDIV255(d * cov));
+        }
+    }
+}
+#endif /*LV_LABEL_BITMAP_CACHE*/
+
+/**
+ * Get the size of the label's text. With `LV_LABEL_LAYOUT_CACHE` the line breaks are stored,
+ * so the lines are broken again only if the text or the parameters have changed.
+ */
+static void get_text_size(lv_obj_t * obj, lv_point_t * size, const lv_font_t * font, lv_coord_t letter_space,
+                          lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_update(&label->layout, label->text, font, letter_space, line_space, max_w, flag);
+    *size = label->layout.size;
+#else
+    lv_txt_get_size(size, label->text, font, letter_space, line_space, max_w, flag);
+#endif
+}
+
+/**
+ * Get the stored lines of the label. The lines are broken only if the text or the parameters have changed.
+ * @return the lines of the label's text or NULL if they are not stored (`LV_LABEL_LAYOUT_CACHE` is disabled)
+ */
+static const lv_txt_layout_t * get_layout(const lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                          lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+#if LV_LABEL_LAYOUT_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    lv_txt_layout_update(&label->layout, label->text, font, letter_space, line_space, max_w, flag);
+    if(!lv_txt_layout_is_valid(&label->layout, label->text, font, letter_space, line_space, max_w, flag)) return NULL;
+    return &label->layout;
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(font);
+    LV_UNUSED(letter_space);
+    LV_UNUSED(line_space);
+    LV_UNUSED(max_w);
+    LV_UNUSED(flag);
+    return NULL;
+#endif
+}
+
 /* Function created because of this pattern be used in multiple functions */
 static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, lv_coord_t letter_space, lv_area_t * txt_coords)
@@ -70,11 +70,21 @@ typedef struct {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_t layout; /*Line breaks of the text*/
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
 #endif
 
+#if LV_LABEL_BITMAP_CACHE
+    lv_img_dsc_t bitmap;        /*The text rendered to an A8 image. `bitmap.data == NULL` means invalid.*/
+    lv_point_t bitmap_txt_ofs;  /*Position of the text in `bitmap` when it was rendered*/
+    lv_text_decor_t bitmap_decor; /*Underline and strikethrough are rendered too*/
+#endif
+
     lv_point_t size_cache; /*Text size cache*/
     lv_point_t offset; /*Text draw position offset*/
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
@@ -83,6 +93,7 @@ typedef struct {
     uint8_t expand : 1;                 /*Ignore real width (used by the library with LV_LABEL_LONG_SCROLL)*/
     uint8_t dot_tmp_alloc : 1;          /*1: dot is allocated, 0: dot directly holds up to 4 chars*/
     uint8_t invalid_size_cache : 1;     /*1: Recalculate size and update cache*/
+    uint8_t bitmap_cache : 1;           /*1: Render the text to `bitmap` once and draw the bitmap*/
 } lv_label_t;
 
 extern const lv_obj_class_t lv_label_class;
@@ -155,6 +166,17 @@ void lv_label_set_text_selection_start(lv_obj_t * obj, uint32_t index);
  */
 void lv_label_set_text_selection_end(lv_obj_t * obj, uint32_t index);
 
+/**
+ * Render the text only once to an A8 bitmap and draw the text by blending the bitmap with the text color.
+ * The bitmap is rendered again only if the text, the style or the size of the label changes.
+ * Useful for static texts which are redrawn often. Needs `LV_LABEL_BITMAP_CACHE` and
+ * as many bytes of RAM as pixels the label has.
+ * In the scrolling long modes and while text is selected the text is drawn normally.
+ * @param obj       pointer to a label object
+ * @param en        true: enable the bitmap cache, false: disable and free the bitmap
+ */
+void lv_label_set_bitmap_cache(lv_obj_t * obj, bool en);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -180,6 +202,13 @@ lv_label_long_mode_t lv_label_get_long_mode(const lv_obj_t * obj);
  */
 bool lv_label_get_recolor(const lv_obj_t * obj);
 
+/**
+ * Get whether the text is drawn from a bitmap rendered once
+ * @param obj       pointer to a label object
+ * @return          true: the bitmap cache is enabled
+ */
+bool lv_label_get_bitmap_cache(const lv_obj_t * obj);
+
 /**
  * Get the relative x and y coordinates of a letter
  * @param obj       pointer to a label object
@@ -43,11 +43,17 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE   4096
+#define LV_USE_FONT_GLYPH_ID_LOOKUP 1
+#define LV_USE_FONT_KERN_LOOKUP 1
+#define LV_USE_FONT_SDF         1
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
 #define LV_LABEL_TEXT_SELECTION     1
+#define LV_LABEL_LAYOUT_CACHE       1
+#define LV_LABEL_BITMAP_CACHE       1
 
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
@@ -57,11 +63,27 @@
 #define LV_FS_STDIO_CACHE_SIZE 512
 #define LV_USE_FS_POSIX     1
 #define LV_FS_POSIX_LETTER  'B'
+#define LV_USE_FS_ARCHIVE   1
+#define LV_FS_ARCHIVE_LETTER 'C'
+#define LV_FS_BLOCK_CACHE_SIZE          2048
+#define LV_FS_BLOCK_CACHE_BLOCK_SIZE    128
+#ifdef LV_USE_OS
+#define LV_USE_FS_ASYNC     1
+#endif
+
+#define LV_OBJ_STYLE_CACHE_SIZE     32
 
 #define LV_USE_PNG          1
+#define LV_PNG_USE_STREAM   1
 #define LV_USE_BMP          1
 #define LV_USE_SJPG         1
+#ifdef LV_USE_OS
+#define LV_SJPG_THREAD_CNT  2
+#endif
 #define LV_USE_GIF          1
+#ifdef LV_USE_OS
+#define LV_GIF_USE_THREAD   1
+#endif
 #define LV_USE_QRCODE       1
 #define LV_USE_BARCODE      1
 #define LV_USE_FRAGMENT     1
@@ -70,6 +92,7 @@
 #define LV_USE_MSG              1
 #define LV_USE_FILE_EXPLORER    1
 #define LV_USE_TINY_TTF         1
+#define LV_TINY_TTF_ATLAS       1
 #define LV_USE_SYSMON           1
 #define LV_USE_SNAPSHOT         1
 
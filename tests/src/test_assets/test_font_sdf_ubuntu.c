@@ -0,0 +1,427 @@
+/*******************************************************************************
+ * Size: 32 px
+ * Spread: 4 px
+ * Opts: --size 32 --spread 4 -r 0x20,0x38,0x41,0x42,0x57,0x61,0x65,0x67,0x6F,0xC1 --font ubuntu_font.ttf --name test_font_sdf_ubuntu
+ ******************************************************************************/
+
+#include "../../../lvgl.h"
+
+#if LV_USE_FONT_SDF
+
+/*Distance fields of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_sdf[] = {
+    /* U+0038 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x12, 0x17,
+    0x1a, 0x1a, 0x17, 0x13, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x1c, 0x28, 0x31, 0x37, 0x39, 0x39, 0x37, 0x32, 0x2a, 0x1f, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x28, 0x38, 0x46, 0x50, 0x56, 0x59, 0x59, 0x56, 0x51,
+    0x48, 0x3b, 0x2c, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x41, 0x54, 0x63,
+    0x6e, 0x75, 0x79, 0x79, 0x76, 0x70, 0x65, 0x57, 0x45, 0x31, 0x1b, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x29, 0x42, 0x59, 0x6e, 0x7f, 0x8c, 0x95, 0x99, 0x98, 0x95, 0x8e, 0x82, 0x72, 0x5e, 0x47,
+    0x2e, 0x14, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x3a, 0x55, 0x6f, 0x86, 0x9a, 0xaa, 0xb4, 0xb0, 0xb0,
+    0xb5, 0xac, 0x9e, 0x8b, 0x74, 0x5b, 0x3f, 0x23, 0x05, 0x00, 0x00, 0x0b, 0x2a, 0x47, 0x64, 0x81,
+    0x9b, 0xb3, 0xa8, 0x98, 0x90, 0x90, 0x98, 0xa8, 0xb8, 0xa0, 0x86, 0x6a, 0x4c, 0x2e, 0x10, 0x00,
+    0x00, 0x14, 0x32, 0x51, 0x70, 0x8e, 0xab, 0xaa, 0x90, 0x7c, 0x71, 0x71, 0x7c, 0x90, 0xab, 0xb0,
+    0x92, 0x74, 0x54, 0x35, 0x16, 0x00, 0x00, 0x19, 0x38, 0x58, 0x77, 0x96, 0xb5, 0x9f, 0x81, 0x64,
+    0x52, 0x52, 0x64, 0x81, 0xa0, 0xb7, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1b, 0x3a, 0x5a,
+    0x7a, 0x9a, 0xb9, 0x9d, 0x7e, 0x5e, 0x3f, 0x40, 0x5f, 0x7e, 0x9e, 0xb7, 0x97, 0x78, 0x58, 0x39,
+    0x19, 0x00, 0x00, 0x19, 0x38, 0x58, 0x77, 0x96, 0xb5, 0xa3, 0x86, 0x6b, 0x57, 0x4c, 0x68, 0x85,
+    0xa4, 0xae, 0x90, 0x72, 0x53, 0x34, 0x15, 0x00, 0x00, 0x13, 0x32, 0x51, 0x6f, 0x8c, 0xa9, 0xb1,
+    0x98, 0x84, 0x73, 0x65, 0x79, 0x93, 0xaf, 0xa0, 0x84, 0x67, 0x4a, 0x2c, 0x0d, 0x00, 0x00, 0x0a,
+    0x28, 0x45, 0x62, 0x7c, 0x95, 0xaa, 0xb0, 0x9e, 0x8f, 0x82, 0x8e, 0xa5, 0xa2, 0x8c, 0x74, 0x59,
+    0x3d, 0x20, 0x03, 0x00, 0x00, 0x00, 0x1b, 0x36, 0x50, 0x68, 0x7d, 0x90, 0xad, 0xb6, 0xac, 0x9f,
+    0xa7, 0xa1, 0x88, 0x75, 0x60, 0x47, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x07, 0x22, 0x3d, 0x57, 0x6e,
+    0x84, 0x97, 0xaa, 0x97, 0x9c, 0xa9, 0xb6, 0xa6, 0x92, 0x80, 0x6c, 0x56, 0x3d, 0x23, 0x07, 0x00,
+    0x00, 0x14, 0x31, 0x4e, 0x69, 0x83, 0x9b, 0xae, 0x94, 0x7d, 0x7f, 0x8c, 0x9a, 0xaa, 0xad, 0x99,
+    0x82, 0x69, 0x4e, 0x32, 0x15, 0x00, 0x00, 0x1e, 0x3d, 0x5b, 0x78, 0x95, 0xb0, 0x9d, 0x82, 0x68,
+    0x62, 0x6f, 0x7e, 0x90, 0xa6, 0xaf, 0x95, 0x79, 0x5c, 0x3e, 0x20, 0x01, 0x06, 0x26, 0x45, 0x64,
+    0x83, 0xa1, 0xb0, 0x92, 0x73, 0x56, 0x45, 0x53, 0x63, 0x79, 0x95, 0xb3, 0xa3, 0x84, 0x65, 0x46,
+    0x27, 0x08, 0x09, 0x29, 0x49, 0x69, 0x88, 0xa8, 0xac, 0x8d, 0x6d, 0x4d, 0x2e, 0x37, 0x4e, 0x6d,
+    0x8d, 0xad, 0xa9, 0x8a, 0x6a, 0x4a, 0x2a, 0x0b, 0x0a, 0x29, 0x49, 0x69, 0x88, 0xa8, 0xb0, 0x91,
+    0x73, 0x5a, 0x4d, 0x4d, 0x59, 0x72, 0x90, 0xaf, 0xa8, 0x89, 0x69, 0x4a, 0x2a, 0x0a, 0x07, 0x26,
+    0x45, 0x64, 0x83, 0xa1, 0xba, 0x9e, 0x86, 0x75, 0x6c, 0x6c, 0x74, 0x86, 0x9e, 0xb9, 0xa0, 0x82,
+    0x63, 0x44, 0x25, 0x06, 0x00, 0x1f, 0x3d, 0x5b, 0x77, 0x93, 0xac, 0xb3, 0xa0, 0x93, 0x8c, 0x8c,
+    0x92, 0x9f, 0xb3, 0xaa, 0x91, 0x76, 0x59, 0x3b, 0x1d, 0x00, 0x00, 0x14, 0x31, 0x4c, 0x67, 0x80,
+    0x95, 0xa6, 0xb2, 0xb1, 0xab, 0xab, 0xb1, 0xb1, 0xa4, 0x92, 0x7d, 0x65, 0x4a, 0x2f, 0x12, 0x00,
+    0x00, 0x06, 0x21, 0x3b, 0x53, 0x68, 0x7b, 0x89, 0x94, 0x9a, 0x9d, 0x9d, 0x9a, 0x93, 0x87, 0x78,
+    0x66, 0x50, 0x38, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x26, 0x3c, 0x4f, 0x5f, 0x6c, 0x75, 0x7b,
+    0x7d, 0x7d, 0x7a, 0x74, 0x6a, 0x5d, 0x4c, 0x39, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x23, 0x34, 0x42, 0x4e, 0x56, 0x5b, 0x5d, 0x5d, 0x5b, 0x55, 0x4c, 0x40, 0x31, 0x20, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x25, 0x2f, 0x37, 0x3b, 0x3e, 0x3d, 0x3b, 0x36,
+    0x2e, 0x23, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11,
+    0x18, 0x1c, 0x1e, 0x1e, 0x1c, 0x17, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* U+0041 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+    0x1f, 0x29, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x3a, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x3c,
+    0x26, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30,
+    0x4e, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x51, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x76, 0x8a, 0x8a, 0x8a, 0x8a, 0x7a, 0x5c,
+    0x3e, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x25, 0x43,
+    0x61, 0x80, 0x9e, 0xaa, 0xaa, 0xa2, 0x84, 0x66, 0x47, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4c, 0x6b, 0x89, 0xa7, 0xb3, 0xb3, 0xac, 0x8d, 0x6f,
+    0x51, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x37, 0x56,
+    0x74, 0x92, 0xb1, 0x96, 0x98, 0xb3, 0x97, 0x78, 0x5a, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x40, 0x5f, 0x7d, 0x9c, 0xa9, 0x8a, 0x8c, 0xab, 0xa0, 0x82,
+    0x63, 0x45, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x4a, 0x68,
+    0x86, 0xa5, 0xa0, 0x82, 0x84, 0xa2, 0xa9, 0x8b, 0x6d, 0x4e, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x34, 0x53, 0x71, 0x90, 0xae, 0x98, 0x79, 0x7b, 0x9a, 0xb2, 0x94,
+    0x76, 0x57, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3e, 0x5c, 0x7a,
+    0x99, 0xaf, 0x90, 0x71, 0x73, 0x92, 0xb1, 0x9d, 0x7f, 0x60, 0x42, 0x23, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x28, 0x47, 0x65, 0x84, 0xa2, 0xa7, 0x89, 0x6a, 0x6c, 0x8b, 0xaa, 0xa6,
+    0x87, 0x69, 0x4a, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x50, 0x6e, 0x8d,
+    0xab, 0xa1, 0x81, 0x62, 0x65, 0x84, 0xa3, 0xaf, 0x90, 0x72, 0x53, 0x34, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x3a, 0x59, 0x77, 0x96, 0xb4, 0x9a, 0x7b, 0x5c, 0x5e, 0x7e, 0x9d, 0xb7,
+    0x99, 0x7a, 0x5c, 0x3d, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x43, 0x61, 0x80, 0x9e,
+    0xb3, 0x94, 0x75, 0x6b, 0x6b, 0x78, 0x97, 0xb6, 0xa1, 0x83, 0x64, 0x45, 0x27, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x6a, 0x88, 0xa7, 0xb1, 0x94, 0x8b, 0x8b, 0x8b, 0x8b, 0x96, 0xb4,
+    0xaa, 0x8b, 0x6c, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x16, 0x35, 0x54, 0x72, 0x91, 0xaf,
+    0xc0, 0xae, 0xab, 0xab, 0xab, 0xab, 0xaf, 0xc3, 0xb2, 0x93, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7b, 0x99, 0xb8, 0xa6, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xaa,
+    0xba, 0x9b, 0x7c, 0x5d, 0x3f, 0x20, 0x01, 0x00, 0x00, 0x08, 0x26, 0x45, 0x64, 0x83, 0xa1, 0xb7,
+    0x98, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x9d, 0xbc, 0xa3, 0x84, 0x65, 0x46, 0x28, 0x09, 0x00,
+    0x00, 0x0f, 0x2e, 0x4d, 0x6c, 0x8b, 0xa9, 0xb1, 0x92, 0x73, 0x5e, 0x5e, 0x5e, 0x5e, 0x77, 0x96,
+    0xb6, 0xab, 0x8c, 0x6d, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x17, 0x36, 0x55, 0x74, 0x92, 0xb1, 0xab,
+    0x8c, 0x6c, 0x4d, 0x3e, 0x3e, 0x52, 0x71, 0x90, 0xaf, 0xb2, 0x93, 0x74, 0x55, 0x37, 0x18, 0x00,
+    0x00, 0x1f, 0x3e, 0x5c, 0x7b, 0x9a, 0xb0, 0xa5, 0x86, 0x66, 0x47, 0x28, 0x2c, 0x4c, 0x6b, 0x8a,
+    0xa9, 0xb0, 0x9b, 0x7c, 0x5d, 0x3e, 0x1f, 0x00, 0x07, 0x26, 0x45, 0x64, 0x83, 0x90, 0x90, 0x90,
+    0x7f, 0x60, 0x41, 0x22, 0x26, 0x45, 0x64, 0x84, 0x90, 0x90, 0x90, 0x83, 0x64, 0x45, 0x26, 0x07,
+    0x07, 0x26, 0x45, 0x62, 0x70, 0x70, 0x70, 0x70, 0x70, 0x59, 0x3b, 0x1c, 0x20, 0x3f, 0x5d, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x62, 0x45, 0x26, 0x07, 0x00, 0x1b, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x50,
+    0x50, 0x45, 0x2e, 0x12, 0x16, 0x31, 0x47, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1b, 0x00,
+    0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x18, 0x01, 0x04, 0x1b, 0x2b, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00,
+    /* U+0042 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x0c, 0x0f, 0x11,
+    0x12, 0x12, 0x10, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x1b, 0x22, 0x27, 0x2b, 0x2e, 0x31, 0x32, 0x31, 0x30, 0x2c, 0x26, 0x1e, 0x12, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x37, 0x42, 0x47, 0x4b, 0x4e, 0x50, 0x51, 0x51,
+    0x4f, 0x4b, 0x45, 0x3b, 0x2f, 0x20, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x4f,
+    0x61, 0x66, 0x6a, 0x6e, 0x70, 0x71, 0x71, 0x6f, 0x6b, 0x64, 0x59, 0x4c, 0x3b, 0x27, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x85, 0x8a, 0x8d, 0x90, 0x91, 0x91, 0x8e, 0x8a,
+    0x82, 0x76, 0x67, 0x54, 0x3e, 0x25, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99,
+    0xa9, 0xad, 0xaf, 0xb1, 0xb0, 0xae, 0xa9, 0xa0, 0x93, 0x81, 0x6b, 0x52, 0x37, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xb1, 0xa1, 0x9d, 0x9c, 0x9e, 0xa6, 0xb5, 0xad,
+    0x97, 0x7e, 0x61, 0x44, 0x26, 0x08, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5,
+    0x85, 0x7e, 0x7d, 0x7f, 0x89, 0x9e, 0xb8, 0xa8, 0x8a, 0x6c, 0x4d, 0x2e, 0x0f, 0x00, 0x00, 0x00,
+    0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x65, 0x5d, 0x60, 0x71, 0x8e, 0xac, 0xb0, 0x91,
+    0x72, 0x52, 0x32, 0x13, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x65,
+    0x46, 0x49, 0x69, 0x88, 0xa8, 0xb2, 0x92, 0x72, 0x53, 0x33, 0x13, 0x00, 0x00, 0x00, 0x1a, 0x39,
+    0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x65, 0x4f, 0x57, 0x6f, 0x8c, 0xab, 0xaa, 0x8c, 0x6e, 0x4f,
+    0x30, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x6e, 0x6e, 0x74,
+    0x83, 0x9a, 0xb2, 0x9b, 0x80, 0x63, 0x46, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79,
+    0x99, 0xb8, 0xa7, 0x8f, 0x8e, 0x8e, 0x92, 0x9e, 0xac, 0x99, 0x85, 0x6e, 0x54, 0x39, 0x1d, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xbb, 0xae, 0xae, 0xae, 0xb1, 0xba, 0xa2,
+    0x83, 0x77, 0x67, 0x54, 0x3d, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8,
+    0xad, 0x9b, 0x9a, 0x9a, 0x9b, 0xa1, 0xac, 0xa1, 0x93, 0x80, 0x6a, 0x50, 0x35, 0x18, 0x00, 0x00,
+    0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x7b, 0x7b, 0x7c, 0x83, 0x91, 0xa6, 0xad,
+    0x97, 0x7c, 0x5f, 0x42, 0x24, 0x06, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85,
+    0x65, 0x5b, 0x5c, 0x65, 0x7a, 0x95, 0xb3, 0xa6, 0x88, 0x6a, 0x4b, 0x2c, 0x0d, 0x00, 0x00, 0x1a,
+    0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x65, 0x46, 0x3d, 0x4e, 0x6d, 0x8d, 0xac, 0xaf, 0x8f,
+    0x70, 0x50, 0x30, 0x11, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x65, 0x46,
+    0x39, 0x4e, 0x6d, 0x8c, 0xac, 0xaf, 0x90, 0x70, 0x50, 0x30, 0x11, 0x00, 0x00, 0x1a, 0x39, 0x59,
+    0x79, 0x99, 0xb8, 0xa5, 0x85, 0x65, 0x56, 0x58, 0x62, 0x79, 0x94, 0xb2, 0xab, 0x8c, 0x6d, 0x4d,
+    0x2e, 0x0e, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xb8, 0xa5, 0x85, 0x77, 0x75, 0x77, 0x7f,
+    0x8e, 0xa5, 0xbc, 0xa1, 0x84, 0x65, 0x47, 0x28, 0x09, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99,
+    0xb8, 0xad, 0x9a, 0x96, 0x95, 0x97, 0x9d, 0xa9, 0xbb, 0xa8, 0x90, 0x76, 0x5a, 0x3d, 0x1f, 0x01,
+    0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x99, 0xaf, 0xb3, 0xb6, 0xb6, 0xb5, 0xb6, 0xb2, 0xab, 0xa0,
+    0x90, 0x7b, 0x64, 0x4a, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x59, 0x79, 0x8a, 0x8f, 0x93,
+    0x96, 0x98, 0x98, 0x96, 0x93, 0x8c, 0x83, 0x75, 0x63, 0x4e, 0x37, 0x1e, 0x03, 0x00, 0x00, 0x00,
+    0x16, 0x35, 0x51, 0x65, 0x6b, 0x70, 0x74, 0x76, 0x78, 0x78, 0x77, 0x73, 0x6e, 0x65, 0x59, 0x49,
+    0x37, 0x22, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x3a, 0x46, 0x4c, 0x50, 0x54, 0x57, 0x58,
+    0x58, 0x57, 0x54, 0x4e, 0x47, 0x3c, 0x2e, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x1e, 0x27, 0x2c, 0x31, 0x34, 0x37, 0x38, 0x39, 0x37, 0x34, 0x2f, 0x28, 0x1e, 0x12, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x0d, 0x11, 0x15, 0x17, 0x19, 0x19, 0x18,
+    0x15, 0x10, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    /* U+0057 */
+    0x00, 0x00, 0x00, 0x04, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x2a, 0x2b, 0x2b, 0x2b,
+    0x2a, 0x23, 0x13, 0x00, 0x00, 0x13, 0x23, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x22, 0x11, 0x00, 0x00,
+    0x00, 0x0c, 0x27, 0x3d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x40, 0x2a, 0x0f, 0x0f, 0x2a, 0x40, 0x4a,
+    0x4a, 0x4a, 0x4a, 0x4a, 0x3d, 0x27, 0x0c, 0x00, 0x00, 0x17, 0x36, 0x53, 0x69, 0x6a, 0x6a, 0x6a,
+    0x6a, 0x56, 0x39, 0x1b, 0x1b, 0x39, 0x56, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x53, 0x36, 0x17, 0x00,
+    0x00, 0x19, 0x39, 0x59, 0x78, 0x8a, 0x8a, 0x8a, 0x7c, 0x5c, 0x3d, 0x1d, 0x1d, 0x3d, 0x5d, 0x7c,
+    0x8a, 0x8a, 0x8a, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x18, 0x38, 0x58, 0x77, 0x97, 0xaa, 0x9b,
+    0x7c, 0x5c, 0x3c, 0x1c, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0xaa, 0x97, 0x77, 0x57, 0x37, 0x18, 0x00,
+    0x00, 0x17, 0x37, 0x57, 0x76, 0x96, 0xb6, 0x9b, 0x7b, 0x5b, 0x3c, 0x1c, 0x1d, 0x3c, 0x5c, 0x7c,
+    0x9c, 0xb5, 0x95, 0x76, 0x56, 0x36, 0x16, 0x00, 0x00, 0x16, 0x36, 0x56, 0x75, 0x95, 0xb5, 0x9a,
+    0x7b, 0x5b, 0x3b, 0x1b, 0x1c, 0x3c, 0x5c, 0x7c, 0x9b, 0xb4, 0x94, 0x74, 0x55, 0x35, 0x15, 0x00,
+    0x00, 0x15, 0x35, 0x54, 0x74, 0x94, 0xb4, 0x9a, 0x7a, 0x5a, 0x3b, 0x2a, 0x2a, 0x3c, 0x5b, 0x7b,
+    0x9b, 0xb3, 0x93, 0x73, 0x54, 0x34, 0x14, 0x00, 0x00, 0x14, 0x34, 0x53, 0x73, 0x93, 0xb2, 0x99,
+    0x7a, 0x5a, 0x4a, 0x4a, 0x4a, 0x4a, 0x5b, 0x7b, 0x9a, 0xb2, 0x92, 0x72, 0x52, 0x33, 0x13, 0x00,
+    0x00, 0x13, 0x32, 0x52, 0x72, 0x91, 0xb1, 0x99, 0x79, 0x59, 0x6a, 0x6a, 0x6a, 0x6a, 0x5a, 0x7a,
+    0x9a, 0xb0, 0x91, 0x71, 0x51, 0x31, 0x12, 0x00, 0x00, 0x11, 0x31, 0x51, 0x70, 0x90, 0xb0, 0x98,
+    0x79, 0x61, 0x80, 0x8a, 0x8a, 0x81, 0x62, 0x7a, 0x99, 0xaf, 0x8f, 0x6f, 0x50, 0x30, 0x10, 0x00,
+    0x00, 0x10, 0x2f, 0x4f, 0x6f, 0x8f, 0xae, 0x98, 0x78, 0x6a, 0x88, 0xa7, 0xa8, 0x89, 0x6b, 0x79,
+    0x99, 0xae, 0x8e, 0x6e, 0x4e, 0x2f, 0x0f, 0x00, 0x00, 0x0e, 0x2e, 0x4e, 0x6d, 0x8d, 0xad, 0x97,
+    0x78, 0x73, 0x91, 0xb0, 0xb0, 0x92, 0x73, 0x79, 0x98, 0xac, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00,
+    0x00, 0x0c, 0x2c, 0x4c, 0x6b, 0x8b, 0xab, 0x97, 0x77, 0x7c, 0x9a, 0x9d, 0x9b, 0x9a, 0x7c, 0x78,
+    0x98, 0xaa, 0x8b, 0x6b, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x0a, 0x2a, 0x4a, 0x6a, 0x89, 0xa9, 0x96,
+    0x76, 0x84, 0xa3, 0x8e, 0x8a, 0xa3, 0x84, 0x78, 0x97, 0xa9, 0x89, 0x69, 0x4a, 0x2a, 0x0a, 0x00,
+    0x00, 0x09, 0x28, 0x48, 0x68, 0x87, 0xa7, 0x96, 0x76, 0x8d, 0xa2, 0x84, 0x81, 0x9f, 0x8d, 0x77,
+    0x97, 0xa7, 0x87, 0x68, 0x48, 0x28, 0x08, 0x00, 0x00, 0x06, 0x26, 0x46, 0x65, 0x85, 0xa5, 0x95,
+    0x78, 0x96, 0x98, 0x7a, 0x77, 0x95, 0x96, 0x78, 0x96, 0xa5, 0x85, 0x66, 0x46, 0x26, 0x07, 0x00,
+    0x00, 0x04, 0x24, 0x43, 0x63, 0x83, 0xa2, 0x95, 0x81, 0x9f, 0x8e, 0x70, 0x6d, 0x8c, 0x9f, 0x80,
+    0x96, 0xa3, 0x83, 0x64, 0x44, 0x24, 0x04, 0x00, 0x00, 0x02, 0x21, 0x41, 0x61, 0x80, 0xa0, 0x95,
+    0x8a, 0xa2, 0x84, 0x66, 0x64, 0x82, 0xa1, 0x89, 0x96, 0xa1, 0x81, 0x61, 0x42, 0x22, 0x02, 0x00,
+    0x00, 0x00, 0x1f, 0x3f, 0x5e, 0x7e, 0x9d, 0xa4, 0x9f, 0x98, 0x7a, 0x5c, 0x5b, 0x79, 0x97, 0x9f,
+    0xa4, 0x9e, 0x7f, 0x5f, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x7b, 0x9b, 0xba,
+    0xad, 0x8f, 0x70, 0x52, 0x51, 0x70, 0x8e, 0xac, 0xbb, 0x9c, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x97, 0xb0, 0xa3, 0x85, 0x67, 0x48, 0x48, 0x66, 0x84, 0xa2,
+    0xb0, 0x99, 0x79, 0x5a, 0x3a, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x16, 0x35, 0x55, 0x75, 0x90, 0x90,
+    0x90, 0x7b, 0x5d, 0x3f, 0x3e, 0x5c, 0x7a, 0x90, 0x90, 0x90, 0x76, 0x57, 0x37, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x32, 0x50, 0x6b, 0x70, 0x70, 0x70, 0x6d, 0x53, 0x35, 0x33, 0x51, 0x6c, 0x70,
+    0x70, 0x70, 0x6d, 0x52, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x09, 0x26, 0x3e, 0x4f, 0x50, 0x50,
+    0x50, 0x4f, 0x41, 0x28, 0x27, 0x3f, 0x4f, 0x50, 0x50, 0x50, 0x4f, 0x40, 0x27, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x25, 0x30, 0x31, 0x31, 0x31, 0x30, 0x26, 0x14, 0x12, 0x25, 0x30, 0x31,
+    0x31, 0x31, 0x30, 0x26, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x11, 0x11,
+    0x11, 0x10, 0x09, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+    /* U+0061 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x12, 0x17, 0x1b, 0x1d,
+    0x1e, 0x1e, 0x1b, 0x16, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x1f, 0x2a, 0x31, 0x36, 0x3b, 0x3d, 0x3e, 0x3d, 0x3b, 0x35, 0x2d, 0x21, 0x13, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x3b, 0x48, 0x50, 0x56, 0x5a, 0x5d, 0x5e, 0x5d, 0x5a, 0x54,
+    0x4b, 0x3e, 0x2e, 0x1b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x50, 0x66, 0x6f, 0x75,
+    0x7a, 0x7c, 0x7e, 0x7d, 0x7a, 0x73, 0x68, 0x5a, 0x47, 0x32, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x36, 0x55, 0x75, 0x8e, 0x94, 0x99, 0x9c, 0x9d, 0x9c, 0x99, 0x91, 0x85, 0x74, 0x5f, 0x46,
+    0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x31, 0x50, 0x6f, 0x8f, 0xae, 0xae, 0xac, 0xac, 0xaf,
+    0xb8, 0xaf, 0xa0, 0x8b, 0x72, 0x57, 0x3b, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x4b, 0x6a,
+    0x89, 0x94, 0x8f, 0x8c, 0x8c, 0x90, 0x9b, 0xad, 0xb8, 0x9e, 0x82, 0x64, 0x46, 0x28, 0x09, 0x00,
+    0x00, 0x00, 0x07, 0x26, 0x45, 0x65, 0x7c, 0x74, 0x6f, 0x6d, 0x6c, 0x71, 0x80, 0x98, 0xb3, 0xab,
+    0x8c, 0x6d, 0x4e, 0x2f, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x54, 0x5d, 0x55, 0x54, 0x58,
+    0x59, 0x59, 0x6c, 0x8a, 0xa9, 0xb1, 0x91, 0x72, 0x52, 0x33, 0x13, 0x00, 0x00, 0x00, 0x10, 0x28,
+    0x3e, 0x51, 0x60, 0x6c, 0x73, 0x77, 0x79, 0x78, 0x75, 0x85, 0xa5, 0xb3, 0x93, 0x74, 0x54, 0x34,
+    0x14, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x55, 0x6b, 0x7d, 0x8a, 0x92, 0x97, 0x99, 0x98, 0x95, 0x91,
+    0xa9, 0xb3, 0x93, 0x74, 0x54, 0x34, 0x14, 0x00, 0x00, 0x14, 0x32, 0x4e, 0x69, 0x82, 0x97, 0xa7,
+    0xb0, 0xa5, 0xa0, 0x9f, 0xa1, 0xa4, 0xb4, 0xb3, 0x93, 0x74, 0x54, 0x34, 0x14, 0x00, 0x00, 0x1d,
+    0x3c, 0x5a, 0x78, 0x95, 0xaf, 0xab, 0x95, 0x87, 0x81, 0x7f, 0x81, 0x87, 0xa5, 0xb3, 0x93, 0x74,
+    0x54, 0x34, 0x14, 0x00, 0x03, 0x22, 0x42, 0x61, 0x81, 0xa0, 0xbb, 0x9c, 0x7f, 0x69, 0x61, 0x5f,
+    0x65, 0x85, 0xa5, 0xb3, 0x93, 0x74, 0x54, 0x34, 0x14, 0x00, 0x04, 0x24, 0x43, 0x63, 0x83, 0xa3,
+    0xb9, 0x99, 0x79, 0x5a, 0x4c, 0x4b, 0x65, 0x85, 0xa5, 0xb3, 0x93, 0x74, 0x54, 0x34, 0x14, 0x00,
+    0x02, 0x22, 0x41, 0x61, 0x80, 0x9f, 0xbe, 0xa1, 0x85, 0x73, 0x6b, 0x6a, 0x6b, 0x85, 0xa5, 0xb3,
+    0x93, 0x74, 0x54, 0x34, 0x14, 0x00, 0x00, 0x1d, 0x3b, 0x5a, 0x78, 0x95, 0xb0, 0xb2, 0x9d, 0x90,
+    0x8b, 0x8a, 0x8b, 0x8e, 0xa7, 0xb3, 0x93, 0x74, 0x54, 0x34, 0x14, 0x00, 0x00, 0x14, 0x31, 0x4e,
+    0x6a, 0x84, 0x9a, 0xaa, 0xb4, 0xaf, 0xaa, 0xaa, 0xab, 0xad, 0xb2, 0xad, 0x93, 0x74, 0x54, 0x34,
+    0x14, 0x00, 0x00, 0x07, 0x23, 0x3e, 0x57, 0x6d, 0x7f, 0x8d, 0x95, 0x99, 0x9b, 0x9b, 0x99, 0x97,
+    0x93, 0x8e, 0x88, 0x74, 0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x12, 0x2a, 0x40, 0x54, 0x63, 0x6e,
+    0x76, 0x7a, 0x7b, 0x7b, 0x7a, 0x77, 0x74, 0x6f, 0x69, 0x62, 0x4c, 0x2f, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x28, 0x38, 0x46, 0x50, 0x56, 0x5a, 0x5b, 0x5b, 0x5a, 0x58, 0x54, 0x4f, 0x4a, 0x44,
+    0x37, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1c, 0x28, 0x31, 0x37, 0x3a, 0x3c, 0x3c,
+    0x3a, 0x38, 0x35, 0x30, 0x2b, 0x25, 0x1b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x12, 0x17, 0x1b, 0x1c, 0x1c, 0x1b, 0x18, 0x15, 0x11, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+0065 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x14, 0x1a, 0x1e, 0x1e, 0x1c, 0x17, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x1b, 0x28, 0x32, 0x3a, 0x3d, 0x3e, 0x3b, 0x36, 0x2e, 0x22, 0x14,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x26, 0x37, 0x45, 0x51, 0x59,
+    0x5d, 0x5d, 0x5b, 0x55, 0x4c, 0x3f, 0x2f, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x2a, 0x3f, 0x52, 0x62, 0x6f, 0x78, 0x7d, 0x7d, 0x7a, 0x74, 0x69, 0x5b, 0x49, 0x34, 0x1d,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x28, 0x40, 0x57, 0x6c, 0x7e, 0x8c, 0x97, 0x9c, 0x9d,
+    0x99, 0x92, 0x86, 0x75, 0x61, 0x4a, 0x30, 0x17, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x3a, 0x55,
+    0x6d, 0x84, 0x98, 0xa9, 0xb4, 0xad, 0xac, 0xb1, 0xb0, 0xa1, 0x8d, 0x76, 0x5d, 0x42, 0x26, 0x0a,
+    0x00, 0x00, 0x00, 0x11, 0x2e, 0x4b, 0x66, 0x81, 0x9a, 0xb1, 0xa7, 0x97, 0x8d, 0x8c, 0x93, 0xa2,
+    0xb7, 0xa3, 0x89, 0x6d, 0x51, 0x33, 0x15, 0x00, 0x00, 0x00, 0x1d, 0x3b, 0x58, 0x75, 0x92, 0xad,
+    0xab, 0x91, 0x7b, 0x6e, 0x6d, 0x76, 0x8a, 0xa3, 0xb4, 0x97, 0x79, 0x5c, 0x3d, 0x1e, 0x00, 0x00,
+    0x07, 0x26, 0x44, 0x63, 0x81, 0x9f, 0xbb, 0x9d, 0x7f, 0x64, 0x50, 0x4f, 0x5d, 0x78, 0x95, 0xb4,
+    0xa1, 0x82, 0x63, 0x45, 0x25, 0x06, 0x00, 0x0c, 0x2c, 0x4b, 0x6a, 0x89, 0xa9, 0xb3, 0x94, 0x75,
+    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x8f, 0xae, 0xa8, 0x88, 0x69, 0x49, 0x2a, 0x0a, 0x00, 0x10, 0x2f,
+    0x4f, 0x6f, 0x8e, 0xae, 0xb4, 0x97, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x94, 0xb0, 0xab, 0x8b,
+    0x6b, 0x4c, 0x2c, 0x0c, 0x00, 0x11, 0x31, 0x51, 0x70, 0x90, 0xb0, 0xc0, 0xac, 0xa8, 0xa8, 0xa8,
+    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8c, 0x6c, 0x4d, 0x2d, 0x0d, 0x00, 0x10, 0x30, 0x50, 0x6f,
+    0x8f, 0xaf, 0xb2, 0x93, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x6b, 0x4b,
+    0x2c, 0x0c, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x8b, 0xaa, 0xb3, 0x94, 0x75, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x60, 0x46, 0x28, 0x09, 0x00, 0x08, 0x27, 0x46, 0x64, 0x83, 0xa1,
+    0xbc, 0x9e, 0x84, 0x6d, 0x5d, 0x55, 0x53, 0x55, 0x5b, 0x63, 0x6b, 0x59, 0x45, 0x33, 0x1a, 0x00,
+    0x00, 0x00, 0x1f, 0x3c, 0x5a, 0x77, 0x93, 0xae, 0xb0, 0x9a, 0x88, 0x7b, 0x74, 0x72, 0x74, 0x7a,
+    0x81, 0x81, 0x62, 0x42, 0x23, 0x06, 0x00, 0x00, 0x00, 0x13, 0x30, 0x4c, 0x68, 0x82, 0x9a, 0xb0,
+    0xb3, 0xa4, 0x99, 0x94, 0x92, 0x94, 0x99, 0xa0, 0x86, 0x67, 0x47, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0x05, 0x21, 0x3c, 0x56, 0x6d, 0x83, 0x96, 0xa5, 0xaf, 0xb6, 0xb3, 0xb2, 0xb4, 0xb4, 0xaa, 0x8b,
+    0x6c, 0x4c, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x29, 0x41, 0x56, 0x6a, 0x7a, 0x87, 0x91,
+    0x97, 0x9a, 0x9b, 0x99, 0x95, 0x8e, 0x86, 0x71, 0x51, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x2a, 0x3d, 0x4f, 0x5e, 0x69, 0x72, 0x78, 0x7b, 0x7b, 0x7a, 0x76, 0x6f, 0x67, 0x5d, 0x48,
+    0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x33, 0x41, 0x4b, 0x53, 0x58, 0x5b,
+    0x5b, 0x5a, 0x56, 0x50, 0x49, 0x3f, 0x31, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x17, 0x23, 0x2d, 0x34, 0x39, 0x3b, 0x3c, 0x3a, 0x37, 0x31, 0x2a, 0x21, 0x16, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0e, 0x15, 0x19, 0x1c, 0x1c, 0x1b,
+    0x18, 0x12, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+0067 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x17,
+    0x1b, 0x1c, 0x1c, 0x19, 0x16, 0x11, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0d, 0x1c, 0x27, 0x30, 0x36, 0x3a, 0x3c, 0x3b, 0x39, 0x35, 0x30, 0x29, 0x22, 0x17, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x29, 0x38, 0x45, 0x4f, 0x56, 0x5a, 0x5c, 0x5b, 0x59,
+    0x55, 0x4f, 0x48, 0x41, 0x32, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x02, 0x19, 0x2f, 0x43, 0x54, 0x62,
+    0x6e, 0x75, 0x7a, 0x7b, 0x7b, 0x78, 0x74, 0x6e, 0x67, 0x5e, 0x48, 0x2c, 0x0d, 0x00, 0x00, 0x00,
+    0x15, 0x2f, 0x46, 0x5c, 0x6f, 0x7f, 0x8c, 0x94, 0x99, 0x9b, 0x9b, 0x98, 0x93, 0x8d, 0x86, 0x71,
+    0x51, 0x31, 0x11, 0x00, 0x00, 0x0a, 0x26, 0x41, 0x5b, 0x73, 0x89, 0x9b, 0xa9, 0xb3, 0xae, 0xab,
+    0xac, 0xb2, 0xb3, 0xac, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x00, 0x17, 0x34, 0x51, 0x6d, 0x87,
+    0xa0, 0xb5, 0xaa, 0x99, 0x8e, 0x8b, 0x8d, 0x95, 0xb1, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00,
+    0x02, 0x20, 0x3f, 0x5d, 0x7b, 0x97, 0xb3, 0xad, 0x92, 0x7d, 0x6f, 0x6b, 0x6f, 0x8e, 0xae, 0xb0,
+    0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x08, 0x28, 0x47, 0x66, 0x85, 0xa3, 0xbd, 0x9e, 0x81, 0x66,
+    0x52, 0x4f, 0x6f, 0x8e, 0xae, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x0d, 0x2c, 0x4c, 0x6b,
+    0x8b, 0xaa, 0xb5, 0x96, 0x77, 0x59, 0x3b, 0x4f, 0x6f, 0x8e, 0xae, 0xb0, 0x90, 0x71, 0x51, 0x31,
+    0x11, 0x00, 0x0e, 0x2e, 0x4e, 0x6e, 0x8d, 0xad, 0xb2, 0x93, 0x73, 0x53, 0x34, 0x4f, 0x6f, 0x8e,
+    0xae, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x0f, 0x2e, 0x4e, 0x6e, 0x8d, 0xad, 0xb2, 0x92,
+    0x72, 0x53, 0x33, 0x4f, 0x6f, 0x8e, 0xae, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x0d, 0x2c,
+    0x4c, 0x6b, 0x8b, 0xaa, 0xb5, 0x96, 0x77, 0x58, 0x3a, 0x4f, 0x6f, 0x8e, 0xae, 0xb0, 0x90, 0x71,
+    0x51, 0x31, 0x11, 0x00, 0x09, 0x28, 0x47, 0x66, 0x85, 0xa4, 0xbc, 0x9e, 0x81, 0x66, 0x57, 0x59,
+    0x6f, 0x8e, 0xae, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x02, 0x21, 0x40, 0x5e, 0x7c, 0x99,
+    0xb6, 0xac, 0x93, 0x80, 0x77, 0x78, 0x80, 0x91, 0xaf, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00,
+    0x00, 0x17, 0x35, 0x52, 0x6f, 0x8a, 0xa3, 0xb9, 0xab, 0x9d, 0x97, 0x97, 0x9e, 0xaa, 0xbd, 0xb0,
+    0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x00, 0x0b, 0x28, 0x44, 0x5e, 0x77, 0x8d, 0x9e, 0xaa, 0xaf,
+    0xaf, 0xaa, 0xa0, 0x9f, 0xb6, 0xb0, 0x90, 0x71, 0x51, 0x31, 0x11, 0x00, 0x00, 0x00, 0x18, 0x31,
+    0x4a, 0x60, 0x73, 0x82, 0x8b, 0x8f, 0x90, 0x8b, 0x82, 0x8e, 0xae, 0xb0, 0x90, 0x70, 0x50, 0x31,
+    0x11, 0x00, 0x00, 0x04, 0x20, 0x39, 0x4a, 0x4c, 0x57, 0x64, 0x6c, 0x6f, 0x70, 0x6c, 0x70, 0x8f,
+    0xaf, 0xad, 0x8e, 0x6f, 0x4f, 0x2f, 0x10, 0x00, 0x00, 0x0d, 0x2c, 0x4a, 0x66, 0x6a, 0x5f, 0x56,
+    0x51, 0x50, 0x51, 0x5e, 0x78, 0x96, 0xb4, 0xa8, 0x89, 0x6a, 0x4b, 0x2b, 0x0c, 0x00, 0x00, 0x14,
+    0x33, 0x52, 0x71, 0x88, 0x7e, 0x75, 0x70, 0x6f, 0x71, 0x7a, 0x8b, 0xa4, 0xbb, 0x9e, 0x81, 0x62,
+    0x44, 0x25, 0x06, 0x00, 0x00, 0x1b, 0x3a, 0x59, 0x78, 0x97, 0x9c, 0x94, 0x90, 0x8e, 0x90, 0x97,
+    0xa5, 0xb8, 0xa9, 0x8f, 0x74, 0x57, 0x3a, 0x1c, 0x00, 0x00, 0x03, 0x22, 0x41, 0x60, 0x7f, 0x9e,
+    0xaf, 0xb3, 0xaf, 0xae, 0xb0, 0xb5, 0xaf, 0xa3, 0x92, 0x7c, 0x64, 0x49, 0x2d, 0x11, 0x00, 0x00,
+    0x06, 0x26, 0x45, 0x65, 0x7f, 0x88, 0x90, 0x96, 0x9a, 0x9c, 0x9b, 0x97, 0x91, 0x86, 0x78, 0x65,
+    0x4f, 0x37, 0x1d, 0x02, 0x00, 0x00, 0x01, 0x1f, 0x3c, 0x54, 0x61, 0x69, 0x71, 0x77, 0x7b, 0x7c,
+    0x7b, 0x78, 0x72, 0x69, 0x5c, 0x4c, 0x38, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x39,
+    0x42, 0x4b, 0x52, 0x58, 0x5b, 0x5c, 0x5b, 0x58, 0x53, 0x4b, 0x40, 0x31, 0x20, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x24, 0x2c, 0x33, 0x38, 0x3b, 0x3d, 0x3b, 0x39, 0x34, 0x2d,
+    0x22, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x14, 0x19,
+    0x1c, 0x1d, 0x1c, 0x19, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* U+006F */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x0c, 0x15, 0x1b, 0x1e, 0x1e, 0x1b, 0x16, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1e, 0x2a, 0x34, 0x3a, 0x3e, 0x3e, 0x3b, 0x35, 0x2b,
+    0x1f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x29, 0x3a,
+    0x48, 0x52, 0x5a, 0x5d, 0x5d, 0x5a, 0x53, 0x49, 0x3b, 0x2a, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x2e, 0x43, 0x55, 0x65, 0x71, 0x79, 0x7d, 0x7d, 0x79, 0x71, 0x66,
+    0x56, 0x44, 0x2f, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x44, 0x5b, 0x6f,
+    0x81, 0x8e, 0x98, 0x9d, 0x9d, 0x98, 0x8f, 0x82, 0x70, 0x5c, 0x46, 0x2d, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x23, 0x3e, 0x58, 0x71, 0x88, 0x9b, 0xab, 0xb7, 0xb1, 0xb1, 0xb6, 0xad, 0x9d,
+    0x89, 0x72, 0x5a, 0x40, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x14, 0x31, 0x4e, 0x6a, 0x84, 0x9e,
+    0xb4, 0xaa, 0x9a, 0x91, 0x91, 0x99, 0xa8, 0xb6, 0x9f, 0x86, 0x6b, 0x50, 0x33, 0x16, 0x00, 0x00,
+    0x00, 0x01, 0x20, 0x3e, 0x5b, 0x78, 0x95, 0xb0, 0xad, 0x93, 0x7e, 0x72, 0x71, 0x7c, 0x91, 0xab,
+    0xb2, 0x97, 0x7a, 0x5d, 0x3f, 0x21, 0x03, 0x00, 0x00, 0x09, 0x28, 0x47, 0x66, 0x84, 0xa2, 0xbc,
+    0x9f, 0x82, 0x67, 0x53, 0x52, 0x65, 0x80, 0x9d, 0xbb, 0xa3, 0x85, 0x67, 0x48, 0x2a, 0x0b, 0x00,
+    0x00, 0x0f, 0x2e, 0x4e, 0x6d, 0x8c, 0xab, 0xb4, 0x94, 0x76, 0x58, 0x3b, 0x39, 0x57, 0x75, 0x94,
+    0xb3, 0xac, 0x8d, 0x6e, 0x4f, 0x2f, 0x10, 0x00, 0x00, 0x12, 0x32, 0x51, 0x71, 0x91, 0xb0, 0xaf,
+    0x8f, 0x70, 0x50, 0x31, 0x31, 0x50, 0x70, 0x8f, 0xaf, 0xb1, 0x92, 0x72, 0x52, 0x33, 0x13, 0x00,
+    0x00, 0x13, 0x33, 0x53, 0x72, 0x92, 0xb2, 0xad, 0x8e, 0x6e, 0x4e, 0x2e, 0x2e, 0x4e, 0x6e, 0x8e,
+    0xad, 0xb3, 0x93, 0x73, 0x54, 0x34, 0x14, 0x00, 0x00, 0x12, 0x32, 0x51, 0x71, 0x91, 0xb0, 0xaf,
+    0x8f, 0x70, 0x50, 0x31, 0x31, 0x50, 0x70, 0x8f, 0xaf, 0xb1, 0x92, 0x72, 0x52, 0x33, 0x13, 0x00,
+    0x00, 0x0f, 0x2e, 0x4d, 0x6d, 0x8c, 0xab, 0xb3, 0x94, 0x76, 0x57, 0x3a, 0x3b, 0x58, 0x76, 0x95,
+    0xb4, 0xac, 0x8d, 0x6e, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x09, 0x28, 0x47, 0x65, 0x84, 0xa2, 0xbb,
+    0x9e, 0x81, 0x65, 0x53, 0x53, 0x67, 0x82, 0x9f, 0xbc, 0xa3, 0x85, 0x66, 0x48, 0x29, 0x0a, 0x00,
+    0x00, 0x01, 0x1f, 0x3d, 0x5b, 0x78, 0x95, 0xb0, 0xac, 0x92, 0x7d, 0x72, 0x72, 0x7e, 0x94, 0xad,
+    0xb1, 0x96, 0x79, 0x5c, 0x3e, 0x20, 0x02, 0x00, 0x00, 0x00, 0x14, 0x31, 0x4e, 0x69, 0x84, 0x9d,
+    0xb4, 0xa9, 0x99, 0x91, 0x91, 0x9a, 0xab, 0xb5, 0x9e, 0x85, 0x6a, 0x4f, 0x32, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x23, 0x3e, 0x58, 0x70, 0x87, 0x9b, 0xab, 0xb7, 0xb1, 0xb1, 0xb7, 0xac, 0x9c,
+    0x88, 0x72, 0x59, 0x3f, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2b, 0x44, 0x5a, 0x6f,
+    0x80, 0x8e, 0x98, 0x9c, 0x9d, 0x98, 0x8f, 0x81, 0x70, 0x5b, 0x45, 0x2c, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x2d, 0x42, 0x55, 0x64, 0x71, 0x79, 0x7d, 0x7d, 0x79, 0x71, 0x65,
+    0x56, 0x43, 0x2f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x29, 0x39,
+    0x48, 0x52, 0x59, 0x5d, 0x5d, 0x5a, 0x53, 0x48, 0x3a, 0x2a, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x2a, 0x34, 0x3a, 0x3d, 0x3d, 0x3a, 0x34, 0x2b,
+    0x1e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x0c, 0x15, 0x1b, 0x1e, 0x1e, 0x1b, 0x15, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+00C1 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x1d, 0x23, 0x1e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x16, 0x28, 0x3a, 0x42, 0x3b, 0x28,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x1e, 0x30, 0x42, 0x55, 0x62, 0x55, 0x3b, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x26, 0x38, 0x4a, 0x5c, 0x6f, 0x81, 0x67, 0x4d,
+    0x32, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1b, 0x2d,
+    0x40, 0x52, 0x64, 0x76, 0x89, 0x93, 0x79, 0x5e, 0x43, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x31, 0x47, 0x5a, 0x6c, 0x7e, 0x90, 0xa3, 0xa5, 0x8a, 0x6f,
+    0x55, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x3f, 0x5d,
+    0x74, 0x86, 0x98, 0xaa, 0xa8, 0x9a, 0x8c, 0x7e, 0x60, 0x40, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x3f, 0x5d, 0x78, 0x92, 0xa7, 0x99, 0x8b, 0x7d, 0x70, 0x62,
+    0x52, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x31, 0x4b,
+    0x66, 0x80, 0x8a, 0x7c, 0x6f, 0x61, 0x53, 0x45, 0x37, 0x25, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x3a, 0x54, 0x6e, 0x6e, 0x6a, 0x6a, 0x6a, 0x68, 0x51,
+    0x34, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a,
+    0x58, 0x76, 0x8a, 0x8a, 0x8a, 0x8a, 0x7a, 0x5c, 0x3e, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x25, 0x43, 0x61, 0x80, 0x9e, 0xaa, 0xaa, 0xa2, 0x84, 0x66,
+    0x47, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4c,
+    0x6b, 0x89, 0xa7, 0xb3, 0xb3, 0xac, 0x8d, 0x6f, 0x51, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x37, 0x56, 0x74, 0x92, 0xb1, 0x96, 0x98, 0xb3, 0x97, 0x78,
+    0x5a, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x40, 0x5f,
+    0x7d, 0x9c, 0xa9, 0x8a, 0x8c, 0xab, 0xa0, 0x82, 0x63, 0x45, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x4a, 0x68, 0x86, 0xa5, 0xa0, 0x82, 0x84, 0xa2, 0xa9, 0x8b,
+    0x6d, 0x4e, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x34, 0x53, 0x71,
+    0x90, 0xae, 0x98, 0x79, 0x7b, 0x9a, 0xb2, 0x94, 0x76, 0x57, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1f, 0x3e, 0x5c, 0x7a, 0x99, 0xaf, 0x90, 0x71, 0x73, 0x92, 0xb1, 0x9d,
+    0x7f, 0x60, 0x42, 0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x28, 0x47, 0x65, 0x84,
+    0xa2, 0xa7, 0x89, 0x6a, 0x6c, 0x8b, 0xaa, 0xa6, 0x87, 0x69, 0x4a, 0x2c, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x31, 0x50, 0x6e, 0x8d, 0xab, 0xa1, 0x81, 0x62, 0x65, 0x84, 0xa3, 0xaf,
+    0x90, 0x72, 0x53, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x59, 0x77, 0x96,
+    0xb4, 0x9a, 0x7b, 0x5c, 0x5e, 0x7e, 0x9d, 0xb7, 0x99, 0x7a, 0x5c, 0x3d, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x24, 0x43, 0x61, 0x80, 0x9e, 0xb3, 0x94, 0x75, 0x6b, 0x6b, 0x78, 0x97, 0xb6,
+    0xa1, 0x83, 0x64, 0x45, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x6a, 0x88, 0xa7,
+    0xb1, 0x94, 0x8b, 0x8b, 0x8b, 0x8b, 0x96, 0xb4, 0xaa, 0x8b, 0x6c, 0x4e, 0x2f, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x35, 0x54, 0x72, 0x91, 0xaf, 0xc0, 0xae, 0xab, 0xab, 0xab, 0xab, 0xaf, 0xc3,
+    0xb2, 0x93, 0x74, 0x56, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7b, 0x99, 0xb8,
+    0xa6, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xaa, 0xba, 0x9b, 0x7c, 0x5d, 0x3f, 0x20, 0x01, 0x00,
+    0x00, 0x08, 0x26, 0x45, 0x64, 0x83, 0xa1, 0xb7, 0x98, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x9d,
+    0xbc, 0xa3, 0x84, 0x65, 0x46, 0x28, 0x09, 0x00, 0x00, 0x0f, 0x2e, 0x4d, 0x6c, 0x8b, 0xa9, 0xb1,
+    0x92, 0x73, 0x5e, 0x5e, 0x5e, 0x5e, 0x77, 0x96, 0xb6, 0xab, 0x8c, 0x6d, 0x4e, 0x2f, 0x10, 0x00,
+    0x00, 0x17, 0x36, 0x55, 0x74, 0x92, 0xb1, 0xab, 0x8c, 0x6c, 0x4d, 0x3e, 0x3e, 0x52, 0x71, 0x90,
+    0xaf, 0xb2, 0x93, 0x74, 0x55, 0x37, 0x18, 0x00, 0x00, 0x1f, 0x3e, 0x5c, 0x7b, 0x9a, 0xb0, 0xa5,
+    0x86, 0x66, 0x47, 0x28, 0x2c, 0x4c, 0x6b, 0x8a, 0xa9, 0xb0, 0x9b, 0x7c, 0x5d, 0x3e, 0x1f, 0x00,
+    0x07, 0x26, 0x45, 0x64, 0x83, 0x90, 0x90, 0x90, 0x7f, 0x60, 0x41, 0x22, 0x26, 0x45, 0x64, 0x84,
+    0x90, 0x90, 0x90, 0x83, 0x64, 0x45, 0x26, 0x07, 0x07, 0x26, 0x45, 0x62, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x59, 0x3b, 0x1c, 0x20, 0x3f, 0x5d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x62, 0x45, 0x26, 0x07,
+    0x00, 0x1b, 0x36, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x50, 0x45, 0x2e, 0x12, 0x16, 0x31, 0x47, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x4a, 0x36, 0x1b, 0x00, 0x00, 0x09, 0x1e, 0x2d, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x29, 0x18, 0x01, 0x04, 0x1b, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1e, 0x09, 0x00,
+    0x00, 0x00, 0x03, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x0e, 0x03, 0x00, 0x00,
+};
+
+static const lv_font_sdf_glyph_dsc_t glyph_dsc[] = {
+    {.sdf_index = 0, .adv_w = 256, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0}, /* U+0020 */
+    {.sdf_index = 0, .adv_w = 256, .box_w = 22, .box_h = 30, .ofs_x = -3, .ofs_y = -5}, /* U+0038 */
+    {.sdf_index = 660, .adv_w = 256, .box_w = 24, .box_h = 28, .ofs_x = -4, .ofs_y = -4}, /* U+0041 */
+    {.sdf_index = 1332, .adv_w = 256, .box_w = 23, .box_h = 30, .ofs_x = -3, .ofs_y = -5}, /* U+0042 */
+    {.sdf_index = 2022, .adv_w = 256, .box_w = 24, .box_h = 28, .ofs_x = -4, .ofs_y = -4}, /* U+0057 */
+    {.sdf_index = 2694, .adv_w = 256, .box_w = 22, .box_h = 25, .ofs_x = -3, .ofs_y = -5}, /* U+0061 */
+    {.sdf_index = 3244, .adv_w = 256, .box_w = 23, .box_h = 25, .ofs_x = -4, .ofs_y = -5}, /* U+0065 */
+    {.sdf_index = 3819, .adv_w = 256, .box_w = 22, .box_h = 30, .ofs_x = -3, .ofs_y = -10}, /* U+0067 */
+    {.sdf_index = 4479, .adv_w = 256, .box_w = 24, .box_h = 25, .ofs_x = -4, .ofs_y = -5}, /* U+006F */
+    {.sdf_index = 5079, .adv_w = 256, .box_w = 24, .box_h = 35, .ofs_x = -4, .ofs_y = -4}, /* U+00C1 */
+};
+
+/*The letters in increasing order. The glyph of `unicode_list[i]` is `glyph_dsc[i]`*/
+static const uint32_t unicode_list[] = {
+    0x0020, 0x0038, 0x0041, 0x0042, 0x0057, 0x0061, 0x0065, 0x0067,
+    0x006f, 0x00c1,
+};
+
+const lv_font_sdf_dsc_t test_font_sdf_ubuntu = {
+    .glyph_sdf = glyph_sdf,
+    .glyph_dsc = glyph_dsc,
+    .unicode_list = unicode_list,
+    .glyph_cnt = 10,
+    .line_height = 32,
+    .base_line = 6,
+    .spread = 4,
+};
+
+#endif /*LV_USE_FONT_SDF*/
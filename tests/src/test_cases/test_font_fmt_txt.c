@@ -0,0 +1,259 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+#if LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+static void check_cached_bitmap(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, letter, 0));
+    uint32_t size = g.box_w * g.box_h;
+
+    uint8_t * buf1 = lv_malloc(size);
+    uint8_t * buf2 = lv_malloc(size);
+
+    lv_font_fmt_txt_bitmap_cache_stats_t stats;
+    lv_font_fmt_txt_bitmap_cache_reset_stats();
+
+    /*Decoded from the font*/
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, letter, buf1));
+    lv_font_fmt_txt_bitmap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.miss);
+    TEST_ASSERT_EQUAL(0, stats.hit);
+
+    /*Copied from the cache*/
+    lv_memset(buf2, 0x55, size);
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, letter, buf2));
+    lv_font_fmt_txt_bitmap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.miss);
+    TEST_ASSERT_EQUAL(1, stats.hit);
+
+    TEST_ASSERT_EQUAL_MEMORY(buf1, buf2, size);
+
+    lv_free(buf1);
+    lv_free(buf2);
+}
+
+void test_bitmap_cache(void)
+{
+    lv_font_fmt_txt_bitmap_cache_drop(NULL);
+
+    check_cached_bitmap(&lv_font_montserrat_14, 'A');
+    check_cached_bitmap(&lv_font_montserrat_14, 'g');
+    check_cached_bitmap(&lv_font_montserrat_28_compressed, 'W');
+    check_cached_bitmap(&lv_font_montserrat_28_compressed, 'q');
+
+    lv_font_fmt_txt_bitmap_cache_stats_t stats;
+    lv_font_fmt_txt_bitmap_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.used_size);
+
+    /*Only the bitmaps of the given font are dropped*/
+    uint32_t used_size = stats.used_size;
+    lv_font_fmt_txt_bitmap_cache_drop(&lv_font_montserrat_28_compressed);
+    lv_font_fmt_txt_bitmap_cache_get_stats(&stats);
+    TEST_ASSERT_LESS_THAN(used_size, stats.used_size);
+    TEST_ASSERT_GREATER_THAN(0, stats.used_size);
+
+    /*Many glyphs don't fit into the cache*/
+    uint8_t buf[64 * 64];
+    uint32_t letter;
+    for(letter = 'A'; letter <= 'z'; letter++) {
+        lv_font_get_glyph_bitmap(&lv_font_montserrat_28_compressed, letter, buf);
+    }
+    lv_font_fmt_txt_bitmap_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.evict);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE, stats.used_size);
+
+    /*The least recently used glyphs were dropped, so they are decoded again*/
+    check_cached_bitmap(&lv_font_montserrat_28_compressed, 'A');
+
+    lv_font_fmt_txt_bitmap_cache_drop(NULL);
+    lv_font_fmt_txt_bitmap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.used_size);
+}
+#endif
+
+#if LV_USE_FONT_GLYPH_ID_LOOKUP
+/*Search the glyph in the cmaps the same way as without the lookup table*/
+static uint32_t ref_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if(rcp >= cmap->range_length) continue;
+
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) return cmap->glyph_id_start + rcp;
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+        }
+
+        uint32_t k;
+        for(k = 0; k < cmap->list_length; k++) {
+            if(cmap->unicode_list[k] != rcp) continue;
+            if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return cmap->glyph_id_start + k;
+            return cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[k];
+        }
+        return 0;
+    }
+    return 0;
+}
+
+static void check_glyph_lookup(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    TEST_ASSERT_NOT_NULL(fdsc->cache);
+
+    uint32_t letter;
+    for(letter = 1; letter < 0x11000; letter++) {
+        if(letter == '\t') continue;
+
+        uint32_t gid = ref_glyph_id(fdsc, letter);
+        lv_font_glyph_dsc_t g;
+        bool found = font->get_glyph_dsc(font, &g, letter, 0);
+        TEST_ASSERT_EQUAL_MESSAGE(gid != 0, found, "glyph found");
+        if(!found) continue;
+
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+        TEST_ASSERT_EQUAL(gdsc->box_w, g.box_w);
+        TEST_ASSERT_EQUAL(gdsc->box_h, g.box_h);
+        TEST_ASSERT_EQUAL(gdsc->ofs_x, g.ofs_x);
+        TEST_ASSERT_EQUAL(gdsc->ofs_y, g.ofs_y);
+    }
+
+    /*Letters outside of the cmaps*/
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_FALSE(font->get_glyph_dsc(font, &g, 0x10FFFF, 0));
+    TEST_ASSERT_FALSE(font->get_glyph_dsc(font, &g, 0xFFFFFFFF, 0));
+}
+
+void test_glyph_lookup(void)
+{
+    check_glyph_lookup(&lv_font_montserrat_14);
+    check_glyph_lookup(&lv_font_simsun_16_cjk);
+    check_glyph_lookup(&lv_font_dejavu_16_persian_hebrew);
+
+    /*The table is created again after dropping it*/
+    lv_font_fmt_txt_lookup_drop(&lv_font_simsun_16_cjk);
+    const lv_font_fmt_txt_dsc_t * fdsc = lv_font_simsun_16_cjk.dsc;
+    TEST_ASSERT_NULL(fdsc->cache->gid_pages);
+    check_glyph_lookup(&lv_font_simsun_16_cjk);
+    TEST_ASSERT_NOT_NULL(fdsc->cache->gid_pages);
+
+    lv_font_t * font = lv_font_load("A:src/test_assets/font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font);
+    check_glyph_lookup(font);
+    lv_font_free(font);
+}
+#endif
+
+/*Kerning pairs of ASCII letters, ordered by the left, then by the right letter*/
+static const char kern_letters[][2] = {{'A', 'V'}, {'A', 'W'}, {'T', 'o'}, {'V', 'A'}, {'r', '.'}};
+static const int8_t kern_values[] = {-20, -12, -30, -18, -25};
+
+static uint32_t ascii_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    return fdsc->cmaps[0].glyph_id_start + letter - fdsc->cmaps[0].range_start;
+}
+
+static void check_kern_pairs(bool ids_16)
+{
+    /*Use the glyphs of a built-in font with kerning pairs*/
+    lv_font_fmt_txt_glyph_cache_t cache;
+    lv_memzero(&cache, sizeof(cache));
+    lv_font_fmt_txt_dsc_t fdsc = *(const lv_font_fmt_txt_dsc_t *)lv_font_montserrat_14.dsc;
+    lv_font_t font = lv_font_montserrat_14;
+    font.dsc = &fdsc;
+    fdsc.cache = &cache;
+
+    uint32_t pair_cnt = sizeof(kern_values);
+    uint8_t ids_8[sizeof(kern_values) * 2];
+    uint16_t ids_16_buf[sizeof(kern_values) * 2];
+    uint32_t i;
+    for(i = 0; i < pair_cnt * 2; i++) {
+        uint32_t gid = ascii_glyph_id(&fdsc, kern_letters[i / 2][i % 2]);
+        ids_8[i] = gid;
+        ids_16_buf[i] = gid;
+    }
+
+    lv_font_fmt_txt_kern_pair_t kern_pairs;
+    kern_pairs.glyph_ids = ids_16 ? (const void *)ids_16_buf : (const void *)ids_8;
+    kern_pairs.values = kern_values;
+    kern_pairs.pair_cnt = pair_cnt;
+    kern_pairs.glyph_ids_size = ids_16 ? 1 : 0;
+    fdsc.kern_dsc = &kern_pairs;
+    fdsc.kern_classes = 0;
+    fdsc.kern_scale = 16;
+
+    uint32_t left;
+    uint32_t right;
+    for(left = ' ' + 1; left < 127; left++) {
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc.glyph_dsc[ascii_glyph_id(&fdsc, left)];
+        for(right = ' ' + 1; right < 127; right++) {
+            int32_t kv = 0;
+            for(i = 0; i < pair_cnt; i++) {
+                if(kern_letters[i][0] == (char)left && kern_letters[i][1] == (char)right) kv = kern_values[i];
+            }
+
+            TEST_ASSERT_EQUAL((gdsc->adv_w + kv + 8) >> 4, lv_font_get_glyph_width(&font, left, right));
+        }
+    }
+
+    /*The kerning pairs are ignored*/
+    lv_font_set_kerning(&font, LV_FONT_KERNING_NONE);
+    TEST_ASSERT_EQUAL(lv_font_get_glyph_width(&font, 'A', 0), lv_font_get_glyph_width(&font, 'A', 'V'));
+    lv_font_set_kerning(&font, LV_FONT_KERNING_NORMAL);
+    TEST_ASSERT_NOT_EQUAL(lv_font_get_glyph_width(&font, 'A', 0), lv_font_get_glyph_width(&font, 'A', 'V'));
+
+#if LV_USE_FONT_KERN_LOOKUP
+    TEST_ASSERT_NOT_NULL(cache.kern_keys);
+#endif
+#if LV_USE_FONT_GLYPH_ID_LOOKUP || LV_USE_FONT_KERN_LOOKUP
+    /*The cache is on the stack, so free its tables*/
+    lv_font_fmt_txt_lookup_drop(&font);
+#endif
+#if LV_USE_FONT_KERN_LOOKUP
+    TEST_ASSERT_NULL(cache.kern_keys);
+#endif
+}
+
+void test_kern_pairs(void)
+{
+    check_kern_pairs(false);
+    check_kern_pairs(true);
+}
+
+void test_kerning_none(void)
+{
+    /*Class based kerning*/
+    lv_font_t font = lv_font_montserrat_28;
+    uint32_t kerned_cnt = 0;
+    uint32_t left;
+    uint32_t right;
+    for(left = 'A'; left <= 'Z'; left++) {
+        for(right = 'a'; right <= 'z'; right++) {
+            if(lv_font_get_glyph_width(&font, left, 0) != lv_font_get_glyph_width(&font, left, right)) kerned_cnt++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(0, kerned_cnt);
+
+    lv_font_set_kerning(&font, LV_FONT_KERNING_NONE);
+    for(left = 'A'; left <= 'Z'; left++) {
+        for(right = 'a'; right <= 'z'; right++) {
+            TEST_ASSERT_EQUAL(lv_font_get_glyph_width(&font, left, 0), lv_font_get_glyph_width(&font, left, right));
+        }
+    }
+}
+
+#endif
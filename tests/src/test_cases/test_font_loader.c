@@ -25,7 +25,9 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void compare_glyph_bitmaps(lv_font_t * f1, lv_font_t * f2);
 void test_font_loader(void);
+void test_font_loader_lazy(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -72,6 +74,59 @@ void test_font_loader(void)
     lv_font_free(font_3_bin);
 }
 
+void test_font_loader_lazy(void)
+{
+    /*'A' can't map the files, so the bitmaps are read from the file when they are needed*/
+    lv_font_t * font_1_bin = lv_font_load_lazy("A:src/test_assets/font_1.fnt");
+    lv_font_t * font_2_bin = lv_font_load_lazy("A:src/test_assets/font_2.fnt");
+    lv_font_t * font_3_bin = lv_font_load_lazy("A:src/test_assets/font_3.fnt");
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    TEST_ASSERT_NULL(((lv_font_fmt_txt_dsc_t *)font_1_bin->dsc)->glyph_bitmap);
+
+    compare_glyph_bitmaps(&font_1, font_1_bin);
+    compare_glyph_bitmaps(&font_2, font_2_bin);
+    compare_glyph_bitmaps(&font_3, font_3_bin);
+
+    lv_font_free(font_1_bin);
+    lv_font_free(font_2_bin);
+    lv_font_free(font_3_bin);
+
+    TEST_ASSERT_NULL(lv_font_load_lazy("A:src/test_assets/not_exist.fnt"));
+}
+
+static void compare_glyph_bitmaps(lv_font_t * f1, lv_font_t * f2)
+{
+    static uint8_t buf1[64 * 64];
+    static uint8_t buf2[64 * 64];
+    uint32_t letter;
+    uint32_t glyph_cnt = 0;
+    for(letter = 0x20; letter < 0x3000; letter++) {
+        lv_font_glyph_dsc_t g1;
+        lv_font_glyph_dsc_t g2;
+        bool found1 = f1->get_glyph_dsc(f1, &g1, letter, 0);
+        bool found2 = f2->get_glyph_dsc(f2, &g2, letter, 0);
+        TEST_ASSERT_EQUAL(found1, found2);
+        if(!found1) continue;
+
+        TEST_ASSERT_EQUAL(g1.adv_w, g2.adv_w);
+        TEST_ASSERT_EQUAL(g1.box_w, g2.box_w);
+        TEST_ASSERT_EQUAL(g1.box_h, g2.box_h);
+        uint32_t size = g1.box_w * g1.box_h;
+        if(size == 0) continue;
+        TEST_ASSERT_LESS_OR_EQUAL(sizeof(buf1), size);
+
+        TEST_ASSERT_NOT_NULL(f1->get_glyph_bitmap(f1, letter, buf1));
+        TEST_ASSERT_NOT_NULL(f2->get_glyph_bitmap(f2, letter, buf2));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(buf1, buf2, size);
+        glyph_cnt++;
+    }
+
+    TEST_ASSERT_GREATER_THAN(0, glyph_cnt);
+}
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
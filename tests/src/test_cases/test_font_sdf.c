@@ -0,0 +1,147 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_USE_FONT_SDF
+extern const lv_font_sdf_dsc_t test_font_sdf_ubuntu;
+
+static const char test_letters[] = "8ABWaego";
+
+/*Opacity of a pixel of a glyph, measured from the origin of the glyph (y upwards)*/
+static uint32_t glyph_opa(const lv_font_glyph_dsc_t * g, const uint8_t * bitmap, int32_t x, int32_t y)
+{
+    int32_t col = x - g->ofs_x;
+    int32_t row = g->ofs_y + g->box_h - 1 - y;
+    if(col < 0 || row < 0 || col >= g->box_w || row >= g->box_h) return 0;
+    return bitmap[row * g->box_w + col];
+}
+
+/*Compare the glyphs rendered from the distance fields with the glyphs rasterized by Tiny TTF*/
+static void check_size(lv_coord_t line_height)
+{
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * ttf = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, line_height);
+    lv_font_t sdf;
+    lv_font_sdf_init(&sdf, &test_font_sdf_ubuntu, line_height);
+    TEST_ASSERT_EQUAL(line_height, sdf.line_height);
+    TEST_ASSERT_INT_WITHIN(1, ttf->base_line, sdf.base_line);
+
+    const char * letter;
+    for(letter = test_letters; *letter; letter++) {
+        lv_font_glyph_dsc_t g_ttf;
+        lv_font_glyph_dsc_t g_sdf;
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(ttf, &g_ttf, *letter, 0));
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&sdf, &g_sdf, *letter, 0));
+        TEST_ASSERT_INT_WITHIN(1, g_ttf.adv_w, g_sdf.adv_w);
+        TEST_ASSERT_EQUAL(8, g_sdf.bpp);
+
+        /*Tiny TTF's bitmaps have an empty last row, so the glyphs are drawn 1 px higher.
+         *Compare the outlines at the same place.*/
+        g_ttf.ofs_y--;
+
+        uint8_t * bmp_ttf = lv_malloc(g_ttf.box_w * g_ttf.box_h);
+        uint8_t * bmp_sdf = lv_malloc(g_sdf.box_w * g_sdf.box_h);
+        TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(ttf, *letter, bmp_ttf));
+        TEST_ASSERT_EQUAL_PTR(bmp_sdf, lv_font_get_glyph_bitmap(&sdf, *letter, bmp_sdf));
+
+        /*The coverage and the shape should be close*/
+        int32_t x1 = LV_MIN(g_ttf.ofs_x, g_sdf.ofs_x);
+        int32_t x2 = LV_MAX(g_ttf.ofs_x + g_ttf.box_w, g_sdf.ofs_x + g_sdf.box_w);
+        int32_t y1 = LV_MIN(g_ttf.ofs_y, g_sdf.ofs_y);
+        int32_t y2 = LV_MAX(g_ttf.ofs_y + g_ttf.box_h, g_sdf.ofs_y + g_sdf.box_h);
+        uint32_t sum_ttf = 0;
+        uint32_t sum_sdf = 0;
+        uint32_t diff = 0;
+        int32_t x;
+        int32_t y;
+        for(y = y1; y < y2; y++) {
+            for(x = x1; x < x2; x++) {
+                uint32_t a_ttf = glyph_opa(&g_ttf, bmp_ttf, x, y);
+                uint32_t a_sdf = glyph_opa(&g_sdf, bmp_sdf, x, y);
+                sum_ttf += a_ttf;
+                sum_sdf += a_sdf;
+                diff += a_ttf > a_sdf ? a_ttf - a_sdf : a_sdf - a_ttf;
+            }
+        }
+
+        TEST_ASSERT_UINT32_WITHIN(sum_ttf / 10, sum_ttf, sum_sdf);
+        TEST_ASSERT_LESS_THAN_UINT32(sum_ttf / 4, diff);
+
+        lv_free(bmp_ttf);
+        lv_free(bmp_sdf);
+    }
+
+    lv_tiny_ttf_destroy(ttf);
+}
+
+void test_font_sdf_sizes(void)
+{
+    check_size(16);
+    check_size(24);
+    check_size(32);
+    check_size(50);
+    check_size(80);
+}
+
+void test_font_sdf_glyph_dsc(void)
+{
+    lv_font_t font;
+    lv_font_sdf_init(&font, &test_font_sdf_ubuntu, 32);
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&font, &g, 'Z', 0));
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&font, &g, 0x10000, 0));
+
+    /*Empty glyph*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, ' ', 0));
+    TEST_ASSERT_EQUAL(0, g.box_w);
+    TEST_ASSERT_EQUAL(0, g.box_h);
+    TEST_ASSERT_GREATER_THAN(0, g.adv_w);
+
+    /*The metrics scale with the size*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, 'W', 0));
+    uint32_t adv_w = g.adv_w;
+    uint32_t box_h = g.box_h;
+    lv_font_sdf_set_size(&font, 64);
+    TEST_ASSERT_EQUAL(64, font.line_height);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, 'W', 0));
+    TEST_ASSERT_INT_WITHIN(1, adv_w * 2, g.adv_w);
+    TEST_ASSERT_INT_WITHIN(2, box_h * 2, g.box_h);
+}
+
+void test_font_sdf_render(void)
+{
+    static lv_font_t fonts[3];
+    lv_font_sdf_init(&fonts[0], &test_font_sdf_ubuntu, 20);
+    lv_font_sdf_init(&fonts[1], &test_font_sdf_ubuntu, 40);
+    lv_font_sdf_init(&fonts[2], &test_font_sdf_ubuntu, 70);
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_obj_set_style_text_font(label, &fonts[i], 0);
+        lv_label_set_text(label, "Bag 8 ABBA Wage ÁWe");
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_sdf_1.png");
+}
+
+#endif
+
+#endif
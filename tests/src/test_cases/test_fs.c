@@ -12,6 +12,8 @@ static void read_range(lv_fs_file_t * f, uint32_t from, uint32_t to);
 
 static void read_random_drv(char drv_letter, uint32_t cache_size);
 
+static void decode_img_file(const char * fn, const uint8_t * px, uint32_t px_size);
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -80,6 +82,431 @@ void test_read_random(void)
     read_random_drv('B', 1024);
 }
 
+void test_map(void)
+{
+    lv_fs_res_t res;
+
+    /*'B' (POSIX) can map the file*/
+    lv_fs_file_t fb;
+    res = lv_fs_open(&fb, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    const void * data;
+    uint32_t size;
+    res = lv_fs_map(&fb, &data, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_TRUE(size >= strlen(read_exp));
+    TEST_ASSERT_TRUE(memcmp(data, read_exp, strlen(read_exp)) == 0);
+
+    res = lv_fs_unmap(&fb, data, size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    lv_fs_close(&fb);
+
+    /*'A' (STDIO) can't map files*/
+    lv_fs_file_t fa;
+    res = lv_fs_open(&fa, "A:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    res = lv_fs_map(&fa, &data, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, res);
+    TEST_ASSERT_NULL(data);
+    TEST_ASSERT_EQUAL(0, size);
+    lv_fs_close(&fa);
+}
+
+void test_map_img(void)
+{
+    uint8_t px[4 * 3];
+    uint32_t i;
+    for(i = 0; i < sizeof(px); i++) px[i] = i * 20;
+
+    lv_img_header_t header;
+    lv_memzero(&header, sizeof(header));
+    header.cf = LV_COLOR_FORMAT_A8;
+    header.w = 4;
+    header.h = 3;
+
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, "B:fs_map_img.bin", LV_FS_MODE_WR);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    lv_fs_write(&f, &header, sizeof(header), NULL);
+    lv_fs_write(&f, px, sizeof(px), NULL);
+    lv_fs_close(&f);
+
+    /*Mapped by the POSIX driver*/
+    decode_img_file("B:fs_map_img.bin", px, sizeof(px));
+
+    /*Read into a buffer by the STDIO driver*/
+    decode_img_file("A:fs_map_img.bin", px, sizeof(px));
+}
+
+void test_map_img_truncated(void)
+{
+    uint8_t data[64 + 2 * 3];
+    lv_memzero(data, sizeof(data));
+
+    lv_img_header_t header;
+    lv_memzero(&header, sizeof(header));
+    header.w = 4;
+    header.h = 3;
+
+    /*One byte of the pixels is missing.
+     *Written by the STDIO driver as it truncates the file. Other files are used below to bypass the block cache.*/
+    header.cf = LV_COLOR_FORMAT_A8;
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:fs_map_img_trunc.bin", LV_FS_MODE_WR));
+    lv_fs_write(&f, &header, sizeof(header), NULL);
+    lv_fs_write(&f, data, 4 * 3 - 1, NULL);
+    lv_fs_close(&f);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, "B:fs_map_img_trunc.bin", lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, "A:fs_map_img_trunc.bin", lv_color_black(), 0));
+
+    /*The palette and the first 2 rows of an indexed image*/
+    header.cf = LV_COLOR_FORMAT_I4;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:fs_map_img_trunc_i4.bin", LV_FS_MODE_WR));
+    lv_fs_write(&f, &header, sizeof(header), NULL);
+    lv_fs_write(&f, data, sizeof(data) - 2, NULL);
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, "B:fs_map_img_trunc_i4.bin", lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, "A:fs_map_img_trunc_i4.bin", lv_color_black(), 0));
+
+    /*The complete indexed image*/
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:fs_map_img_full_i4.bin", LV_FS_MODE_WR));
+    lv_fs_write(&f, &header, sizeof(header), NULL);
+    lv_fs_write(&f, data, sizeof(data), NULL);
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:fs_map_img_full_i4.bin", lv_color_black(), 0));
+    lv_img_decoder_close(&dsc);
+}
+
+static void decode_img_file(const char * fn, const uint8_t * px, uint32_t px_size)
+{
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, fn, lv_color_black(), 0);
+    TEST_ASSERT_EQUAL(LV_RES_OK, res);
+    TEST_ASSERT_EQUAL(4, dsc.header.w);
+    TEST_ASSERT_EQUAL(3, dsc.header.h);
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    TEST_ASSERT_TRUE(memcmp(dsc.img_data, px, px_size) == 0);
+    lv_img_decoder_close(&dsc);
+}
+
+#if LV_FS_BLOCK_CACHE_SIZE
+static void write_file(const char * fn, uint32_t size, uint8_t ofs)
+{
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, fn, LV_FS_MODE_WR);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        uint8_t v = (uint8_t)(i + ofs);
+        lv_fs_write(&f, &v, 1, NULL);
+    }
+    lv_fs_close(&f);
+}
+
+static void read_file_check(const char * fn, uint32_t size, uint8_t ofs, uint32_t chunk)
+{
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, fn, LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    uint8_t buf[1024];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        res = lv_fs_read(&f, buf, chunk, &br);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+        uint32_t i;
+        for(i = 0; i < br; i++) {
+            TEST_ASSERT_EQUAL_UINT8((uint8_t)(cnt + i + ofs), buf[i]);
+        }
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL(size, cnt);
+
+    lv_fs_close(&f);
+}
+
+void test_block_cache(void)
+{
+    lv_fs_block_cache_stats_t stats;
+    lv_fs_block_cache_drop(NULL);
+    lv_fs_block_cache_reset_stats();
+
+    /*Sequential read: the next blocks are read ahead*/
+    write_file("B:fs_block_cache.bin", 1000, 0);
+    read_file_check("B:fs_block_cache.bin", 1000, 0, 79);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.miss);
+    TEST_ASSERT_GREATER_THAN(0, stats.readahead);
+    TEST_ASSERT_EQUAL(1000, stats.used_size);
+
+    /*Reopen: everything is read from the cache*/
+    uint32_t miss = stats.miss;
+    read_file_check("B:fs_block_cache.bin", 1000, 0, 79);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(miss, stats.miss);
+    TEST_ASSERT_GREATER_THAN(0, stats.hit);
+
+    /*Seek backward and forward*/
+    lv_fs_file_t f;
+    lv_fs_open(&f, "B:fs_block_cache.bin", LV_FS_MODE_RD);
+    uint32_t pos;
+    uint8_t buf[8];
+    uint32_t br;
+    uint32_t ofs[] = {900, 10, 127, 128, 500, 996};
+    uint32_t i;
+    for(i = 0; i < sizeof(ofs) / sizeof(ofs[0]); i++) {
+        lv_fs_seek(&f, ofs[i], LV_FS_SEEK_SET);
+        lv_fs_read(&f, buf, 8, &br);
+        TEST_ASSERT_EQUAL(LV_MIN(8, 1000 - ofs[i]), br);
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)ofs[i], buf[0]);
+        lv_fs_tell(&f, &pos);
+        TEST_ASSERT_EQUAL(ofs[i] + br, pos);
+    }
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &pos);
+    TEST_ASSERT_EQUAL(1000, pos);
+    lv_fs_close(&f);
+
+    /*Opening for write drops the cached blocks*/
+    write_file("B:fs_block_cache.bin", 1000, 100);
+    read_file_check("B:fs_block_cache.bin", 1000, 100, 79);
+
+    /*A file larger than the cache*/
+    write_file("B:fs_block_cache_large.bin", 5000, 3);
+    read_file_check("B:fs_block_cache_large.bin", 5000, 3, 100);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.evict);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_FS_BLOCK_CACHE_SIZE, stats.used_size);
+
+    /*Large reads are not cached*/
+    uint32_t bypass = stats.bypass;
+    read_file_check("B:fs_block_cache_large.bin", 5000, 3, 1000);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(bypass, stats.bypass);
+
+    lv_fs_block_cache_drop("B:fs_block_cache_large.bin");
+    lv_fs_block_cache_drop("B:fs_block_cache.bin");
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.used_size);
+}
+#endif
+
+#if LV_USE_FS_ASYNC
+static uint32_t async_done_cnt;
+static lv_fs_async_req_t * async_last_req;
+static lv_fs_res_t async_last_res;
+static char * async_taken_buf;
+
+static void async_cb(lv_fs_async_req_t * req)
+{
+    async_done_cnt++;
+    async_last_req = req;
+    async_last_res = req->res;
+
+    if(req->type == LV_FS_ASYNC_READ_FILE) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, req->res);
+        TEST_ASSERT_EQUAL_STRING_LEN(read_exp, req->buf, strlen(read_exp));
+        /*Take over the buffer*/
+        async_taken_buf = req->buf;
+        req->buf = NULL;
+    }
+    else if(req->type == LV_FS_ASYNC_DIR_READ) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, req->res);
+        bool found = false;
+        uint32_t i;
+        for(i = 0; i < req->name_cnt; i++) {
+            if(strcmp(req->names[i], "readtest.txt") == 0) found = true;
+        }
+        TEST_ASSERT_TRUE(found);
+    }
+}
+
+static void async_wait(uint32_t cnt)
+{
+    uint32_t t = 0;
+    while(async_done_cnt < cnt && t < 2000) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        usleep(1000);
+        t++;
+    }
+    TEST_ASSERT_EQUAL(cnt, async_done_cnt);
+}
+
+void test_async(void)
+{
+    async_done_cnt = 0;
+
+    /*Open and read*/
+    lv_fs_file_t f;
+    lv_fs_async_req_t * req = lv_fs_async_open(&f, "A:src/test_files/readtest.txt", LV_FS_MODE_RD, async_cb, NULL);
+    TEST_ASSERT_NOT_NULL(req);
+    async_wait(1);
+    TEST_ASSERT_EQUAL_PTR(req, async_last_req);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, async_last_res);
+
+    char buf[32];
+    req = lv_fs_async_read(&f, buf, 11, async_cb, NULL);
+    TEST_ASSERT_NOT_NULL(req);
+    async_wait(2);
+    TEST_ASSERT_EQUAL_PTR(req, async_last_req);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, async_last_res);
+    TEST_ASSERT_EQUAL_STRING_LEN(read_exp, buf, 11);
+    lv_fs_close(&f);
+
+    /*Read a whole file*/
+    lv_fs_async_read_file("B:src/test_files/readtest.txt", async_cb, NULL);
+    async_wait(3);
+    TEST_ASSERT_NOT_NULL(async_taken_buf);
+    lv_free(async_taken_buf);
+    async_taken_buf = NULL;
+
+    /*Read a directory*/
+    lv_fs_async_dir_read("A:src/test_files", async_cb, NULL);
+    async_wait(4);
+
+    /*Canceled requests don't call the callback*/
+    lv_fs_file_t f2;
+    lv_fs_async_req_t * req1 = lv_fs_async_read_file("A:src/test_files/readtest.txt", async_cb, NULL);
+    lv_fs_async_req_t * req2 = lv_fs_async_open(&f2, "A:src/test_files/readtest.txt", LV_FS_MODE_RD, async_cb, NULL);
+    lv_fs_async_req_t * req3 = lv_fs_async_dir_read("A:src/test_files", async_cb, NULL);
+    lv_fs_async_cancel(req2);
+    lv_fs_async_cancel(req1);
+    usleep(10000);
+    lv_fs_async_cancel(req3);
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        usleep(1000);
+    }
+    TEST_ASSERT_EQUAL(4, async_done_cnt);
+
+    /*Errors are reported in the callback*/
+    lv_fs_async_open(&f2, "A:src/test_files/not_exist.txt", LV_FS_MODE_RD, async_cb, NULL);
+    async_wait(5);
+    TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, async_last_res);
+}
+#else
+void test_async(void)
+{
+    TEST_PASS();
+}
+#endif
+
+#if LV_USE_FS_ARCHIVE
+static void archive_read_check(const char * path, uint32_t repeat)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+
+    uint32_t len = strlen(read_exp);
+    uint32_t size;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &size);
+    TEST_ASSERT_EQUAL(repeat * (len + 1), size);    /*+1 for the new line*/
+
+    char buf[64];
+    uint32_t br;
+    uint32_t i;
+    for(i = 0; i < repeat; i++) {
+        lv_fs_seek(&f, i * (len + 1) + 100, LV_FS_SEEK_SET);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+        TEST_ASSERT_EQUAL(sizeof(buf), br);
+        TEST_ASSERT_EQUAL_MEMORY(read_exp + 100, buf, sizeof(buf));
+    }
+
+    /*Reading after the end*/
+    lv_fs_seek(&f, size - 10, LV_FS_SEEK_SET);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+    TEST_ASSERT_EQUAL(10, br);
+
+    lv_fs_close(&f);
+}
+
+static void archive_dir_check(const char * path, const char * exp)
+{
+    lv_fs_dir_t dir;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_dir_open(&dir, path));
+
+    char names[256] = "";
+    char fn[256];
+    while(lv_fs_dir_read(&dir, fn) == LV_FS_RES_OK && fn[0] != '\0') {
+        strcat(names, fn);
+        strcat(names, ",");
+    }
+    lv_fs_dir_close(&dir);
+    TEST_ASSERT_EQUAL_STRING(exp, names);
+}
+
+void test_archive(void)
+{
+    /*The archive was created by
+     *scripts/fs_archive_pack.py --compress -o test_archive.pak
+     *from readtest.txt, img/png_rgba.png, text/lorem4.txt (readtest.txt 4 times) and text/sub/hello.txt*/
+    const char * drv_paths[] = {"A:src/test_files/test_archive.pak", "B:src/test_files/test_archive.pak"};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_archive_mount(drv_paths[i]));
+
+        archive_read_check("C:readtest.txt", 1);
+        archive_read_check("C:/text/lorem4.txt", 4);
+
+        lv_fs_file_t f;
+        TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "C:text/lorem", LV_FS_MODE_RD));
+        TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "C:readtest.txt", LV_FS_MODE_WR));
+
+        archive_dir_check("C:", "/img,readtest.txt,/text,");
+        archive_dir_check("C:/text/", "lorem4.txt,/sub,");
+        archive_dir_check("C:text/sub", "hello.txt,");
+        lv_fs_dir_t dir;
+        TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, lv_fs_dir_open(&dir, "C:tex"));
+
+        /*Compressed files are decompressed on open so they can be always mapped*/
+        const void * data;
+        uint32_t size;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "C:text/lorem4.txt", LV_FS_MODE_RD));
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_map(&f, &data, &size));
+        TEST_ASSERT_EQUAL_MEMORY(read_exp, data, strlen(read_exp));
+        lv_fs_unmap(&f, data, size);
+        lv_fs_close(&f);
+
+        /*Uncompressed files can be mapped if the archive is mapped*/
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "C:text/sub/hello.txt", LV_FS_MODE_RD));
+        lv_fs_res_t res = lv_fs_map(&f, &data, &size);
+        if(i == 0) {
+            TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, res);
+        }
+        else {
+            TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+            TEST_ASSERT_EQUAL_MEMORY("hello\n", data, 6);
+            lv_fs_unmap(&f, data, size);
+        }
+        lv_fs_close(&f);
+
+        lv_img_header_t header;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info("C:img/png_rgba.png", &header));
+        TEST_ASSERT_EQUAL(100, header.w);
+        TEST_ASSERT_EQUAL(80, header.h);
+
+        lv_fs_archive_unmount();
+        TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "C:readtest.txt", LV_FS_MODE_RD));
+    }
+
+    /*Not an archive*/
+    TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, lv_fs_archive_mount("A:src/test_files/readtest.txt"));
+}
+#endif
+
 /**
  * Read bytes from the `from` index to the `to index`
  * Assume that file `f` has 256 byte of content 0..255
@@ -0,0 +1,113 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <unistd.h>
+
+static lv_area_t inv_area;
+static bool inv_called;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_USE_GIF
+
+static void invalidate_area_event_cb(lv_event_t * e)
+{
+    const lv_area_t * area = lv_event_get_param(e);
+    if(inv_called) _lv_area_join(&inv_area, &inv_area, area);
+    else inv_area = *area;
+    inv_called = true;
+}
+
+/*Step the time until the GIF shows its next frame.
+ *If the frames are decoded on a thread, the next frame might not be ready yet.*/
+static void wait_for_next_frame(void)
+{
+    lv_refr_now(NULL);
+    inv_called = false;
+
+    uint32_t i;
+    for(i = 0; i < 1000 && !inv_called; i++) {
+        lv_tick_inc(100);
+        lv_timer_handler();
+        if(!inv_called) usleep(1000);
+    }
+
+    TEST_ASSERT_TRUE(inv_called);
+}
+
+#endif
+
+void test_gif_play(void)
+{
+#if LV_USE_GIF
+    lv_disp_add_event(lv_disp_get_default(), invalidate_area_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    lv_obj_t * gif = lv_gif_create(lv_scr_act());
+    lv_gif_set_src(gif, "A:../examples/libs/gif/bulb.gif");
+    lv_obj_set_pos(gif, 100, 50);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/gif_1.png");
+
+    /*The second frame replaces the whole first frame*/
+    wait_for_next_frame();
+    TEST_ASSERT_EQUAL(100, inv_area.x1);
+    TEST_ASSERT_EQUAL(50, inv_area.y1);
+    TEST_ASSERT_EQUAL(159, inv_area.x2);
+    TEST_ASSERT_EQUAL(129, inv_area.y2);
+
+    /*The third frame changes only a few pixels around the second one*/
+    wait_for_next_frame();
+    TEST_ASSERT_EQUAL(125, inv_area.x1);
+    TEST_ASSERT_EQUAL(100, inv_area.y1);
+    TEST_ASSERT_EQUAL(131, inv_area.x2);
+    TEST_ASSERT_EQUAL(102, inv_area.y2);
+
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        wait_for_next_frame();
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/gif_2.png");
+
+    lv_disp_remove_event(lv_disp_get_default(), lv_disp_get_event_count(lv_disp_get_default()) - 1);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gif_restart(void)
+{
+#if LV_USE_GIF
+    lv_disp_add_event(lv_disp_get_default(), invalidate_area_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    lv_obj_t * gif = lv_gif_create(lv_scr_act());
+    lv_gif_set_src(gif, "A:../examples/libs/gif/bulb.gif");
+    lv_obj_set_pos(gif, 100, 50);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        wait_for_next_frame();
+    }
+
+    /*The frame decoded ahead is dropped and the first frame is shown again*/
+    lv_gif_restart(gif);
+    wait_for_next_frame();
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/gif_1.png");
+
+    lv_disp_remove_event(lv_disp_get_default(), lv_disp_get_event_count(lv_disp_get_default()) - 1);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
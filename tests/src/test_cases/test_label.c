@@ -577,4 +577,257 @@ void test_label_text_selection(void)
     TEST_ASSERT_EQUAL(selection_end, end);
 }
 
+#if LV_LABEL_LAYOUT_CACHE
+/*Compare the stored line breaks with breaking the lines again*/
+static void check_layout(lv_obj_t * obj)
+{
+    lv_label_t * l = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    lv_coord_t w = lv_obj_get_content_width(obj);
+
+    TEST_ASSERT_TRUE(lv_txt_layout_is_valid(&l->layout, l->text, font, letter_space, line_space, w,
+                                            LV_TEXT_FLAG_NONE));
+
+    uint32_t line_start = 0;
+    uint32_t line_cnt = 0;
+    while(l->text[line_start] != '\0') {
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&l->text[line_start], font, letter_space, w, NULL,
+                                                               LV_TEXT_FLAG_NONE);
+        TEST_ASSERT_LESS_THAN(l->layout.line_cnt, line_cnt);
+        TEST_ASSERT_EQUAL(line_start, l->layout.lines[line_cnt].start);
+        TEST_ASSERT_EQUAL(lv_txt_get_width(&l->text[line_start], line_end - line_start, font, letter_space),
+                          l->layout.lines[line_cnt].width);
+        line_start = line_end;
+        line_cnt++;
+    }
+    TEST_ASSERT_EQUAL(line_cnt, l->layout.line_cnt);
+    TEST_ASSERT_EQUAL(line_start, l->layout.text_len);
+
+    lv_point_t size;
+    lv_txt_get_size(&size, l->text, font, letter_space, line_space, w, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(size.x, l->layout.size.x);
+    TEST_ASSERT_EQUAL(size.y, l->layout.size.y);
+}
+
+void test_label_layout_cache(void)
+{
+    lv_obj_set_width(long_label_multiline, 150);
+    lv_refr_now(NULL);
+    check_layout(long_label_multiline);
+
+    /*Nothing changed, so the lines are not broken again: a marker in the stored lines is kept*/
+    lv_label_t * l = (lv_label_t *)long_label_multiline;
+    uint32_t line_cnt = l->layout.line_cnt;
+    lv_coord_t width_ori = l->layout.lines[0].width;
+    l->layout.lines[0].width = -1;
+    lv_obj_invalidate(long_label_multiline);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(-1, l->layout.lines[0].width);
+    l->layout.lines[0].width = width_ori;
+    check_layout(long_label_multiline);
+
+    /*The lines follow the width, the style and the text*/
+    lv_obj_set_width(long_label_multiline, 80);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(line_cnt, l->layout.line_cnt);
+    check_layout(long_label_multiline);
+
+    lv_obj_set_style_text_letter_space(long_label_multiline, 5, 0);
+    lv_refr_now(NULL);
+    check_layout(long_label_multiline);
+
+    lv_label_cut_text(long_label_multiline, 0, 28);
+    lv_refr_now(NULL);
+    check_layout(long_label_multiline);
+
+    lv_label_ins_text(long_label_multiline, 5, "abc def ");
+    lv_refr_now(NULL);
+    check_layout(long_label_multiline);
+
+    /*The text is modified in place*/
+    lv_label_get_text(long_label_multiline)[10] = '\n';
+    lv_label_set_text(long_label_multiline, NULL);
+    lv_refr_now(NULL);
+    check_layout(long_label_multiline);
+}
+#if LV_USE_BIDI
+void test_label_layout_cache_bidi(void)
+{
+    /*Hebrew words between Latin ones*/
+    lv_label_set_text(long_label_multiline, "abc \xd7\x90\xd7\x91\xd7\x92 def\n"
+                      "\xd7\x93\xd7\x94 ghi \xd7\x95\xd7\x96 jkl mno pqr stu vwx");
+    lv_obj_set_width(long_label_multiline, 100);
+    lv_obj_set_style_base_dir(long_label_multiline, LV_BASE_DIR_RTL, 0);
+    lv_refr_now(NULL);
+
+    /*Every line is stored in visual order*/
+    lv_label_t * l = (lv_label_t *)long_label_multiline;
+    TEST_ASSERT_GREATER_THAN(2, l->layout.line_cnt);
+    TEST_ASSERT_NOT_NULL(l->layout.bidi_text);
+    TEST_ASSERT_EQUAL(LV_BASE_DIR_RTL, l->layout.bidi_dir);
+
+    uint32_t i;
+    char buf[64];
+    for(i = 0; i < l->layout.line_cnt; i++) {
+        uint32_t line_start = l->layout.lines[i].start;
+        uint32_t line_end = i + 1 < l->layout.line_cnt ? l->layout.lines[i + 1].start : l->layout.text_len;
+        _lv_bidi_process_paragraph(&l->text[line_start], buf, line_end - line_start, LV_BASE_DIR_RTL, NULL, 0);
+        TEST_ASSERT_EQUAL_STRING(buf, &l->layout.bidi_text[line_start + i]);
+    }
+
+    /*Not processed again on redraw*/
+    char * bidi_text = l->layout.bidi_text;
+    lv_obj_invalidate(long_label_multiline);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(bidi_text, l->layout.bidi_text);
+
+    /*Processed again if the direction or the text changes*/
+    lv_obj_set_style_base_dir(long_label_multiline, LV_BASE_DIR_LTR, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(LV_BASE_DIR_LTR, l->layout.bidi_dir);
+
+    lv_label_set_text(long_label_multiline, "abc");
+    TEST_ASSERT_NULL(l->layout.bidi_text);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_STRING("abc", l->layout.bidi_text);
+}
+#endif
+
+void test_label_layout_cache_long_text(void)
+{
+    static char buf[16 * 1000];
+    uint32_t i;
+    uint32_t len = 0;
+    for(i = 0; i < 1000; i++) {
+        len += lv_snprintf(&buf[len], sizeof(buf) - len, "Line %d: text\n", (int)i);
+    }
+
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(long_label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(long_label_multiline, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(empty_label, LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 300, 200);
+    lv_obj_center(cont);
+    lv_obj_t * log_label = lv_label_create(cont);
+    lv_obj_set_width(log_label, 200);
+    lv_label_set_text_static(log_label, buf);
+    lv_refr_now(NULL);
+
+    lv_label_t * l = (lv_label_t *)log_label;
+    TEST_ASSERT_EQUAL(1000, l->layout.line_cnt);
+
+    /*The lines are found by their y coordinate and by their characters*/
+    const lv_font_t * font = lv_obj_get_style_text_font(log_label, LV_PART_MAIN);
+    lv_coord_t line_h = lv_font_get_line_height(font);
+    TEST_ASSERT_EQUAL(500, lv_txt_layout_get_line_at_y(&l->layout, 500 * line_h + 1));
+    TEST_ASSERT_EQUAL(500, lv_txt_layout_get_line_of_byte(&l->layout, l->layout.lines[500].start + 3));
+    TEST_ASSERT_EQUAL(500 * line_h, lv_txt_layout_get_line_y(&l->layout, 500));
+
+    uint32_t char_id = _lv_txt_encoded_get_char_id(buf, l->layout.lines[500].start + 3);
+    lv_point_t pos;
+    lv_label_get_letter_pos(log_label, char_id, &pos);
+    TEST_ASSERT_EQUAL(500 * line_h, pos.y);
+    pos.x++;
+    pos.y++;
+    TEST_ASSERT_EQUAL(char_id, lv_label_get_letter_on(log_label, &pos));
+    TEST_ASSERT_TRUE(lv_label_is_char_under_pos(log_label, &pos));
+
+    /*Drawing starts from the first visible line*/
+    lv_obj_scroll_to_y(cont, 500 * line_h + 5, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("label_layout_cache_long_text.png");
+
+    lv_obj_del(cont);
+}
+#endif
+
+#if LV_LABEL_BITMAP_CACHE
+void test_label_bitmap_cache(void)
+{
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(long_label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(long_label_multiline, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(empty_label, LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t * labels[5];
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        labels[i] = lv_label_create(active_screen);
+        lv_obj_set_width(labels[i], 300);
+        lv_obj_set_pos(labels[i], 10, 10 + i * 90);
+        lv_label_set_text(labels[i], long_text);
+    }
+
+    lv_obj_set_style_text_decor(labels[1], LV_TEXT_DECOR_UNDERLINE | LV_TEXT_DECOR_STRIKETHROUGH, 0);
+    lv_obj_set_style_text_color(labels[1], lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_text_opa(labels[2], LV_OPA_50, 0);
+    lv_obj_set_style_text_align(labels[2], LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_bg_opa(labels[2], LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(labels[2], lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_label_set_long_mode(labels[3], LV_LABEL_LONG_DOT);
+    lv_obj_set_height(labels[3], 30);
+    lv_obj_set_style_text_font(labels[4], &lv_font_montserrat_24, 0);
+    lv_obj_set_style_pad_all(labels[4], 10, 0);
+
+    /*The text drawn from the bitmaps looks the same as the normally drawn text*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("label_bitmap_cache.png");
+    for(i = 0; i < 5; i++) {
+        lv_label_set_bitmap_cache(labels[i], true);
+        TEST_ASSERT_TRUE(lv_label_get_bitmap_cache(labels[i]));
+    }
+    TEST_ASSERT_EQUAL_SCREENSHOT("label_bitmap_cache.png");
+
+    lv_label_t * l = (lv_label_t *)labels[0];
+    TEST_ASSERT_NOT_NULL(l->bitmap.data);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_A8, l->bitmap.header.cf);
+
+    /*Drawing again doesn't render the text again*/
+    const uint8_t * data_ori = l->bitmap.data;
+    lv_obj_invalidate(labels[0]);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(data_ori, l->bitmap.data);
+
+    /*The color is applied when the bitmap is drawn*/
+    lv_obj_set_style_text_color(labels[0], lv_palette_main(LV_PALETTE_GREEN), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(data_ori, l->bitmap.data);
+
+    /*The bitmap is rendered again after the text or the style changes*/
+    lv_label_set_text(labels[0], "Short text");
+    TEST_ASSERT_NULL(l->bitmap.data);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->bitmap.data);
+
+    lv_obj_set_style_text_font(labels[0], &lv_font_montserrat_24, 0);
+    TEST_ASSERT_NULL(l->bitmap.data);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->bitmap.data);
+
+    lv_obj_set_style_text_decor(labels[0], LV_TEXT_DECOR_UNDERLINE, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(LV_TEXT_DECOR_UNDERLINE, l->bitmap_decor);
+
+    /*The selected text is drawn normally*/
+    lv_label_set_text_selection_start(labels[0], 1);
+    lv_label_set_text_selection_end(labels[0], 4);
+    lv_label_set_text(labels[0], "Selected");
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(l->bitmap.data);
+
+    lv_label_set_text_selection_start(labels[0], LV_LABEL_TEXT_SELECTION_OFF);
+    lv_label_set_text_selection_end(labels[0], LV_LABEL_TEXT_SELECTION_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->bitmap.data);
+
+    lv_label_set_bitmap_cache(labels[0], false);
+    TEST_ASSERT_NULL(l->bitmap.data);
+    TEST_ASSERT_FALSE(lv_label_get_bitmap_cache(labels[0]));
+
+    for(i = 0; i < 5; i++) lv_obj_del(labels[i]);
+}
+#endif
+
 #endif
@@ -0,0 +1,105 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_obj_set_flex_flow(lv_scr_act(), LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(lv_scr_act(), LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_EVENLY);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+static lv_obj_t * img_create(const char * name, const void * img_src)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 150, LV_SIZE_CONTENT);
+    lv_obj_set_style_bg_color(cont, lv_palette_main(LV_PALETTE_LIGHT_BLUE), 0);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    lv_obj_t * img = lv_img_create(cont);
+    lv_img_set_src(img, img_src);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, name);
+
+    return img;
+}
+
+void test_png_decode(void)
+{
+#if LV_USE_PNG
+    img_create("RGBA", "A:src/test_files/png_rgba.png");
+    img_create("RGB16 tRNS", "A:src/test_files/png_rgb16.png");
+    img_create("I4 tRNS", "A:src/test_files/png_i4.png");
+    img_create("Gray2", "A:src/test_files/png_gray2.png");
+    img_create("Gray alpha", "A:src/test_files/png_gray_alpha.png");
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_1.png");
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_png_invalid_size(void)
+{
+#if LV_USE_PNG
+    static uint8_t data[32 * 1024];
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:src/test_files/png_rgba.png", LV_FS_MODE_RD));
+    uint32_t size;
+    lv_fs_read(&f, data, sizeof(data), &size);
+    lv_fs_close(&f);
+    TEST_ASSERT_LESS_THAN(sizeof(data), size);
+
+    /*The width in IHDR doesn't fit into `lv_img_header_t`, only its lower bits are seen by `decoder_info`*/
+    data[16] = 0x40;
+    data[17] = 0x00;
+    data[18] = 0x00;
+    data[19] = 0x01;
+
+    lv_img_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = data;
+    img_dsc.data_size = size;
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, &img_dsc, lv_color_black(), 0);
+    if(res == LV_RES_OK) {
+        /*Only a whole decoded image could be accepted, not a stream with the wrong width*/
+        bool decoded = dsc.img_data != NULL;
+        lv_img_decoder_close(&dsc);
+        TEST_ASSERT_TRUE(decoded);
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_png_transform(void)
+{
+#if LV_USE_PNG
+    /*Transformed images need the whole decoded image even with `LV_PNG_USE_STREAM`*/
+    lv_obj_t * img = img_create("Rotated", "A:src/test_files/png_rgba.png");
+    lv_img_set_angle(img, 300);
+
+    img = img_create("Zoomed", "A:src/test_files/png_i4.png");
+    lv_img_set_zoom(img, 384);
+
+    img = img_create("Rotated, zoomed", "A:src/test_files/png_gray_alpha.png");
+    lv_img_set_angle(img, 450);
+    lv_img_set_zoom(img, 200);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_2.png");
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,45 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_sjpg_decode(void)
+{
+#if LV_USE_SJPG
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, "A:../examples/libs/sjpg/small_image.sjpg");
+    lv_obj_align(img, LV_ALIGN_TOP_LEFT, 40, 40);
+
+    /*Show only the bottom part of the image to start reading from a middle slice*/
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 320, 200);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+    lv_obj_align(cont, LV_ALIGN_TOP_RIGHT, -40, 40);
+
+    img = lv_img_create(cont);
+    lv_img_set_src(img, "A:../examples/libs/sjpg/small_image.sjpg");
+    lv_obj_set_y(img, -100);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/sjpg_1.png");
+
+    /*Scroll the image upwards to read the slices backwards*/
+    lv_obj_set_y(img, -20);
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/sjpg_2.png");
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -151,4 +151,118 @@ void test_style_replacement(void)
     TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
 }
 
+void test_style_cache(void)
+{
+    lv_style_t style_red;
+    lv_style_t style_pr;
+    lv_style_init(&style_red);
+    lv_style_set_text_color(&style_red, lv_color_hex(0xff0000));
+    lv_style_set_bg_opa(&style_red, LV_OPA_50);
+    lv_style_init(&style_pr);
+    lv_style_set_text_color(&style_pr, lv_color_hex(0x00ff00));
+
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(parent);
+    lv_obj_add_style(parent, &style_red, 0);
+    lv_obj_add_style(parent, &style_pr, LV_STATE_PRESSED);
+    lv_obj_t * child = lv_obj_create(parent);
+    lv_obj_remove_style_all(child);
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(child, LV_PART_MAIN));
+#if LV_OBJ_STYLE_CACHE_SIZE
+    TEST_ASSERT_NOT_NULL(child->style_cache);
+#endif
+
+    /*The state of the parent changes the inherited value*/
+    lv_obj_add_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+    lv_obj_clear_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+
+    /*Modified and reported style*/
+    lv_style_set_text_color(&style_red, lv_color_hex(0x0000ff));
+    lv_obj_report_style_change(&style_red);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+
+    /*Added, removed and local styles*/
+    lv_obj_add_style(child, &style_red, 0);
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(child, LV_PART_MAIN));
+    lv_obj_set_style_bg_opa(child, LV_OPA_20, 0);
+    TEST_ASSERT_EQUAL(LV_OPA_20, lv_obj_get_style_bg_opa(child, LV_PART_MAIN));
+    lv_obj_remove_local_style_prop(child, LV_STYLE_BG_OPA, 0);
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(child, LV_PART_MAIN));
+    lv_obj_remove_style(child, &style_red, 0);
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(child, LV_PART_MAIN));
+
+    /*The parts are resolved separately*/
+    lv_obj_set_style_bg_opa(child, LV_OPA_70, LV_PART_SCROLLBAR);
+    TEST_ASSERT_EQUAL(LV_OPA_70, lv_obj_get_style_bg_opa(child, LV_PART_SCROLLBAR));
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(child, LV_PART_MAIN));
+
+    /*The inherited value comes from the new parent*/
+    lv_obj_t * parent2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x123456), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+    lv_obj_set_parent(child, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+
+    lv_obj_del(parent);
+    lv_obj_del(parent2);
+    lv_style_reset(&style_red);
+    lv_style_reset(&style_pr);
+}
+
+void test_style_prop_lookup_in_any_order(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+
+    /*Set the properties in a scrambled order*/
+    uint32_t n = _LV_STYLE_LAST_BUILT_IN_PROP;
+    uint32_t i;
+    for(i = 0; i < n; i++) {
+        lv_style_prop_t prop = 1 + (i * 50) % n;
+        lv_style_value_t v = {.num = prop * 10};
+        lv_style_set_prop(&style, prop, v);
+    }
+
+    /*Overwrite some of them*/
+    for(i = 1; i <= n; i += 3) {
+        lv_style_value_t v = {.num = i * 100};
+        lv_style_set_prop(&style, i, v);
+    }
+    lv_style_set_prop_meta(&style, 5, LV_STYLE_PROP_META_INHERIT);
+
+    lv_style_value_t v;
+    for(i = 1; i <= n; i++) {
+        if(i == 5) {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_INHERIT, lv_style_get_prop(&style, i, &v));
+            continue;
+        }
+        TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, i, &v));
+        TEST_ASSERT_EQUAL(i % 3 == 1 ? i * 100 : i * 10, v.num);
+    }
+
+    /*Remove every second property*/
+    for(i = 2; i <= n; i += 2) {
+        TEST_ASSERT_TRUE(lv_style_remove_prop(&style, i));
+    }
+
+    for(i = 1; i <= n; i++) {
+        if(i == 5) continue;
+        lv_style_res_t res = lv_style_get_prop(&style, i, &v);
+        if(i % 2 == 0) {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, res);
+        }
+        else {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, res);
+            TEST_ASSERT_EQUAL(i % 3 == 1 ? i * 100 : i * 10, v.num);
+        }
+    }
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, n + 1, &v));
+
+    lv_style_reset(&style);
+}
+
 #endif
@@ -11,18 +11,18 @@ void setUp(void)
 void tearDown(void)
 {
     /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
 }
 
-void test_tiny_ttf_rendering_test(void)
-{
 #if LV_USE_TINY_TTF
-    /*Create a font*/
-    extern const uint8_t ubuntu_font[];
-    extern size_t ubuntu_font_size;
-    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 30);
+extern const uint8_t ubuntu_font[];
+extern size_t ubuntu_font_size;
 
+static lv_obj_t * create_label(lv_font_t * font)
+{
     /*Create style with the new font*/
     static lv_style_t style;
+    lv_style_reset(&style);
     lv_style_init(&style);
     lv_style_set_text_font(&style, font);
     lv_style_set_text_align(&style, LV_TEXT_ALIGN_CENTER);
@@ -37,8 +37,55 @@ void test_tiny_ttf_rendering_test(void)
                       "I'm a font created with Tiny TTF\n"
                       "Accents: ÁÉÍÓÖŐÜŰ áéíóöőüű");
     lv_obj_center(label);
+    return label;
+}
+#endif
+
+void test_tiny_ttf_rendering_test(void)
+{
+#if LV_USE_TINY_TTF
+    /*Create a font*/
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 30);
+    create_label(font);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_1.png");
 
+    lv_obj_clean(lv_scr_act());
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_glyph_cache(void)
+{
+#if LV_USE_TINY_TTF
+    /*Most of the glyphs don't fit into the cache, so they are rendered again each time*/
+    lv_font_t * font = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 30, 64);
+    lv_obj_t * label = create_label(font);
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_1.png");
     TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_1.png");
+
+    /*A second font increases the cache size which is shared by the fonts*/
+    lv_font_t * font2 = lv_tiny_ttf_create_data_ex(ubuntu_font, ubuntu_font_size, 24, 64 * 1024);
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_1.png");
+
+    /*Glyphs of the other sizes are cached too, but they are not mixed*/
+    lv_tiny_ttf_set_size(font, 20);
+    lv_label_set_text(label, NULL);
+    lv_refr_now(NULL);
+    lv_tiny_ttf_set_size(font, 30);
+    lv_label_set_text(label, NULL);
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_1.png");
+
+    /*The cached glyphs of a font are not used by the other font*/
+    lv_obj_set_style_text_font(label, font2, 0);
+    lv_tiny_ttf_set_size(font2, 30);
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_1.png");
+
+    lv_obj_clean(lv_scr_act());
+    lv_tiny_ttf_destroy(font2);
+    lv_tiny_ttf_destroy(font);
 #else
     TEST_PASS();
 #endif
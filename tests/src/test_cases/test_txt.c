@@ -123,6 +123,121 @@ void test_txt_get_encoded_next_detect_invalid_4_byte_input(void)
     TEST_ASSERT_EQUAL_UINT32(0, result);
 }
 
+void test_txt_get_encoded_next_should_skip_invalid_first_byte(void)
+{
+    char msg[] = "\xf8\x90" "A";
+    uint32_t i = 0;
+
+    TEST_ASSERT_EQUAL_UINT32(0, _lv_txt_encoded_next(msg, &i));
+    TEST_ASSERT_EQUAL_UINT32(1, i);
+    TEST_ASSERT_EQUAL_UINT8(0, _lv_txt_encoded_size(msg));
+}
+
+void test_txt_get_encoded_next_should_stop_at_the_invalid_byte(void)
+{
+    char msg[] = "\xe2\x82";
+    uint32_t i = 0;
+
+    TEST_ASSERT_EQUAL_UINT32(0, _lv_txt_encoded_next(msg, &i));
+    TEST_ASSERT_EQUAL_UINT32(2, i);
+}
+
+void test_txt_length_and_indices_of_mixed_text(void)
+{
+    /*"aÁb€c𐌼d" is 7 characters in 1 + 2 + 1 + 3 + 1 + 4 + 1 bytes*/
+    char msg[] = "a\xc3\x81" "b\xe2\x82\xac" "c\xf0\x90\x8c\xbc" "d";
+
+    TEST_ASSERT_EQUAL_UINT32(7, _lv_txt_get_encoded_length(msg));
+    TEST_ASSERT_EQUAL_UINT32(0, _lv_txt_encoded_get_byte_id(msg, 0));
+    TEST_ASSERT_EQUAL_UINT32(3, _lv_txt_encoded_get_byte_id(msg, 2));
+    TEST_ASSERT_EQUAL_UINT32(7, _lv_txt_encoded_get_byte_id(msg, 4));
+    TEST_ASSERT_EQUAL_UINT32(12, _lv_txt_encoded_get_byte_id(msg, 6));
+    TEST_ASSERT_EQUAL_UINT32(13, _lv_txt_encoded_get_byte_id(msg, 100));
+    TEST_ASSERT_EQUAL_UINT32(2, _lv_txt_encoded_get_char_id(msg, 3));
+    TEST_ASSERT_EQUAL_UINT32(5, _lv_txt_encoded_get_char_id(msg, 8));
+    TEST_ASSERT_EQUAL_UINT32(7, _lv_txt_encoded_get_char_id(msg, 13));
+}
+
+void test_txt_get_width_should_add_the_glyph_widths(void)
+{
+    const lv_font_t * font = &lv_font_montserrat_14;
+    const char * txt = "AVAV To \xc3\x81rv\xc3\xadzt\xc5\xb1r\xc5\x91";
+    uint32_t len = (uint32_t)lv_strlen(txt);
+
+    /*Calculate the width letter by letter with kerning and letter space*/
+    lv_coord_t expected = 0;
+    uint32_t i = 0;
+    while(i < len) {
+        uint32_t letter;
+        uint32_t letter_next;
+        _lv_txt_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+        expected += lv_font_get_glyph_width(font, letter, letter_next) + 2;
+    }
+    expected -= 2;
+
+    TEST_ASSERT_EQUAL_INT(expected, lv_txt_get_width(txt, len, font, 2));
+
+    /*Only a part of the text, but the letter after it is used for kerning*/
+    lv_coord_t first = lv_font_get_glyph_width(font, 'A', 'V');
+    TEST_ASSERT_EQUAL_INT(first, lv_txt_get_width(txt, 1, font, 2));
+}
+
+static void check_layout_equal(const lv_txt_layout_t * edited, const lv_txt_layout_t * fresh)
+{
+    TEST_ASSERT_EQUAL_UINT32(fresh->line_cnt, edited->line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(fresh->text_len, edited->text_len);
+    TEST_ASSERT_EQUAL_INT(fresh->size.x, edited->size.x);
+    TEST_ASSERT_EQUAL_INT(fresh->size.y, edited->size.y);
+
+    uint32_t i;
+    for(i = 0; i < fresh->line_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(fresh->lines[i].start, edited->lines[i].start);
+        TEST_ASSERT_EQUAL_INT(fresh->lines[i].width, edited->lines[i].width);
+    }
+}
+
+void test_txt_layout_edit_should_match_breaking_the_lines_again(void)
+{
+    const lv_font_t * font = &lv_font_montserrat_14;
+    const char * words[] = {"Lorem ", "ipsum ", "dolor-sit ", "amet,", "\n", "consectetur ", "a", "\n\n", "elit "};
+    char text[1024] = "";
+    uint32_t seed = 1;
+
+    lv_txt_layout_t edited;
+    lv_txt_layout_t fresh;
+    lv_txt_layout_init(&edited);
+    lv_txt_layout_init(&fresh);
+    lv_txt_layout_update(&edited, text, font, 1, 2, 120, LV_TEXT_FLAG_NONE);
+
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t r = seed >> 8;
+        uint32_t len = (uint32_t)lv_strlen(text);
+        uint32_t pos = len ? r % (len + 1) : 0;
+
+        if(len > 600 || (r & 0x30) == 0) {
+            /*Delete a few bytes (the text is ASCII)*/
+            uint32_t del_len = LV_MIN(len - pos, (r >> 12) % 20);
+            _lv_txt_cut(text, pos, del_len);
+            lv_txt_layout_edit(&edited, text, pos, del_len, 0);
+        }
+        else {
+            const char * w = words[(r >> 12) % (sizeof(words) / sizeof(words[0]))];
+            _lv_txt_ins(text, pos, w);
+            lv_txt_layout_edit(&edited, text, pos, 0, (uint32_t)lv_strlen(w));
+        }
+
+        TEST_ASSERT_TRUE(lv_txt_layout_is_valid(&edited, text, font, 1, 2, 120, LV_TEXT_FLAG_NONE));
+        lv_txt_layout_invalidate(&fresh);
+        lv_txt_layout_update(&fresh, text, font, 1, 2, 120, LV_TEXT_FLAG_NONE);
+        check_layout_equal(&edited, &fresh);
+    }
+
+    lv_txt_layout_free(&edited);
+    lv_txt_layout_free(&fresh);
+}
+
 /* See #2615 for more information */
 void test_txt_next_line_should_handle_empty_string(void)
 {